@@ -74,6 +74,12 @@
     /** Size of the memory expand for `lv_malloc()` in bytes */
     #define LV_MEM_POOL_EXPAND_SIZE 0
 
+    /** With `LV_USE_OS` every thread can keep up to this many freed small blocks (<= 256 bytes)
+     *  per size class to serve its next allocations without locking the heap.
+     *  The blocks are returned to the heap in batches and every block gets a 4 or 8 bytes header.
+     *  0: disable */
+    #define LV_MEM_THREAD_CACHE_CNT 0
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #define LV_MEM_ADR 0     /**< 0: unused*/
     /* Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc */
@@ -151,6 +157,25 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Keep the buffers of the finished layers in a pool and reuse them for the next layers
+ * instead of allocating and freeing a buffer for each layer.
+ * The pool holds at most this many bytes of unused buffers. Buffers not reused for a while are freed.
+ * Set it to 0 to disable the pool. */
+#define LV_DRAW_LAYER_POOL_SIZE 0  /**< [bytes]*/
+
+/** Before rendering an area collect the opaque areas of the widgets drawn later
+ * and skip the widgets and draw tasks which are fully covered by them.
+ * It saves rendering time with overlapping opaque widgets but adds some overhead to each area.
+ * Set it to 0 to disable occlusion culling. */
+#define LV_DRAW_OCCLUSION_MAX_AREAS 0
+
+/** Allocate the draw tasks and their descriptors from a bump allocator which is reset
+ * after each rendered area instead of allocating and freeing them one by one on the heap.
+ * It's the size of the arena's first chunk which is kept between the areas. If an area needs more,
+ * additional chunks are allocated and freed when the area is rendered.
+ * Set it to 0 to disable the arena. */
+#define LV_DRAW_FRAME_ARENA_SIZE 0  /**< [bytes]*/
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -193,9 +218,13 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /** Allow buffering some shadow calculation.
          *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
+         *  `shadow_width + radius`.  Caching a shadow has `2 * shadow_size^2` RAM cost. */
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+        /** Number of shadows (with different width, radius or small size) to cache
+         *  if LV_DRAW_SW_SHADOW_CACHE_SIZE > 0. */
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -203,6 +232,11 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /** Number of cached gradient color maps (the most recently used ones are kept).
+     *  A map uses `(width or height) * 4` bytes. Complex gradients use 256 sized maps.
+     *  - 0: disables caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_CNT 4
+
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -423,6 +457,18 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Number of independently locked shards of the image and image header caches.
+ *  With several draw units or decoder threads, lookups in different shards don't block each other.
+ *  Each shard can hold `1 / LV_CACHE_SHARD_CNT` of the cache size, so the largest decoded image
+ *  has to fit into `LV_CACHE_DEF_SIZE / LV_CACHE_SHARD_CNT`.
+ *  - 1: not sharded */
+#define LV_CACHE_SHARD_CNT 1
+
+/** Use the scan resistant 2Q policy instead of LRU in the image, image header, FreeType and Tiny TTF caches.
+ *  Images and glyphs used only once (e.g. while scrolling through a long list) don't evict
+ *  the frequently used ones. See `lv_cache_class_2q_count/size`. */
+#define LV_CACHE_USE_2Q 0
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -1003,6 +1049,9 @@
     /** Profiler end point function with custom tag */
     #define LV_PROFILER_END_TAG   LV_PROFILER_BUILTIN_END_TAG
 
+    /** Profiler function to record the value of a counter */
+    #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+
     /*Enable layout profiler*/
     #define LV_PROFILER_LAYOUT 1
 
@@ -1137,6 +1186,12 @@
     #define LV_LINUX_FBDEV_BUFFER_SIZE   60
 #endif
 
+/** Headless display which streams the rendered areas to a client over a local TCP socket */
+#define LV_USE_REMOTE_FB        0
+#if LV_USE_REMOTE_FB
+    #define LV_REMOTE_FB_BUFFER_SIZE    60  /**< Number of rows in the draw buffer */
+#endif
+
 /** Use Nuttx to open window and handle touchscreen */
 #define LV_USE_NUTTX    0
 
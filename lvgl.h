@@ -21,6 +21,7 @@ extern "C" {
 #include "src/lv_init.h"
 
 #include "src/stdlib/lv_mem.h"
+#include "src/stdlib/lv_arena.h"
 #include "src/stdlib/lv_string.h"
 #include "src/stdlib/lv_sprintf.h"
 
@@ -28,6 +29,7 @@ extern "C" {
 #include "src/misc/lv_timer.h"
 #include "src/misc/lv_math.h"
 #include "src/misc/lv_array.h"
+#include "src/misc/lv_prefix_sum.h"
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_profiler_builtin.h"
@@ -20,6 +20,7 @@ extern "C" {
 #include "src/misc/lv_text_private.h"
 #include "src/misc/cache/lv_cache_entry_private.h"
 #include "src/misc/cache/lv_cache_private.h"
+#include "src/misc/cache/lv_image_cache_private.h"
 #include "src/layouts/lv_layout_private.h"
 #include "src/stdlib/lv_mem_private.h"
 #include "src/others/file_explorer/lv_file_explorer_private.h"
@@ -82,6 +83,7 @@ extern "C" {
 #include "src/widgets/win/lv_win_private.h"
 #include "src/widgets/keyboard/lv_keyboard_private.h"
 #include "src/widgets/line/lv_line_private.h"
+#include "src/widgets/list/lv_list_private.h"
 #include "src/widgets/animimage/lv_animimage_private.h"
 #include "src/widgets/dropdown/lv_dropdown_private.h"
 #include "src/widgets/menu/lv_menu_private.h"
@@ -102,6 +104,7 @@ extern "C" {
 #include "src/libs/ffmpeg/lv_ffmpeg_private.h"
 #include "src/widgets/lottie/lv_lottie_private.h"
 #include "src/osal/lv_os_private.h"
+#include "src/osal/lv_atomic_private.h"
 
 /*********************
  *      DEFINES
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+"""
+Generate the lookup tables of the built-in cubic-bezier animation paths
+into src/misc/lv_anim_path_lut_gen.c
+"""
+
+import os
+import sys
+
+# Number of segments of the tables. The paths interpolate linearly between the points.
+SEGMENTS = 64
+
+# The `LV_BEZIER_VAL_MAX` range of the x and y values
+VAL_MAX = 1024
+
+paths = [
+    {'name': 'ease_in',     'para': (0.42, 0, 1, 1)},
+    {'name': 'ease_out',    'para': (0, 0, 0.58, 1)},
+    {'name': 'ease_in_out', 'para': (0.42, 0, 0.58, 1)},
+    {'name': 'overshoot',   'para': (341 / VAL_MAX, 0, 683 / VAL_MAX, 1300 / VAL_MAX)},
+]
+
+
+def bezier(t, p1, p2):
+    return 3 * (1 - t) * (1 - t) * t * p1 + 3 * (1 - t) * t * t * p2 + t * t * t
+
+
+def cubic_bezier(x, x1, y1, x2, y2):
+    """Find `t` for `x` by bisection and return `y` at `t`"""
+    lo = 0.0
+    hi = 1.0
+    for _ in range(100):
+        t = (lo + hi) / 2
+        if bezier(t, x1, x2) < x:
+            lo = t
+        else:
+            hi = t
+    return bezier((lo + hi) / 2, y1, y2)
+
+
+def print_lut(path):
+    x1, y1, x2, y2 = path['para']
+    values = []
+    for i in range(SEGMENTS + 1):
+        y = cubic_bezier(i / SEGMENTS, x1, y1, x2, y2)
+        values.append(round(y * VAL_MAX))
+
+    print(f"static const int16_t {path['name']}_values[] = {{")
+    for i in range(0, len(values), 12):
+        print('    ' + ', '.join(str(v) for v in values[i:i + 12]) + ',')
+    print('};')
+    print()
+    print(f"const lv_anim_path_lut_t lv_anim_path_lut_{path['name']} = {{")
+    print(f"    .values = {path['name']}_values,")
+    print(f"    .cnt = {len(values)},")
+    print('};')
+
+
+base_dir = os.path.abspath(os.path.dirname(__file__))
+sys.stdout = open(base_dir + '/../src/misc/lv_anim_path_lut_gen.c', 'w')
+
+print(f'''/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "{os.path.split(__file__)[-1]}"
+ **********************************************************************
+ */
+
+#include "lv_anim.h"''')
+
+for p in paths:
+    print()
+    print_lut(p)
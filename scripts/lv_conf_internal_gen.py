@@ -198,6 +198,12 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
     #define LV_USE_MEM_MONITOR 0
 #endif /*LV_USE_SYSMON*/
 
+/*An older Kconfig without LV_CACHE_SHARD_CNT leaves it 0. Don't shard in this case.*/
+#if LV_CACHE_SHARD_CNT < 1
+    #undef LV_CACHE_SHARD_CNT
+    #define LV_CACHE_SHARD_CNT 1
+#endif
+
 #ifndef LV_USE_LZ4
     #define LV_USE_LZ4  (LV_USE_LZ4_INTERNAL || LV_USE_LZ4_EXTERNAL)
 #endif
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+
+"""
+Convert XML components to the binary format which can be loaded by
+`lv_xml_component_register_from_binary_file()` or
+`lv_xml_component_register_from_binary_data()`.
+
+The params, consts, styles and the view are stored with a deduplicated
+string table and the constants are resolved in the view, so loading
+doesn't need to parse XML at all.
+
+Usage:
+    python3 xml_to_bin.py my_button.xml my_card.xml --output out_dir
+
+The name of the component is the name of the XML file without extension.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+# Keep in sync with `lv_xml_component_private.h`
+MAGIC = b'LVXB'
+VERSION = 1
+HEADER_SIZE = 64
+STR_NONE = 0xFFFFFFFF
+FLAG_WIDGET = 0x01
+INSTR_VIEW = 0x01
+INSTR_PARAM = 0x02
+
+
+class StringTable:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}
+
+    def add(self, s):
+        if s is None:
+            return STR_NONE
+        if s not in self.offsets:
+            self.offsets[s] = len(self.data)
+            self.data += s.encode('utf-8') + b'\0'
+        return self.offsets[s]
+
+
+class Component:
+    def __init__(self, name, root):
+        self.name = name
+        self.is_widget = root.tag == 'widget'
+        self.extends = 'lv_obj'
+        self.params = []    # (name, type, default)
+        self.consts = {}    # name -> value
+        self.styles = []    # [(attr, value), ...]
+        self.instrs = []    # (name, flags, [(attr, value), ...]) or None to close an element
+
+        for section in root:
+            if section.tag == 'api':
+                for prop in section.iter():
+                    if prop is section:
+                        continue
+                    self.params.append((prop.get('name'), prop.get('type'), prop.get('default')))
+            elif section.tag == 'consts':
+                for const in section:
+                    name = const.get('name')
+                    value = const.get('value')
+                    if name is None or value is None:
+                        print(f"{self.name}: 'name' or 'value' is missing from a constant", file=sys.stderr)
+                        continue
+                    self.consts.setdefault(name, value)
+            elif section.tag == 'styles':
+                for style in section:
+                    if style.tag == 'style':
+                        self.styles.append(list(style.attrib.items()))
+            elif section.tag == 'view':
+                self.extends = section.get('extends', 'lv_obj')
+                self.add_element(section, True)
+
+        if not self.instrs:
+            raise ValueError(f"'{self.name}' has no view")
+
+    def add_element(self, element, is_view):
+        name = self.extends if is_view else element.tag
+        flags = INSTR_VIEW if is_view else 0
+        attrs = []
+        for attr, value in element.attrib.items():
+            if attr != 'styles':
+                if value.startswith('$'):
+                    flags |= INSTR_PARAM
+                elif value.startswith('#'):
+                    # The constants are resolved here, just like the runtime does on registration
+                    if value[1:] in self.consts:
+                        value = self.consts[value[1:]]
+                    else:
+                        attr = ''
+                        value = ''
+            attrs.append((attr, value))
+
+        self.instrs.append((name, flags, attrs))
+        for child in element:
+            self.add_element(child, False)
+        self.instrs.append(None)
+
+    def to_bytes(self):
+        strs = StringTable()
+        refs = []
+
+        def add_attrs(attrs):
+            idx = len(refs)
+            for attr, value in attrs:
+                refs.append(strs.add(attr))
+                refs.append(strs.add(value))
+            return idx
+
+        params = b''.join(struct.pack('<3I', strs.add(n), strs.add(t), strs.add(d)) for n, t, d in self.params)
+        consts = b''.join(struct.pack('<2I', strs.add(n), strs.add(v)) for n, v in self.consts.items())
+        styles = b''.join(struct.pack('<2I', len(s), add_attrs(s)) for s in self.styles)
+
+        instrs = b''
+        for instr in self.instrs:
+            if instr is None:
+                instrs += struct.pack('<4I', STR_NONE, 0, 0, 0)
+            else:
+                name, flags, attrs = instr
+                instrs += struct.pack('<4I', strs.add(name), flags, len(attrs), add_attrs(attrs))
+
+        name_ref = strs.add(self.name)
+        extends_ref = strs.add(self.extends)
+        ref_data = struct.pack(f'<{len(refs)}I', *refs)
+
+        body = bytearray()
+        sections = []
+        for data, cnt in ((params, len(self.params)), (consts, len(self.consts)), (styles, len(self.styles)),
+                          (instrs, len(self.instrs)), (ref_data, len(refs)), (bytes(strs.data), len(strs.data))):
+            sections.append((cnt, HEADER_SIZE + len(body)))
+            body += data
+
+        header = MAGIC + struct.pack('<2H', VERSION, FLAG_WIDGET if self.is_widget else 0)
+        header += struct.pack('<2I', name_ref, extends_ref)
+        for cnt, ofs in sections:
+            header += struct.pack('<2I', cnt, ofs)
+        assert len(header) == HEADER_SIZE
+
+        return bytes(header + body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='LVGL XML component to binary converter.')
+    parser.add_argument('input', nargs='+', help='XML component files')
+    parser.add_argument('--output', default='.', help='output directory')
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    for path in args.input:
+        name = os.path.splitext(os.path.basename(path))[0]
+        component = Component(name, ET.parse(path).getroot())
+        out_path = os.path.join(args.output, name + '.lvxb')
+        with open(out_path, 'wb') as f:
+            f.write(component.to_bytes())
+        print(f'{path} -> {out_path}')
+
+
+if __name__ == '__main__':
+    main()
@@ -106,6 +106,8 @@ typedef struct _lv_global_t {
 
     lv_event_t * event_header;
     uint32_t event_last_register_id;
+    uint32_t inv_area_tracker_cnt;  /**< Number of objects with `spec_attr->inv_area_tracked` set */
+    uint32_t layer_cache_cnt;       /**< Number of objects with an allocated `spec_attr->layer_cache` */
 
     lv_timer_state_t timer_state;
     lv_anim_state_t anim_state;
@@ -123,11 +125,14 @@ typedef struct _lv_global_t {
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
+    lv_cache_t * sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    lv_cache_t * sw_grad_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -193,6 +198,11 @@ typedef struct _lv_global_t {
     struct _snippet_stack * span_snippet_stack;
 #endif
 
+#if LV_USE_OBSERVER
+    lv_subject_t * subject_published_head;      /**< Subjects with a value published from any thread*/
+    lv_subject_t * subject_applying_head;       /**< Published subjects being applied by the LVGL thread*/
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
     struct _lv_profiler_builtin_ctx_t * profiler_context;
 #endif
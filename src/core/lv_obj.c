@@ -254,8 +254,9 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
         }
     }
 
-    if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+    if((was_on_layout != lv_obj_is_layout_positioned(obj)) ||
+       (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2 | LV_OBJ_FLAG_FLEX_IN_NEW_TRACK))) {
+        lv_obj_mark_layout_as_dirty_from(lv_obj_get_parent(obj), lv_obj_get_index(obj));
         lv_obj_mark_layout_as_dirty(obj);
     }
 
@@ -283,16 +284,19 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & LV_OBJ_FLAG_CACHE_LAYER) lv_obj_free_layer_cache(obj);
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
-            lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+            lv_obj_mark_layout_as_dirty_from(lv_obj_get_parent(obj), lv_obj_get_index(obj));
             lv_obj_mark_layout_as_dirty(obj);
         }
     }
 
-    if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+    if((was_on_layout != lv_obj_is_layout_positioned(obj)) ||
+       (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2 | LV_OBJ_FLAG_FLEX_IN_NEW_TRACK))) {
+        lv_obj_mark_layout_as_dirty_from(lv_obj_get_parent(obj), lv_obj_get_index(obj));
     }
 
 }
@@ -535,6 +539,11 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 
         lv_event_remove_all(&obj->spec_attr->event_list);
+        lv_obj_free_layer_cache(obj);
+        lv_obj_set_inv_area_tracked(obj, false);
+
+        lv_free(obj->spec_attr->layout_data);
+        obj->spec_attr->layout_data = NULL;
 
 #if LV_DRAW_TRANSFORM_USE_MATRIX
         if(obj->spec_attr->matrix) {
@@ -848,7 +857,8 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout || align) {
-            lv_obj_mark_layout_as_dirty(obj);
+            /*The children are the same, the layout will see if it needs to place them again on the new size*/
+            lv_obj_mark_layout_as_dirty_from(obj, LV_OBJ_LAYOUT_INV_SELF);
         }
 
         uint32_t i;
@@ -864,12 +874,17 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout || align || w == LV_SIZE_CONTENT || h == LV_SIZE_CONTENT) {
-            lv_obj_mark_layout_as_dirty(obj);
+            /*Without a child the change was already marked where the children were removed or moved*/
+            lv_obj_t * child = lv_event_get_param(e);
+            uint32_t child_id = LV_OBJ_LAYOUT_INV_SELF;
+            if(child && lv_obj_get_parent(child) == obj) child_id = lv_obj_get_index(child);
+            lv_obj_mark_layout_as_dirty_from(obj, child_id);
         }
     }
     else if(code == LV_EVENT_CHILD_DELETED) {
+        /*The index of the removed child was marked when it was removed from the children*/
         obj->readjust_scroll_after_layout = 1;
-        lv_obj_mark_layout_as_dirty(obj);
+        lv_obj_mark_layout_as_dirty_from(obj, LV_OBJ_LAYOUT_INV_SELF);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
         int32_t d = lv_obj_calculate_ext_draw_size(obj, LV_PART_MAIN);
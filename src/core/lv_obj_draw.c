@@ -12,12 +12,20 @@
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/lv_area_private.h"
 #include "../draw/lv_draw_arc.h"
+#include "../draw/lv_draw_buf.h"
+#include "../draw/lv_draw_private.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
+#define _layer_memory LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers
+#define _inv_area_tracker_cnt LV_GLOBAL_DEFAULT()->inv_area_tracker_cnt
+#define _layer_cache_cnt LV_GLOBAL_DEFAULT()->layer_cache_cnt
 
 /**********************
  *      TYPEDEFS
@@ -369,6 +377,83 @@ lv_layer_type_t lv_obj_get_layer_type(const lv_obj_t * obj)
     else return LV_LAYER_TYPE_NONE;
 }
 
+void lv_obj_invalidate_layer_cache(const lv_obj_t * obj)
+{
+    if(_layer_cache_cnt == 0) return;
+
+    /*The retained layers of the ancestors contain this object too*/
+    while(obj) {
+        if(obj->spec_attr) obj->spec_attr->layer_cache_valid = 0;
+        obj = obj->parent;
+    }
+}
+
+void lv_obj_set_inv_area_tracked(lv_obj_t * obj, bool en)
+{
+    if(en) lv_obj_allocate_spec_attr(obj);
+    else if(obj->spec_attr == NULL) return;
+
+    if(obj->spec_attr->inv_area_tracked == en) return;
+
+    obj->spec_attr->inv_area_tracked = en;
+    if(en) _inv_area_tracker_cnt++;
+    else _inv_area_tracker_cnt--;
+}
+
+void lv_obj_send_inv_area_to_trackers(const lv_obj_t * obj, const lv_area_t * area)
+{
+    if(_inv_area_tracker_cnt == 0) return;
+
+    /*Truncate the area to the object and its parents and transform it on the way
+     *the same way as `lv_obj_area_is_visible` does*/
+    lv_area_t area_tmp;
+    lv_area_t obj_coords;
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_copy(&obj_coords, &obj->coords);
+    lv_area_increase(&obj_coords, ext_size, ext_size);
+    if(!lv_area_intersect(&area_tmp, area, &obj_coords)) return;
+
+    while(obj) {
+        if(lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) {
+            lv_obj_get_transformed_area(obj, &area_tmp, LV_OBJ_POINT_TRANSFORM_FLAG_NONE);
+            /*Make the area slightly larger to avoid rounding errors as `lv_obj_invalidate_area` does*/
+            lv_area_increase(&area_tmp, 5, 5);
+        }
+
+        if(obj->spec_attr && obj->spec_attr->inv_area_tracked) {
+            lv_area_t area_send = area_tmp;
+            lv_obj_send_event((lv_obj_t *)obj, LV_EVENT_INVALIDATE_AREA, &area_send);
+        }
+
+        const lv_obj_t * parent = obj->parent;
+        if(parent == NULL) break;
+
+        lv_area_t parent_coords = parent->coords;
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            int32_t parent_ext_size = lv_obj_get_ext_draw_size(parent);
+            lv_area_increase(&parent_coords, parent_ext_size, parent_ext_size);
+        }
+        if(!lv_area_intersect(&area_tmp, &area_tmp, &parent_coords)) return;
+
+        obj = parent;
+    }
+}
+
+void lv_obj_free_layer_cache(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    lv_draw_buf_t * cache = obj->spec_attr->layer_cache;
+    uint32_t cache_size = cache->header.h * cache->header.stride;
+    _layer_memory -= LV_MIN(_layer_memory, cache_size);
+
+    lv_image_cache_drop(cache);
+    lv_draw_buf_destroy(cache);
+    obj->spec_attr->layer_cache = NULL;
+    obj->spec_attr->layer_cache_valid = 0;
+    _layer_cache_cnt--;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -37,6 +37,39 @@ int32_t lv_obj_get_ext_draw_size(const lv_obj_t * obj);
 
 lv_layer_type_t lv_obj_get_layer_type(const lv_obj_t * obj);
 
+/**
+ * Mark the retained layer of an object and all of its ancestors as outdated.
+ * Called when something is invalidated on the object.
+ * Does nothing if no object has a retained layer.
+ * @param obj       pointer to an object
+ */
+void lv_obj_invalidate_layer_cache(const lv_obj_t * obj);
+
+/**
+ * Enable or disable sending `LV_EVENT_INVALIDATE_AREA` to an object when an area
+ * of its subtree is invalidated. Sets `spec_attr->inv_area_tracked`.
+ * @param obj       pointer to an object
+ * @param en        true: track the invalidated areas
+ */
+void lv_obj_set_inv_area_tracked(lv_obj_t * obj, bool en);
+
+/**
+ * Send `LV_EVENT_INVALIDATE_AREA` to the object and to its ancestors which track
+ * the invalidated areas of their subtree (`spec_attr->inv_area_tracked` is set).
+ * The area is truncated to the object and its parents, and transformed as it's drawn.
+ * Does nothing if no object tracks the invalidated areas.
+ * Called when something is invalidated on the object, even if it's not visible.
+ * @param obj       pointer to an object
+ * @param area      the invalidated area in absolute coordinates
+ */
+void lv_obj_send_inv_area_to_trackers(const lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Free the retained layer of an object (if any).
+ * @param obj       pointer to an object
+ */
+void lv_obj_free_layer_cache(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
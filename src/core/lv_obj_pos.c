@@ -281,6 +281,13 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
+    /*Any of the children might have changed*/
+    lv_obj_mark_layout_as_dirty_from(obj, 0);
+}
+
+void lv_obj_mark_layout_as_dirty_from(lv_obj_t * obj, uint32_t child_id)
+{
+    if(obj->spec_attr) obj->spec_attr->layout_inv_child_id = LV_MIN(obj->spec_attr->layout_inv_child_id, child_id);
     obj->layout_inv = 1;
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
@@ -823,6 +830,10 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Even if the area won't be redrawn now, the retained layers are outdated*/
+    lv_obj_invalidate_layer_cache(obj);
+    lv_obj_send_inv_area_to_trackers(obj, area);
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -887,10 +898,7 @@ bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
     /*The area is not on the object*/
     if(!lv_area_intersect(area, area, &obj_coords)) return false;
 
-    if(!is_transformed(obj)) {
-        *area = obj_coords;
-    }
-    else {
+    if(is_transformed(obj)) {
         lv_obj_get_transformed_area(obj, area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
     }
 
@@ -907,10 +915,7 @@ bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
             lv_area_increase(&parent_coords, parent_ext_size, parent_ext_size);
         }
 
-        if(!is_transformed(parent)) {
-            parent_coords = parent->coords;
-        }
-        else {
+        if(is_transformed(parent)) {
             lv_obj_get_transformed_area(parent, &parent_coords, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
         }
         if(!lv_area_intersect(area, area, &parent_coords)) return false;
@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Index for `lv_obj_mark_layout_as_dirty_from()` if only the object itself has changed, not its children */
+#define LV_OBJ_LAYOUT_INV_SELF      (UINT32_MAX - 1)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,18 +38,24 @@ struct _lv_obj_spec_attr_t {
     lv_matrix_t * matrix;           /**< The transform matrix*/
 #endif
     lv_event_list_t event_list;
+    lv_draw_buf_t * layer_cache;    /**< The retained layer if `LV_OBJ_FLAG_CACHE_LAYER` is set*/
 
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
 
+    void * layout_data;             /**< Data saved by the layout to update the children incrementally*/
+    uint32_t layout_inv_child_id;   /**< The children before this index haven't changed since the last layout*/
+
     uint16_t child_cnt;             /**< Number of children*/
     uint16_t scrollbar_mode : 2;    /**< How to display scrollbars, see `lv_scrollbar_mode_t`*/
     uint16_t scroll_snap_x : 2;     /**< Where to align the snappable children horizontally, see `lv_scroll_snap_t`*/
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
+    uint16_t layer_cache_valid : 1; /**< `layer_cache` matches the current content of the subtree*/
+    uint16_t inv_area_tracked : 1;  /**< Send `LV_EVENT_INVALIDATE_AREA` when an area of the subtree is invalidated*/
 };
 
 struct _lv_obj_t {
@@ -80,6 +89,16 @@ struct _lv_obj_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Mark the layout of an object as dirty because its children have changed from an index.
+ * Unlike `lv_obj_mark_layout_as_dirty()` it allows the layout to keep the position of the
+ * children before the changed one.
+ * @param obj       pointer to an object
+ * @param child_id  index of the first changed child, the number of children if the last child was removed,
+ *                  or `LV_OBJ_LAYOUT_INV_SELF` if only `obj` itself has changed
+ */
+void lv_obj_mark_layout_as_dirty_from(lv_obj_t * obj, uint32_t child_id);
+
 /**********************
  *      MACROS
  **********************/
@@ -10,6 +10,7 @@
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_draw_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_color.h"
@@ -58,7 +59,8 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
-static void trans_anim_cb(void * _tr, int32_t v);
+static bool trans_apply_value(trans_t * tr, int32_t v);
+static void trans_anim_batch_cb(lv_anim_t ** anims, uint32_t cnt);
 static void trans_anim_start_cb(lv_anim_t * a);
 static void trans_anim_completed_cb(lv_anim_t * a);
 static lv_layer_type_t calculate_layer_type(lv_obj_t * obj);
@@ -66,6 +68,7 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
+static bool layer_cache_is_kept(const lv_obj_t * obj, lv_style_prop_t prop);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
 
@@ -280,6 +283,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 
     LV_PROFILER_STYLE_BEGIN;
 
+    bool keep_layer_cache = layer_cache_is_kept(obj, prop);
     lv_obj_invalidate(obj);
 
     lv_part_t part = lv_obj_style_get_selector_part(selector);
@@ -300,7 +304,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     }
     if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
         lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
+        if(parent) lv_obj_mark_layout_as_dirty_from(parent, lv_obj_get_index(obj));
     }
 
     /*Cache the layer type*/
@@ -313,6 +317,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     }
     lv_obj_invalidate(obj);
 
+    if(keep_layer_cache && obj->spec_attr->layer_cache) obj->spec_attr->layer_cache_valid = 1;
+
     if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
         if(part != LV_PART_SCROLLBAR) {
             refresh_children_style(obj);
@@ -364,7 +370,9 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
 
     lv_style_t * style = get_local_style(obj, selector);
     if(selector == LV_PART_MAIN && lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_TRANSFORM)) {
+        bool keep_layer_cache = layer_cache_is_kept(obj, prop);
         lv_obj_invalidate(obj);
+        if(keep_layer_cache) obj->spec_attr->layer_cache_valid = 1;
     }
 
     lv_style_set_prop(style, prop, value);
@@ -465,7 +473,7 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
     lv_anim_t a;
     lv_anim_init(&a);
     lv_anim_set_var(&a, tr);
-    lv_anim_set_exec_cb(&a, trans_anim_cb);
+    lv_anim_set_batch_exec_cb(&a, trans_anim_batch_cb);
     lv_anim_set_start_cb(&a, trans_anim_start_cb);
     lv_anim_set_completed_cb(&a, trans_anim_completed_cb);
     lv_anim_set_values(&a, 0x00, 0xFF);
@@ -633,7 +641,11 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
 void lv_obj_update_layer_type(lv_obj_t * obj)
 {
     lv_layer_type_t layer_type = calculate_layer_type(obj);
-    if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
+    if(obj->spec_attr) {
+        obj->spec_attr->layer_type = layer_type;
+        /*The retained layer is used only if the widget is drawn on a layer*/
+        if(layer_type == LV_LAYER_TYPE_NONE) lv_obj_free_layer_cache(obj);
+    }
     else if(layer_type != LV_LAYER_TYPE_NONE) {
         lv_obj_allocate_spec_attr(obj);
         obj->spec_attr->layer_type = layer_type;
@@ -854,9 +866,14 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
     return removed;
 }
 
-static void trans_anim_cb(void * _tr, int32_t v)
+/**
+ * Set the value of a transition in the transition style
+ * @param tr    pointer to a transition
+ * @param v     the current value of the transition's animation in 0..255 range
+ * @return      true: the value has changed and the object needs to be refreshed
+ */
+static bool trans_apply_value(trans_t * tr, int32_t v)
 {
-    trans_t * tr = _tr;
     lv_obj_t * obj = tr->obj;
 
     uint32_t i;
@@ -911,11 +928,37 @@ static void trans_anim_cb(void * _tr, int32_t v)
             }
         }
         lv_style_set_prop((lv_style_t *)obj->styles[i].style, tr->prop, value_final);
-        if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
-        break;
-
+        return refr;
     }
 
+    return false;
+}
+
+/**
+ * Apply the values of the transitions updated in an animation timer run.
+ * Properties which don't affect the layout, the extra draw size or the layer
+ * need only an invalidation, so it's done once for the consecutive transitions of an object.
+ * @param anims     the animations of the transitions
+ * @param cnt       number of animations in `anims`
+ */
+static void trans_anim_batch_cb(lv_anim_t ** anims, uint32_t cnt)
+{
+    lv_obj_t * invalidated_obj = NULL;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        trans_t * tr = anims[i]->var;
+        if(!trans_apply_value(tr, anims[i]->current_value)) continue;
+
+        if(lv_style_prop_has_flag(tr->prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE |
+                                  LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE | LV_STYLE_PROP_FLAG_LAYER_UPDATE)) {
+            lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
+            invalidated_obj = tr->obj;
+        }
+        else if(tr->obj != invalidated_obj) {
+            if(style_refr) lv_obj_invalidate(tr->obj);
+            invalidated_obj = tr->obj;
+        }
+    }
 }
 
 static void trans_anim_start_cb(lv_anim_t * a)
@@ -1078,6 +1121,22 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag)
     return false;
 }
 
+/**
+ * Check if the retained layer of an object stays valid when a property changes.
+ * The layer properties (transformation, opacity, etc.) change only how the
+ * retained layer is composited but not its content.
+ * @param obj   pointer to an object
+ * @param prop  the changed property
+ * @return      true: the retained layer is valid now and remains valid
+ */
+static bool layer_cache_is_kept(const lv_obj_t * obj, lv_style_prop_t prop)
+{
+    if(obj->spec_attr == NULL || !obj->spec_attr->layer_cache_valid) return false;
+    if(prop == LV_STYLE_PROP_ANY) return false;
+
+    return lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE);
+}
+
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act)
 {
@@ -79,7 +79,8 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
 
 /**
  * Update the layer type of a widget bayed on its current styles.
- * The result will be stored in `obj->spec_attr->layer_type`
+ * The result will be stored in `obj->spec_attr->layer_type`.
+ * The retained layer of the widget is freed if it doesn't need a layer anymore.
  * @param obj       the object whose layer should be updated
  */
 void lv_obj_update_layer_type(lv_obj_t * obj);
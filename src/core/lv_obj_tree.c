@@ -165,11 +165,13 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_t * old_parent = obj->parent;
     /*Remove the object from the old parent's child list*/
+    int32_t old_index = lv_obj_get_index(obj);
     int32_t i;
-    for(i = lv_obj_get_index(obj); i <= (int32_t)lv_obj_get_child_count(old_parent) - 2; i++) {
+    for(i = old_index; i <= (int32_t)lv_obj_get_child_count(old_parent) - 2; i++) {
         old_parent->spec_attr->children[i] = old_parent->spec_attr->children[i + 1];
     }
     old_parent->spec_attr->child_cnt--;
+    lv_obj_mark_layout_as_dirty_from(old_parent, old_index);
     if(old_parent->spec_attr->child_cnt) {
         old_parent->spec_attr->children = lv_realloc(old_parent->spec_attr->children,
                                                      old_parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
@@ -246,6 +248,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    lv_obj_mark_layout_as_dirty_from(parent, LV_MIN(index, old_index));
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -584,6 +587,7 @@ static void obj_delete_core(lv_obj_t * obj)
         obj->parent->spec_attr->child_cnt--;
         obj->parent->spec_attr->children = lv_realloc(obj->parent->spec_attr->children,
                                                       obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        if(!obj->parent->is_deleting) lv_obj_mark_layout_as_dirty_from(obj->parent, id);
     }
 
     /*Free the object itself*/
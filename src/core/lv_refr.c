@@ -22,6 +22,7 @@
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
 #include "../font/lv_font_fmt_txt.h"
+#include "../misc/cache/lv_image_cache.h"
 #include "../stdlib/lv_string.h"
 #include "lv_global.h"
 
@@ -31,6 +32,9 @@
 
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
+#define _occlusion LV_GLOBAL_DEFAULT()->draw_info.occlusion
+#define _layer_memory LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers
+#define _layer_cache_cnt LV_GLOBAL_DEFAULT()->layer_cache_cnt
 
 /**********************
  *      TYPEDEFS
@@ -51,6 +55,15 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    static void occlusion_collect(lv_layer_t * layer, lv_obj_t * top_obj);
+    static void occlusion_collect_obj(lv_obj_t * obj, const lv_area_t * clip_area);
+    static bool occlusion_get_cover_area(lv_obj_t * obj, const lv_area_t * clip_area, lv_area_t * area_out);
+    static void occlusion_add(const lv_obj_t * obj, const lv_area_t * area);
+    static void occlusion_remove_obj(const lv_obj_t * obj, bool with_children);
+    static bool occlusion_cull_obj(lv_layer_t * layer, lv_obj_t * obj);
+    static bool occlusion_layer_is_culled(const lv_layer_t * layer);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -100,6 +113,12 @@ void lv_refr_now(lv_display_t * disp)
 void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
 {
     LV_PROFILER_REFR_BEGIN;
+
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    /*The Widget is drawn from now on, so it can't cover the upcoming draw tasks*/
+    if(_occlusion.cnt > 0 && _occlusion.layer == layer) occlusion_remove_obj(obj, false);
+#endif
+
     lv_area_t clip_area_ori = layer->_clip_area;
     lv_area_t clip_coords_for_obj;
 
@@ -332,6 +351,23 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+bool lv_refr_area_is_occluded(const lv_layer_t * layer, const lv_area_t * area)
+{
+    if(_occlusion.cnt == 0 || !occlusion_layer_is_culled(layer)) return false;
+
+    uint32_t i;
+    for(i = 0; i < _occlusion.cnt; i++) {
+        if(lv_area_is_in(area, &_occlusion.areas[i], 0)) {
+            _occlusion.culled_cnt++;
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -428,6 +464,9 @@ refr_finish:
     lv_draw_sw_mask_cleanup();
 #endif
 
+    /*Release the layer buffers which were not needed recently*/
+    lv_draw_layer_pool_trim(false);
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -580,6 +619,10 @@ static void refr_invalid_areas(void)
     disp_refr->last_part = 0;
     disp_refr->rendering_in_progress = true;
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    _occlusion.culled_cnt = 0;
+#endif
+
     for(i = 0; i < (int32_t)disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
@@ -629,6 +672,10 @@ static void refr_invalid_areas(void)
         }
     }
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    LV_PROFILER_REFR_COUNTER("occlusion_culled", (int32_t)_occlusion.culled_cnt);
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_REFR_END;
@@ -706,7 +753,7 @@ static void refr_area(const lv_area_t * area_p)
         /* Don't draw to the layers buffer of the display but create smaller dummy layers which are using the
          * display's layer buffer. These will be the tiles. By using tiles it's more likely that there will
          * be independent areas for each draw unit. */
-        lv_layer_t * tile_layers = lv_malloc(tile_cnt * sizeof(lv_layer_t));
+        lv_layer_t * tile_layers = lv_draw_frame_malloc(tile_cnt * sizeof(lv_layer_t));
         LV_ASSERT_MALLOC(tile_layers);
         if(tile_layers == NULL) {
             disp_refr->refreshed_area = *area_p;
@@ -750,7 +797,7 @@ static void refr_area(const lv_area_t * area_p)
 
             if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, tile_layer);
         }
-        lv_free(tile_layers);
+        lv_draw_frame_free(tile_layers);
     }
 
     disp_refr->refreshed_area = *area_p;
@@ -787,28 +834,39 @@ static void refr_configured_layer(lv_layer_t * layer)
     }
 
     /*Draw a bottom layer background if there is no top object*/
-    if(top_act_scr == NULL && top_prev_scr == NULL) {
+    bool draw_bottom = top_act_scr == NULL && top_prev_scr == NULL;
+    if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
+    if(disp_refr->prev_scr && top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
+
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    /*Collect the opaque areas of all the Widgets which will be drawn*/
+    _occlusion.layer = layer;
+    _occlusion.cnt = 0;
+    if(draw_bottom) occlusion_collect(layer, lv_display_get_layer_bottom(disp_refr));
+    occlusion_collect(layer, top_act_scr);
+    if(top_prev_scr) occlusion_collect(layer, top_prev_scr);
+    occlusion_collect(layer, lv_display_get_layer_top(disp_refr));
+    occlusion_collect(layer, lv_display_get_layer_sys(disp_refr));
+#endif
+
+    if(draw_bottom) {
         refr_obj_and_children(layer, lv_display_get_layer_bottom(disp_refr));
     }
 
     if(disp_refr->draw_prev_over_act) {
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
         refr_obj_and_children(layer, top_act_scr);
 
         /*Refresh the previous screen if any*/
-        if(disp_refr->prev_scr) {
-            if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
+        if(top_prev_scr) {
             refr_obj_and_children(layer, top_prev_scr);
         }
     }
     else {
         /*Refresh the previous screen if any*/
-        if(disp_refr->prev_scr) {
-            if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
+        if(top_prev_scr) {
             refr_obj_and_children(layer, top_prev_scr);
         }
 
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
         refr_obj_and_children(layer, top_act_scr);
     }
 
@@ -816,6 +874,11 @@ static void refr_configured_layer(lv_layer_t * layer)
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    _occlusion.layer = NULL;
+    _occlusion.cnt = 0;
+#endif
+
     LV_PROFILER_REFR_END;
 }
 
@@ -1096,6 +1159,137 @@ static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj)
 
 #endif /* LV_DRAW_TRANSFORM_USE_MATRIX */
 
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * layer_draw_dsc, lv_opa_t opa,
+                                const lv_area_t * layer_area, const lv_area_t * obj_draw_size)
+{
+    lv_point_t pivot = {
+        .x = lv_obj_get_style_transform_pivot_x(obj, 0),
+        .y = lv_obj_get_style_transform_pivot_y(obj, 0)
+    };
+
+    if(LV_COORD_IS_PCT(pivot.x)) {
+        pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
+    }
+    if(LV_COORD_IS_PCT(pivot.y)) {
+        pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
+    }
+
+    lv_draw_image_dsc_init(layer_draw_dsc);
+    layer_draw_dsc->pivot.x = obj->coords.x1 + pivot.x - layer_area->x1;
+    layer_draw_dsc->pivot.y = obj->coords.y1 + pivot.y - layer_area->y1;
+
+    layer_draw_dsc->opa = opa;
+    layer_draw_dsc->rotation = lv_obj_get_style_transform_rotation(obj, 0);
+    while(layer_draw_dsc->rotation > 3600) layer_draw_dsc->rotation -= 3600;
+    while(layer_draw_dsc->rotation < 0) layer_draw_dsc->rotation += 3600;
+    layer_draw_dsc->scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
+    layer_draw_dsc->scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
+    layer_draw_dsc->skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
+    layer_draw_dsc->skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
+    layer_draw_dsc->blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    layer_draw_dsc->antialias = disp_refr->antialiasing;
+    layer_draw_dsc->bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
+    layer_draw_dsc->image_area = *obj_draw_size;
+}
+
+/**
+ * Render the whole object into its retained layer if it's outdated
+ * and composite the retained layer with the current transformation and opacity.
+ * @param layer     the layer to draw to
+ * @param obj       the object with `LV_OBJ_FLAG_CACHE_LAYER`
+ * @param opa       the layer opacity of the object
+ * @return          LV_RESULT_INVALID if the retained layer couldn't be allocated
+ */
+static lv_result_t refr_obj_layer_cache(lv_layer_t * layer, lv_obj_t * obj, lv_opa_t opa)
+{
+    /*The layer type is stored in the spec. attributes, so it surely exists*/
+    lv_obj_spec_attr_t * spec_attr = obj->spec_attr;
+
+    lv_area_t obj_draw_size;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_draw_size);
+    lv_area_increase(&obj_draw_size, ext_draw_size, ext_draw_size);
+
+    /*Nothing to do if the transformed object is out of the clip area*/
+    lv_area_t tranf_coords = obj_draw_size;
+    lv_obj_get_transformed_area(obj, &tranf_coords, LV_OBJ_POINT_TRANSFORM_FLAG_NONE);
+    if(!lv_area_is_on(&tranf_coords, &layer->_clip_area)) return LV_RESULT_OK;
+
+    /*The retained layer is stored relative to the object,
+     *so it can be reused even if the object was moved (e.g. scrolled)*/
+    int32_t w = lv_area_get_width(&obj_draw_size);
+    int32_t h = lv_area_get_height(&obj_draw_size);
+    bool need_alpha = lv_obj_get_style_bitmap_mask_src(obj, 0) || alpha_test_area_on_obj(obj, &obj_draw_size);
+    lv_color_format_t cf = need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+
+    lv_draw_buf_t * cache = spec_attr->layer_cache;
+    if(cache && (cache->header.w != w || cache->header.h != h || cache->header.cf != cf)) {
+        lv_obj_free_layer_cache(obj);
+        cache = NULL;
+    }
+
+    if(cache == NULL) {
+        /*The retained layers are kept between the refreshes so they count as layer memory too*/
+        uint32_t cache_size = h * lv_draw_buf_width_to_stride(w, cf);
+#if LV_DRAW_LAYER_MAX_MEMORY > 0
+        if(_layer_memory + cache_size > LV_DRAW_LAYER_MAX_MEMORY) {
+            LV_LOG_WARN("LV_DRAW_LAYER_MAX_MEMORY was reached, rendering a temporary layer instead");
+            return LV_RESULT_INVALID;
+        }
+#endif
+        cache = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+        if(cache == NULL) {
+            LV_LOG_WARN("Couldn't allocate the retained layer, rendering a temporary layer instead");
+            return LV_RESULT_INVALID;
+        }
+        _layer_memory += cache_size;
+        _layer_cache_cnt++;
+        spec_attr->layer_cache = cache;
+        spec_attr->layer_cache_valid = 0;
+    }
+
+    if(!spec_attr->layer_cache_valid) {
+        LV_PROFILER_REFR_BEGIN_TAG("layer_cache_render");
+        /*The image cache might have data about the old content*/
+        lv_image_cache_drop(cache);
+        lv_draw_buf_clear(cache, NULL);
+
+        lv_layer_t cache_layer;
+        lv_memzero(&cache_layer, sizeof(cache_layer));
+        cache_layer.draw_buf = cache;
+        cache_layer.buf_area = obj_draw_size;
+        cache_layer.color_format = cf;
+        cache_layer._clip_area = obj_draw_size;
+        cache_layer.phy_clip_area = obj_draw_size;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        lv_matrix_identity(&cache_layer.matrix);
+#endif
+        if(disp_refr->layer_init) disp_refr->layer_init(disp_refr, &cache_layer);
+
+        /*Render it in one go, independently from the layers of the display*/
+        lv_layer_t * layer_head_old = disp_refr->layer_head;
+        disp_refr->layer_head = &cache_layer;
+
+        lv_obj_redraw(&cache_layer, obj);
+        while(cache_layer.draw_task_head) {
+            lv_draw_dispatch_wait_for_request();
+            lv_draw_dispatch();
+        }
+
+        disp_refr->layer_head = layer_head_old;
+        if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, &cache_layer);
+        spec_attr->layer_cache_valid = 1;
+        LV_PROFILER_REFR_END_TAG("layer_cache_render");
+    }
+
+    lv_draw_image_dsc_t layer_draw_dsc;
+    layer_draw_dsc_init(obj, &layer_draw_dsc, opa, &obj_draw_size, &obj_draw_size);
+    layer_draw_dsc.src = cache;
+    lv_draw_image(layer, &layer_draw_dsc, &obj_draw_size);
+
+    return LV_RESULT_OK;
+}
+
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
@@ -1103,6 +1297,10 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     lv_opa_t opa = lv_obj_get_style_opa_layered(obj, 0);
     if(opa < LV_OPA_MIN) return;
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    if(occlusion_cull_obj(layer, obj)) return;
+#endif
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /*If the layer opa is full then use the matrix transform*/
     if(opa >= LV_OPA_MAX && !refr_check_obj_clip_overflow(layer, obj)) {
@@ -1116,6 +1314,10 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
         lv_obj_redraw(layer, obj);
     }
     else {
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_LAYER) && refr_obj_layer_cache(layer, obj, opa) == LV_RESULT_OK) {
+            return;
+        }
+
         lv_area_t layer_area_full;
         lv_area_t obj_draw_size;
         lv_result_t res = layer_get_area(layer, obj, layer_type, &layer_area_full, &obj_draw_size);
@@ -1155,35 +1357,8 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
                                                           area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
-            lv_point_t pivot = {
-                .x = lv_obj_get_style_transform_pivot_x(obj, 0),
-                .y = lv_obj_get_style_transform_pivot_y(obj, 0)
-            };
-
-            if(LV_COORD_IS_PCT(pivot.x)) {
-                pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
-            }
-            if(LV_COORD_IS_PCT(pivot.y)) {
-                pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
-            }
-
             lv_draw_image_dsc_t layer_draw_dsc;
-            lv_draw_image_dsc_init(&layer_draw_dsc);
-            layer_draw_dsc.pivot.x = obj->coords.x1 + pivot.x - new_layer->buf_area.x1;
-            layer_draw_dsc.pivot.y = obj->coords.y1 + pivot.y - new_layer->buf_area.y1;
-
-            layer_draw_dsc.opa = opa;
-            layer_draw_dsc.rotation = lv_obj_get_style_transform_rotation(obj, 0);
-            while(layer_draw_dsc.rotation > 3600) layer_draw_dsc.rotation -= 3600;
-            while(layer_draw_dsc.rotation < 0) layer_draw_dsc.rotation += 3600;
-            layer_draw_dsc.scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
-            layer_draw_dsc.scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
-            layer_draw_dsc.skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
-            layer_draw_dsc.skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
-            layer_draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
-            layer_draw_dsc.antialias = disp_refr->antialiasing;
-            layer_draw_dsc.bitmap_mask_src = bitmap_mask_src;
-            layer_draw_dsc.image_area = obj_draw_size;
+            layer_draw_dsc_init(obj, &layer_draw_dsc, opa, &new_layer->buf_area, &obj_draw_size);
             layer_draw_dsc.src = new_layer;
 
             lv_draw_layer(layer, &layer_draw_dsc, &layer_area_act);
@@ -1251,6 +1426,12 @@ static void draw_buf_flush(lv_display_t * disp)
         lv_draw_dispatch();
     }
 
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    /*All the draw tasks of the area are finished so their memory can be reused for the next area.
+     *This way in partial mode the arena needs to hold the tasks of only one buffer.*/
+    lv_arena_reset(&disp->frame_arena);
+#endif
+
     /* In double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer.
      * If we need to wait here it means that the content of one buffer is being sent to display
@@ -1329,3 +1510,220 @@ static void wait_for_flushing(lv_display_t * disp)
     LV_LOG_TRACE("end");
     LV_PROFILER_REFR_END;
 }
+
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+
+/**
+ * Collect the opaque areas from a Widget and its 'younger' siblings, the same way
+ * as `refr_obj_and_children` draws them
+ * @param layer     the layer to draw
+ * @param top_obj   the Widget to start from
+ */
+static void occlusion_collect(lv_layer_t * layer, lv_obj_t * top_obj)
+{
+    if(top_obj == NULL) top_obj = lv_display_get_screen_active(disp_refr);
+    if(top_obj == NULL) return;
+
+    occlusion_collect_obj(top_obj, &layer->_clip_area);
+
+    lv_obj_t * border_p = top_obj;
+    lv_obj_t * parent = lv_obj_get_parent(top_obj);
+    while(parent != NULL) {
+        bool go = false;
+        uint32_t i;
+        uint32_t child_cnt = lv_obj_get_child_count(parent);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = parent->spec_attr->children[i];
+            if(!go) {
+                if(child == border_p) go = true;
+            }
+            else {
+                occlusion_collect_obj(child, &layer->_clip_area);
+            }
+        }
+
+        border_p = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+}
+
+static void occlusion_collect_obj(lv_obj_t * obj, const lv_area_t * clip_area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /*Layered Widgets and their children are not drawn directly to this layer*/
+    if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return;
+
+    lv_area_t cover_area;
+    if(occlusion_get_cover_area(obj, clip_area, &cover_area)) {
+        occlusion_add(obj, &cover_area);
+    }
+
+    /*The children of Widgets with clipped corners are partially drawn to layers*/
+    if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN) && lv_obj_get_style_radius(obj, LV_PART_MAIN) != 0) return;
+
+    /*Use the same clip area as `lv_obj_redraw` for the children*/
+    lv_area_t obj_area = obj->coords;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+    }
+
+    lv_area_t clip_coords_for_children;
+    if(!lv_area_intersect(&clip_coords_for_children, clip_area, &obj_area)) return;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        occlusion_collect_obj(obj->spec_attr->children[i], &clip_coords_for_children);
+    }
+}
+
+/**
+ * Get the largest rectangle which is fully covered by a Widget
+ * @param obj           pointer to a Widget
+ * @param clip_area     the Widget is drawn only here
+ * @param area_out      store the covered area here
+ * @return              true: `area_out` is fully covered; false: no area can be used
+ */
+static bool occlusion_get_cover_area(lv_obj_t * obj, const lv_area_t * clip_area, lv_area_t * area_out)
+{
+    /*Leave out the rounded corners along the longer side*/
+    int32_t w = lv_area_get_width(&obj->coords);
+    int32_t h = lv_area_get_height(&obj->coords);
+    int32_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    r = LV_MIN(r, LV_MIN(w, h) >> 1);
+
+    *area_out = obj->coords;
+    if(w > h) lv_area_increase(area_out, -r, 0);
+    else lv_area_increase(area_out, 0, -r);
+
+    if(!lv_area_intersect(area_out, area_out, clip_area)) return false;
+
+    /*Don't bother with the event if the area wouldn't be stored anyway*/
+    if(_occlusion.cnt == LV_DRAW_OCCLUSION_MAX_AREAS) {
+        uint32_t size = lv_area_get_size(area_out);
+        uint32_t i;
+        for(i = 0; i < _occlusion.cnt; i++) {
+            if(lv_area_get_size(&_occlusion.areas[i]) < size) break;
+        }
+        if(i == _occlusion.cnt) return false;
+    }
+
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = area_out;
+    lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+    return info.res == LV_COVER_RES_COVER;
+}
+
+/**
+ * Store an opaque area. If there is no more space replace the smallest one.
+ * @param obj       the Widget covering the area
+ * @param area      the covered area
+ */
+static void occlusion_add(const lv_obj_t * obj, const lv_area_t * area)
+{
+    uint32_t idx;
+    if(_occlusion.cnt < LV_DRAW_OCCLUSION_MAX_AREAS) {
+        idx = _occlusion.cnt;
+        _occlusion.cnt++;
+    }
+    else {
+        uint32_t min_size = UINT32_MAX;
+        uint32_t i;
+        idx = 0;
+        for(i = 0; i < _occlusion.cnt; i++) {
+            uint32_t size = lv_area_get_size(&_occlusion.areas[i]);
+            if(size < min_size) {
+                min_size = size;
+                idx = i;
+            }
+        }
+
+        if(lv_area_get_size(area) <= min_size) return;
+    }
+
+    _occlusion.areas[idx] = *area;
+    _occlusion.objs[idx] = obj;
+}
+
+/**
+ * Remove the areas covered by a Widget
+ * @param obj               pointer to a Widget
+ * @param with_children     true: also remove the areas of the Widget's children
+ */
+static void occlusion_remove_obj(const lv_obj_t * obj, bool with_children)
+{
+    uint32_t i = 0;
+    while(i < _occlusion.cnt) {
+        const lv_obj_t * occluder = _occlusion.objs[i];
+        if(with_children) {
+            while(occluder && occluder != obj) occluder = lv_obj_get_parent(occluder);
+        }
+
+        if(occluder == obj) {
+            _occlusion.cnt--;
+            _occlusion.areas[i] = _occlusion.areas[_occlusion.cnt];
+            _occlusion.objs[i] = _occlusion.objs[_occlusion.cnt];
+        }
+        else {
+            i++;
+        }
+    }
+}
+
+/**
+ * Check if a Widget with all its children will be fully covered by a Widget drawn later
+ * @param layer     the layer to draw
+ * @param obj       pointer to a Widget
+ * @return          true: nothing needs to be drawn from the Widget
+ */
+static bool occlusion_cull_obj(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(_occlusion.cnt == 0 || !occlusion_layer_is_culled(layer)) return false;
+
+    /*The drawn area is not known exactly in these cases*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+    if(lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) return false;
+
+    lv_area_t obj_area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_area);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+    if(!lv_area_intersect(&obj_area, &obj_area, &layer->_clip_area)) return false;
+
+    uint32_t i;
+    for(i = 0; i < _occlusion.cnt; i++) {
+        if(!lv_area_is_in(&obj_area, &_occlusion.areas[i], 0)) continue;
+
+        /*A Widget can't cover itself*/
+        const lv_obj_t * occluder = _occlusion.objs[i];
+        while(occluder && occluder != obj) occluder = lv_obj_get_parent(occluder);
+        if(occluder == obj) continue;
+
+        /*The children won't be drawn either so they can't cover anything*/
+        occlusion_remove_obj(obj, true);
+        _occlusion.culled_cnt++;
+        return true;
+    }
+
+    return false;
+}
+
+static bool occlusion_layer_is_culled(const lv_layer_t * layer)
+{
+    if(_occlusion.layer != layer) return false;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    /*The collected areas are not transformed*/
+    const lv_matrix_t * m = &layer->matrix;
+    if(!lv_matrix_is_identity_or_translation(m) || m->m[0][2] != 0.0f || m->m[1][2] != 0.0f) return false;
+#endif
+
+    return true;
+}
+
+#endif /*LV_DRAW_OCCLUSION_MAX_AREAS > 0*/
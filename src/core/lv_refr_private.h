@@ -46,6 +46,17 @@ void lv_refr_deinit(void);
  */
 void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p);
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+/**
+ * Check if an area will be fully covered by an opaque Widget which is not drawn yet.
+ * If so, count it as culled.
+ * @param layer     the layer where the area is drawn
+ * @param area      the area to check
+ * @return          true: drawing to `area` can be skipped
+ */
+bool lv_refr_area_is_occluded(const lv_layer_t * layer, const lv_area_t * area);
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -95,6 +95,10 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->layer_head->buf_area.y2 = ver_res - 1;
     disp->layer_head->color_format = disp->color_format;
 
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    lv_arena_init(&disp->frame_arena, LV_DRAW_FRAME_ARENA_SIZE);
+#endif
+
     disp->inv_en_cnt = 1;
     disp->last_activity_time = lv_tick_get();
 
@@ -211,6 +215,10 @@ void lv_display_delete(lv_display_t * disp)
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
     lv_free(disp->layer_head);
 
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    lv_arena_deinit(&disp->frame_arena);
+#endif
+
     lv_free(disp);
 
     if(was_default) lv_display_set_default(lv_ll_get_head(disp_ll_p));
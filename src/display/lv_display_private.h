@@ -17,6 +17,7 @@ extern "C" {
 #include "../core/lv_obj.h"
 #include "../draw/lv_draw.h"
 #include "lv_display.h"
+#include "../stdlib/lv_arena.h"
 
 #if LV_USE_SYSMON
 #include "../others/sysmon/lv_sysmon_private.h"
@@ -117,6 +118,11 @@ struct _lv_display_t {
     void (*layer_init)(lv_display_t * disp, lv_layer_t * layer);
     void (*layer_deinit)(lv_display_t * disp, lv_layer_t * layer);
 
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    /** Draw tasks, their descriptors and layers created while rendering. Reset after each rendered area.*/
+    lv_arena_t frame_arena;
+#endif
+
     /*---------------------
      * Screens
      *--------------------*/
@@ -23,16 +23,30 @@
  *      DEFINES
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+#define _layer_pool LV_GLOBAL_DEFAULT()->draw_info.layer_pool
+
+/*Free the pooled layer buffers which were not reused for this long [ms]*/
+#define LAYER_POOL_MAX_IDLE_TIME    1000
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    lv_draw_buf_t * draw_buf;
+    uint32_t last_used; /*Tick when the buffer was put into the pool*/
+} layer_pool_entry_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
 static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    static lv_draw_buf_t * layer_pool_get(uint32_t w, uint32_t h, lv_color_format_t cf);
+    static void layer_pool_put(lv_draw_buf_t * draw_buf);
+    static void layer_pool_trim_core(bool free_all);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -56,6 +70,11 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    lv_ll_init(&_layer_pool.buf_ll, sizeof(layer_pool_entry_t));
+    lv_mutex_init(&_layer_pool.mutex);
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -64,6 +83,11 @@ void lv_draw_deinit(void)
     lv_thread_sync_delete(&_draw_info.sync);
 #endif
 
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    lv_draw_layer_pool_trim(true);
+    lv_mutex_delete(&_layer_pool.mutex);
+#endif
+
     lv_draw_unit_t * u = _draw_info.unit_head;
     while(u) {
         lv_draw_unit_t * cur_unit = u;
@@ -89,8 +113,9 @@ void * lv_draw_create_unit(size_t size)
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = lv_draw_frame_malloc(sizeof(lv_draw_task_t));
     LV_ASSERT_MALLOC(new_task);
+    lv_memzero(new_task, sizeof(lv_draw_task_t));
     new_task->area = *coords;
     new_task->_real_area = *coords;
     new_task->clip_area = layer->_clip_area;
@@ -114,6 +139,33 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
     return new_task;
 }
 
+void * lv_draw_frame_malloc(size_t size)
+{
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    /*Only the draw tasks of the rendered display are surely finished when the arena is reset*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp && disp->rendering_in_progress) {
+        void * p = lv_arena_alloc(&disp->frame_arena, size);
+        if(p) return p;
+    }
+#endif
+
+    return lv_malloc(size);
+}
+
+void lv_draw_frame_free(void * p)
+{
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp) {
+        lv_arena_free(&disp->frame_arena, p);
+        return;
+    }
+#endif
+
+    lv_free(p);
+}
+
 void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -122,6 +174,20 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 
     lv_draw_global_info_t * info = &_draw_info;
 
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    /*Skip the task if an opaque Widget drawn later will cover it anyway.
+     *Layers are always blended as their buffers are released by the task.*/
+    if(t->type != LV_DRAW_TASK_TYPE_LAYER) {
+        lv_area_t draw_area;
+        if(lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area) &&
+           lv_refr_area_is_occluded(layer, &draw_area)) {
+            t->state = LV_DRAW_TASK_STATE_READY;
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+    }
+#endif
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -388,7 +454,8 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
 lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_layer_t * new_layer = lv_malloc_zeroed(sizeof(lv_layer_t));
+    /*Zeroed by lv_draw_layer_init*/
+    lv_layer_t * new_layer = lv_draw_frame_malloc(sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(new_layer);
     if(new_layer == NULL) {
         LV_PROFILER_DRAW_END;
@@ -457,7 +524,11 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     }
 #endif
 
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    layer->draw_buf = layer_pool_get(w, h, layer->color_format);
+#else
     layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+#endif
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -476,6 +547,17 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     return layer->draw_buf->data;
 }
 
+void lv_draw_layer_pool_trim(bool free_all)
+{
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    lv_mutex_lock(&_layer_pool.mutex);
+    layer_pool_trim_core(free_all);
+    lv_mutex_unlock(&_layer_pool.mutex);
+#else
+    LV_UNUSED(free_all);
+#endif
+}
+
 void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
 {
     return lv_draw_buf_goto_xy(layer->draw_buf, x, y);
@@ -552,7 +634,11 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 LV_LOG_WARN("More layers were freed than allocated");
             }
             LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB", get_layer_size_kb(_draw_info.used_memory_for_layers));
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+            layer_pool_put(layer_drawn->draw_buf);
+#else
             lv_draw_buf_destroy(layer_drawn->draw_buf);
+#endif
             layer_drawn->draw_buf = NULL;
         }
 
@@ -572,16 +658,132 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 disp->layer_deinit(disp, layer_drawn);
                 LV_PROFILER_DRAW_END_TAG("layer_deinit");
             }
-            lv_free(layer_drawn);
+            lv_draw_frame_free(layer_drawn);
         }
     }
     lv_draw_label_dsc_t * draw_label_dsc = lv_draw_task_get_label_dsc(t);
     if(draw_label_dsc && draw_label_dsc->text_local) {
+        /*It's on the heap as `LV_EVENT_DRAW_TASK_ADDED` handlers might replace it*/
         lv_free((void *)draw_label_dsc->text);
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t->draw_dsc);
-    lv_free(t);
+    lv_draw_frame_free(t->draw_dsc);
+    lv_draw_frame_free(t);
     LV_PROFILER_DRAW_END;
 }
+
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+
+/**
+ * Round up a buffer size so that layers with slightly different sizes can share the buffer
+ * @param size      the required size in bytes
+ * @return          the size of the bucket of `size`
+ */
+static uint32_t layer_pool_bucket_size(uint32_t size)
+{
+    /*Use 4 buckets between each power of 2*/
+    uint32_t step = 1;
+    while(step <= size / 2) step *= 2;
+    step = LV_MAX(step / 4, LV_DRAW_BUF_ALIGN);
+
+    return (size + step - 1) / step * step;
+}
+
+/**
+ * Get a buffer from the pool or allocate a new one
+ * @param w         width of the layer
+ * @param h         height of the layer
+ * @param cf        color format of the layer
+ * @return          a draw buffer with the given shape or NULL on failure
+ */
+static lv_draw_buf_t * layer_pool_get(uint32_t w, uint32_t h, lv_color_format_t cf)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t size = h * stride;
+
+    lv_mutex_lock(&_layer_pool.mutex);
+
+    /*Find the most recently used buffer which is large enough but not wasting too much memory*/
+    layer_pool_entry_t * entry;
+    LV_LL_READ(&_layer_pool.buf_ll, entry) {
+        lv_draw_buf_t * draw_buf = entry->draw_buf;
+        if(draw_buf->header.cf != cf || draw_buf->data_size > size * 2) continue;
+        if(lv_draw_buf_reshape(draw_buf, cf, w, h, stride) == NULL) continue;
+
+        _layer_pool.size -= draw_buf->data_size;
+        _layer_pool.hit_cnt++;
+        lv_ll_remove(&_layer_pool.buf_ll, entry);
+        lv_free(entry);
+        lv_mutex_unlock(&_layer_pool.mutex);
+        return draw_buf;
+    }
+
+    _layer_pool.miss_cnt++;
+    lv_mutex_unlock(&_layer_pool.mutex);
+
+    /*Allocate a bucket sized buffer to make it reusable for similar sized layers later*/
+    uint32_t h_alloc = (layer_pool_bucket_size(size) + stride - 1) / stride;
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(w, h_alloc, cf, stride);
+    if(draw_buf == NULL) {
+        /*Try without the extra space*/
+        draw_buf = lv_draw_buf_create(w, h, cf, stride);
+    }
+
+    return lv_draw_buf_reshape(draw_buf, cf, w, h, stride);
+}
+
+/**
+ * Put a buffer of a finished layer into the pool or free it if doesn't fit
+ * @param draw_buf  the buffer of the layer
+ */
+static void layer_pool_put(lv_draw_buf_t * draw_buf)
+{
+    if(draw_buf->data_size > LV_DRAW_LAYER_POOL_SIZE) {
+        lv_draw_buf_destroy(draw_buf);
+        return;
+    }
+
+    lv_mutex_lock(&_layer_pool.mutex);
+
+    layer_pool_entry_t * entry = lv_ll_ins_head(&_layer_pool.buf_ll);
+    if(entry == NULL) {
+        lv_mutex_unlock(&_layer_pool.mutex);
+        lv_draw_buf_destroy(draw_buf);
+        return;
+    }
+
+    entry->draw_buf = draw_buf;
+    entry->last_used = lv_tick_get();
+    _layer_pool.size += draw_buf->data_size;
+
+    /*Drop the least recently used buffers if the pool became too large*/
+    layer_pool_trim_core(false);
+
+    lv_mutex_unlock(&_layer_pool.mutex);
+}
+
+/**
+ * Free the least recently used buffers while the pool is too large or they are idle for too long.
+ * The pool's mutex needs to be locked.
+ * @param free_all  true: free all buffers
+ */
+static void layer_pool_trim_core(bool free_all)
+{
+    layer_pool_entry_t * entry = lv_ll_get_tail(&_layer_pool.buf_ll);
+    while(entry) {
+        if(!free_all && _layer_pool.size <= LV_DRAW_LAYER_POOL_SIZE &&
+           lv_tick_elaps(entry->last_used) < LAYER_POOL_MAX_IDLE_TIME) {
+            break;
+        }
+
+        layer_pool_entry_t * entry_prev = lv_ll_get_prev(&_layer_pool.buf_ll, entry);
+        _layer_pool.size -= entry->draw_buf->data_size;
+        lv_draw_buf_destroy(entry->draw_buf);
+        lv_ll_remove(&_layer_pool.buf_ll, entry);
+        lv_free(entry);
+        entry = entry_prev;
+    }
+}
+
+#endif /*LV_DRAW_LAYER_POOL_SIZE > 0*/
@@ -146,6 +146,23 @@ void * lv_draw_create_unit(size_t size);
  */
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords);
 
+/**
+ * Allocate memory which is needed only until the end of the current refresh,
+ * e.g. the draw descriptor of a draw task.
+ * While a display is being rendered and `LV_DRAW_FRAME_ARENA_SIZE > 0` the memory is taken
+ * from the display's frame arena, else it's allocated by `lv_malloc()`.
+ * @param size      the size to allocate in bytes
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * lv_draw_frame_malloc(size_t size);
+
+/**
+ * Free a memory allocated by `lv_draw_frame_malloc()` or `lv_malloc()`.
+ * Memory of the frame arena is released only when the rendered area is finished.
+ * @param p         pointer to the memory to free
+ */
+void lv_draw_frame_free(void * p);
+
 /**
  * Needs to be called when a draw task is created and configured.
  * It will send an event about the new draw task to the widget
@@ -237,6 +254,13 @@ void lv_draw_layer_init(lv_layer_t * layer, lv_layer_t * parent_layer, lv_color_
  */
 void * lv_draw_layer_alloc_buf(lv_layer_t * layer);
 
+/**
+ * Free the unused layer buffers kept in the layer buffer pool (see `LV_DRAW_LAYER_POOL_SIZE`).
+ * @param free_all          true: free all unused buffers;
+ *                          false: free only the buffers which were not reused for a while
+ */
+void lv_draw_layer_pool_trim(bool free_all);
+
 /**
  * Got to a pixel at X and Y coordinate on a layer
  * @param layer             pointer to a layer
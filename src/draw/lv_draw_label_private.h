@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Update the "hint" if the label's y coordinates have changed more then this*/
+#define LV_LABEL_HINT_UPDATE_TH 1024
+
 /**********************
  *      TYPEDEFS
  **********************/
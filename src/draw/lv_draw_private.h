@@ -21,6 +21,7 @@ extern "C" {
 #include "lv_draw.h"
 #include "../osal/lv_os.h"
 #include "../misc/cache/lv_cache.h"
+#include "../misc/lv_ll.h"
 
 /*********************
  *      DEFINES
@@ -186,6 +187,25 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    struct {
+        lv_ll_t buf_ll;         /**< Unused layer buffers, the most recently used first*/
+        uint32_t size;          /**< Memory held by the unused buffers [bytes]*/
+        uint32_t hit_cnt;       /**< Number of layers which got a buffer from the pool*/
+        uint32_t miss_cnt;      /**< Number of layers which needed a new buffer*/
+        lv_mutex_t mutex;
+    } layer_pool;
+#endif
+
+#if LV_DRAW_OCCLUSION_MAX_AREAS > 0
+    struct {
+        lv_layer_t * layer;                                 /**< Cull only on this layer, NULL if disabled*/
+        lv_area_t areas[LV_DRAW_OCCLUSION_MAX_AREAS];       /**< Opaque areas of the Widgets not drawn yet*/
+        const lv_obj_t * objs[LV_DRAW_OCCLUSION_MAX_AREAS]; /**< The Widgets covering `areas`*/
+        uint32_t cnt;                                       /**< Number of valid `areas`*/
+        uint32_t culled_cnt;                                /**< Number of skipped Widgets and draw tasks*/
+    } occlusion;
+#endif
 } lv_draw_global_info_t;
 
 /**********************
@@ -12,6 +12,7 @@
 #include "../misc/lv_ll.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../misc/cache/lv_image_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -218,6 +219,7 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data)
 {
+    search_key->src_hash = lv_image_cache_get_src_hash(search_key->src, search_key->src_type);
     lv_cache_entry_t * cache_entry = lv_cache_add(img_cache_p, search_key, NULL);
     if(cache_entry == NULL) {
         return NULL;
@@ -312,6 +314,7 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
         lv_image_header_cache_data_t search_key;
         search_key.src_type = src_type;
         search_key.src = src;
+        search_key.src_hash = lv_image_cache_get_src_hash(src, src_type);
 
         lv_cache_entry_t * entry = lv_cache_acquire(img_header_cache_p, &search_key, NULL);
 
@@ -368,6 +371,7 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
         lv_image_header_cache_data_t search_key;
         search_key.src_type = src_type;
         search_key.src = lv_strdup(src);
+        search_key.src_hash = lv_image_cache_get_src_hash(src, src_type);
         search_key.decoder = decoder;
         search_key.header = *header;
         entry = lv_cache_add(img_header_cache_p, &search_key, NULL);
@@ -400,6 +404,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.src_hash = lv_image_cache_get_src_hash(dsc->src, dsc->src_type);
 
     lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
 
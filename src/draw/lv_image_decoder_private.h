@@ -57,6 +57,8 @@ struct _lv_image_cache_data_t {
 
     const void * src;
     lv_image_src_t src_type;
+    uint64_t src_hash;      /**< Hash of the source to speed up the lookup, see `lv_image_cache_get_src_hash()`.
+                             *   It's set by `lv_image_decoder_add_to_cache()` */
 
     const lv_draw_buf_t * decoded;
     const lv_image_decoder_t * decoder;
@@ -66,6 +68,7 @@ struct _lv_image_cache_data_t {
 struct _lv_image_header_cache_data_t {
     const void * src;
     lv_image_src_t src_type;
+    uint64_t src_hash;      /**< Hash of the source to speed up the lookup, see `lv_image_cache_get_src_hash()` */
 
     lv_image_header_t header;
     lv_image_decoder_t * decoder;
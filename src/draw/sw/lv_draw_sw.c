@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_sw_private.h"
+#include "lv_draw_sw_gradient_private.h"
 #include "../lv_draw_private.h"
 #if LV_USE_DRAW_SW
 
@@ -73,8 +74,11 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+    lv_draw_sw_box_shadow_cache_init();
 #endif
 
+    lv_gradient_cache_init();
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
@@ -102,7 +106,10 @@ void lv_draw_sw_deinit(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+    lv_draw_sw_box_shadow_cache_deinit();
 #endif
+
+    lv_gradient_cache_deinit();
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
@@ -19,6 +19,7 @@
 #include "../../misc/lv_math.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
+#include "../../misc/cache/lv_cache.h"
 #include "../../stdlib/lv_string.h"
 #include "../lv_draw_mask.h"
 
@@ -29,20 +30,42 @@
 #define SHADOW_ENHANCE          1
 
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
+    #define shadow_cache_p LV_GLOBAL_DEFAULT()->sw_shadow_cache
+    #define CACHE_NAME  "SW_SHADOW"
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+typedef struct {
+    /*Key*/
+    int32_t width;      /*Shadow width*/
+    int32_t radius;     /*Clamped radius*/
+    int32_t core_w;     /*Size of the blurred rectangle, clamped to the range where it affects the corner*/
+    int32_t core_h;
+
+    /*Data*/
+    lv_opa_t * buf;     /*The corner followed by its horizontally mirrored version*/
+} shadow_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_opa_t * shadow_create_corner(const lv_area_t * core_area, int32_t sw, int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
 
+#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+    static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                          const shadow_cache_data_t * rhs);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -55,6 +78,29 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+void lv_draw_sw_box_shadow_cache_init(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    shadow_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(shadow_cache_data_t),
+    LV_DRAW_SW_SHADOW_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)shadow_cache_free_cb
+    });
+    lv_cache_set_name(shadow_cache_p, CACHE_NAME);
+#endif
+}
+
+void lv_draw_sw_box_shadow_cache_deinit(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache_p) {
+        lv_cache_destroy(shadow_cache_p, NULL);
+        shadow_cache_p = NULL;
+    }
+#endif
+}
+
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -97,35 +143,33 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
+    /*The corner is read only as it might be borrowed from the cache*/
+    lv_opa_t * corner_buf = NULL;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        LV_ASSERT_MALLOC(sh_buf);
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
+    lv_cache_entry_t * cache_entry = NULL;
+    if(shadow_cache_p && corner_size <= LV_DRAW_SW_SHADOW_CACHE_SIZE) {
+        /*The far sides of the blurred rectangle don't affect the corner if it's large enough*/
+        shadow_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.width = dsc->width;
+        search_key.radius = r_sh;
+        search_key.core_w = LV_MIN(lv_area_get_width(&core_area), corner_size * 2);
+        search_key.core_h = LV_MIN(lv_area_get_height(&core_area), corner_size * 2);
+
+        cache_entry = lv_cache_acquire_or_create(shadow_cache_p, &search_key, &core_area);
+        if(cache_entry) {
+            shadow_cache_data_t * data = lv_cache_entry_get_data(cache_entry);
+            corner_buf = data->buf;
         }
     }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 #endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
 
+    if(corner_buf == NULL) corner_buf = shadow_create_corner(&core_area, dsc->width, r_sh);
+    if(corner_buf == NULL) return;
+
+    lv_opa_t * sh_buf = corner_buf;
+
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
 
@@ -382,22 +426,8 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
         }
     }
 
-    /*Mirror the shadow corner buffer horizontally*/
-    sh_buf_tmp = sh_buf ;
-    for(y = 0; y < corner_size; y++) {
-        int32_t x;
-        lv_opa_t * start = sh_buf_tmp;
-        lv_opa_t * end = sh_buf_tmp + corner_size - 1;
-        for(x = 0; x < corner_size / 2; x++) {
-            lv_opa_t tmp = *start;
-            *start = *end;
-            *end = tmp;
-
-            start++;
-            end--;
-        }
-        sh_buf_tmp += corner_size;
-    }
+    /*Use the horizontally mirrored corner for the left side*/
+    sh_buf = corner_buf + corner_size * corner_size;
 
     /*Left side*/
     blend_area.x1 = shadow_area.x1;
@@ -555,14 +585,56 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
-    lv_free(sh_buf);
     lv_free(mask_buf);
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(cache_entry) {
+        lv_cache_release(shadow_cache_p, cache_entry, NULL);
+        return;
+    }
+#endif
+
+    lv_free(corner_buf);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Create a blurred corner and its horizontally mirrored version
+ * @param core_area the rectangle to blur
+ * @param sw        shadow width
+ * @param r         radius
+ * @return          a `(sw + r)^2 * 2` sized buffer with the two corners after each other, or NULL on error
+ */
+static lv_opa_t * shadow_create_corner(const lv_area_t * core_area, int32_t sw, int32_t r)
+{
+    int32_t size = sw + r;
+
+    /*A larger buffer is required for calculation which has the exact size of the two corners*/
+    lv_opa_t * buf = lv_malloc(size * size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return NULL;
+
+    shadow_draw_corner_buf(core_area, (uint16_t *)buf, sw, r);
+
+    /*Add the horizontally mirrored corner*/
+    int32_t y;
+    lv_opa_t * src = buf;
+    lv_opa_t * dest = buf + size * size;
+    for(y = 0; y < size; y++) {
+        int32_t x;
+        for(x = 0; x < size; x++) {
+            dest[x] = src[size - 1 - x];
+        }
+        src += size;
+        dest += size;
+    }
+
+    return buf;
+}
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
@@ -730,6 +802,34 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     lv_free(sh_ups_blur_buf);
 }
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data)
+{
+    const lv_area_t * core_area = user_data;
+    data->buf = shadow_create_corner(core_area, data->width, data->radius);
+    return data->buf != NULL;
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->buf);
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                      const shadow_cache_data_t * rhs)
+{
+    if(lhs->width != rhs->width) return lhs->width > rhs->width ? 1 : -1;
+    if(lhs->radius != rhs->radius) return lhs->radius > rhs->radius ? 1 : -1;
+    if(lhs->core_w != rhs->core_w) return lhs->core_w > rhs->core_w ? 1 : -1;
+    if(lhs->core_h != rhs->core_h) return lhs->core_h > rhs->core_h ? 1 : -1;
+
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
@@ -104,7 +104,13 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
     blend_dsc.opa = LV_OPA_COVER;
 
     /*Get gradient if appropriate*/
-    lv_grad_t * grad = lv_gradient_get(&dsc->grad, coords_bg_w, coords_bg_h);
+    lv_grad_t * grad;
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+    /*Complex gradients render each line into the maps, so they can't use a shared cached map*/
+    if(grad_dir >= LV_GRAD_DIR_LINEAR) grad = lv_gradient_line_buf_create(coords_bg_w);
+    else
+#endif
+        grad = lv_gradient_get(&dsc->grad, coords_bg_w, coords_bg_h);
     lv_opa_t * grad_opa_map = NULL;
     bool transp = false;
     if(grad && grad_dir >= LV_GRAD_DIR_HOR) {
@@ -12,10 +12,14 @@
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->sw_grad_cache)
+#define CACHE_NAME  "SW_GRADIENT"
 #define GRAD_CM(r,g,b) lv_color_make(r,g,b)
 #define GRAD_CONV(t, x) t = x
 
@@ -30,6 +34,18 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+
+/*The maps depend only on the stops and the map size, so e.g. horizontal and linear gradients
+ *or the same complex gradient on Widgets with different sizes can share an entry*/
+typedef struct {
+    lv_grad_t grad;     /*Must be the first*/
+    lv_gradient_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    uint8_t stops_count;
+} grad_cache_data_t;
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 typedef struct {
@@ -72,8 +88,17 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-typedef lv_result_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static uint32_t get_map_size(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static size_t get_maps_buf_size(uint32_t size);
+static void set_maps(lv_grad_t * item, uint8_t * buf, uint32_t size);
+static lv_grad_t * allocate_item(uint32_t size);
+static void fill_maps(const lv_grad_dsc_t * g, lv_grad_t * item);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data);
+    static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
@@ -89,35 +114,101 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static uint32_t get_map_size(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
-    int32_t size;
     switch(g->dir) {
         case LV_GRAD_DIR_HOR:
         case LV_GRAD_DIR_LINEAR:
         case LV_GRAD_DIR_RADIAL:
         case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
+            return w;
         case LV_GRAD_DIR_VER:
-            size = h;
-            break;
+            return h;
         default:
-            size = 64;
+            return 64;
     }
+}
 
-    size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+static size_t get_maps_buf_size(uint32_t size)
+{
+    return ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
+
+static void set_maps(lv_grad_t * item, uint8_t * buf, uint32_t size)
+{
+    item->color_map = (lv_color_t *)buf;
+    item->opa_map = (lv_opa_t *)(buf + ALIGN(size * sizeof(lv_color_t)));
+    item->size = size;
+}
+
+static lv_grad_t * allocate_item(uint32_t size)
+{
+    /*Allocate the item and its maps in one buffer*/
+    size_t req_size = ALIGN(sizeof(lv_grad_t)) + get_maps_buf_size(size);
     lv_grad_t * item  = lv_malloc(req_size);
     LV_ASSERT_MALLOC(item);
     if(item == NULL) return NULL;
 
-    uint8_t * p = (uint8_t *)item;
-    item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
-    item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
-    item->size = size;
+    set_maps(item, (uint8_t *)item + ALIGN(sizeof(lv_grad_t)), size);
+    item->entry = NULL;
     return item;
 }
 
+static void fill_maps(const lv_grad_dsc_t * g, lv_grad_t * item)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+
+static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data)
+{
+    const lv_grad_dsc_t * g = user_data;
+    uint8_t * buf = lv_malloc(get_maps_buf_size(data->grad.size));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return false;
+
+    set_maps(&data->grad, buf, data->grad.size);
+    fill_maps(g, &data->grad);
+    data->grad.entry = lv_cache_entry_get_entry(data, sizeof(grad_cache_data_t));
+    return true;
+}
+
+static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->grad.color_map);
+}
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs)
+{
+    if(lhs->grad.size != rhs->grad.size) {
+        return lhs->grad.size > rhs->grad.size ? 1 : -1;
+    }
+    if(lhs->stops_count != rhs->stops_count) {
+        return lhs->stops_count > rhs->stops_count ? 1 : -1;
+    }
+
+    uint32_t i;
+    for(i = 0; i < lhs->stops_count; i++) {
+        const lv_gradient_stop_t * l = &lhs->stops[i];
+        const lv_gradient_stop_t * r = &rhs->stops[i];
+        if(l->frac != r->frac) return l->frac > r->frac ? 1 : -1;
+        if(l->opa != r->opa) return l->opa > r->opa ? 1 : -1;
+
+        uint32_t lc = lv_color_to_u32(l->color);
+        uint32_t rc = lv_color_to_u32(r->color);
+        if(lc != rc) return lc > rc ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_GRADIENT_CACHE_CNT > 0*/
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
@@ -141,23 +232,72 @@ static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
  *     FUNCTIONS
  **********************/
 
+void lv_gradient_cache_init(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    grad_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(grad_cache_data_t),
+    LV_DRAW_SW_GRADIENT_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)grad_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)grad_cache_free_cb
+    });
+    lv_cache_set_name(grad_cache_p, CACHE_NAME);
+#endif
+}
+
+void lv_gradient_cache_deinit(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    if(grad_cache_p) {
+        lv_cache_destroy(grad_cache_p, NULL);
+        grad_cache_p = NULL;
+    }
+#endif
+}
+
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_grad_t * item = allocate_item(g, w, h);
+    uint32_t size = get_map_size(g, w, h);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    /* Step 1: Search cache for the given key or add a new entry */
+    if(grad_cache_p) {
+        grad_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.grad.size = size;
+        search_key.stops_count = g->stops_count;
+        lv_memcpy(search_key.stops, g->stops, g->stops_count * sizeof(lv_gradient_stop_t));
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(grad_cache_p, &search_key, (void *)g);
+        if(entry) {
+            grad_cache_data_t * data = lv_cache_entry_get_data(entry);
+            return &data->grad;
+        }
+    }
+#endif
+
+    /* Step 2: Allocate a private item if it couldn't be cached */
+    lv_grad_t * item = allocate_item(size);
     if(item == NULL) {
         LV_LOG_WARN("Failed to allocate item for the gradient");
         return item;
     }
 
     /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    fill_maps(g, item);
+    return item;
+}
+
+lv_grad_t * lv_gradient_line_buf_create(int32_t w)
+{
+    lv_grad_t * item = allocate_item(w);
+    if(item == NULL) {
+        LV_LOG_WARN("Failed to allocate the line buffer for the gradient");
     }
+
     return item;
 }
 
@@ -216,6 +356,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    if(grad->entry) {
+        lv_cache_release(grad_cache_p, grad->entry, NULL);
+        return;
+    }
+#endif
+
     lv_free(grad);
 }
 
@@ -501,7 +648,7 @@ void lv_gradient_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_gradient_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -573,7 +720,7 @@ void lv_gradient_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_gradient_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -51,11 +51,25 @@ typedef lv_color_t lv_grad_color_t;
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_gradient_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
                                                              int32_t frac, lv_grad_color_t * color_out, lv_opa_t * opa_out);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Get the color and opacity maps of a gradient.
+ * The maps are shared via a cache (see `LV_DRAW_SW_GRADIENT_CACHE_CNT`) so they must not be modified.
+ * @param gradient  the gradient descriptor
+ * @param w         width of the area to fill
+ * @param h         height of the area to fill
+ * @return          the gradient or NULL on error. Release it with `lv_gradient_cleanup`
+ */
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
- * Clean up the gradient item after it was get with `lv_grad_get_from_cache`.
+ * Allocate a private, uninitialized gradient item to render lines of a complex gradient into.
+ * @param w         number of pixels in the maps
+ * @return          the gradient or NULL on error. Free it with `lv_gradient_cleanup`
+ */
+lv_grad_t * lv_gradient_line_buf_create(int32_t w);
+
+/**
+ * Clean up the gradient item after it was get with `lv_gradient_get` or `lv_gradient_line_buf_create`.
  * @param grad      pointer to a gradient
  */
 void lv_gradient_cleanup(lv_grad_t * grad);
@@ -30,6 +30,7 @@ struct _lv_grad_t {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * entry;   /**< The cache entry holding the maps or NULL if not cached*/
 };
 
 
@@ -37,6 +38,16 @@ struct _lv_grad_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the gradient color maps
+ */
+void lv_gradient_cache_init(void);
+
+/**
+ * Free the cache of the gradient color maps
+ */
+void lv_gradient_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -43,18 +43,22 @@ struct _lv_draw_sw_unit_t {
     uint32_t idx;
 };
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
-} lv_draw_sw_shadow_cache_t;
-#endif
-
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_COMPLEX
+/**
+ * Create the cache of the blurred box shadow corners
+ */
+void lv_draw_sw_box_shadow_cache_init(void);
+
+/**
+ * Free the cache of the blurred box shadow corners
+ */
+void lv_draw_sw_box_shadow_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
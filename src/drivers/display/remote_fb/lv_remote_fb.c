@@ -0,0 +1,433 @@
+/**
+ * @file lv_remote_fb.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_remote_fb.h"
+#if LV_USE_REMOTE_FB
+
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#if LV_USE_LZ4_EXTERNAL
+    #include <lz4.h>
+#endif
+
+#if LV_USE_LZ4_INTERNAL
+    #include "../../../libs/lz4/lz4.h"
+#endif
+
+#include "../../../core/lv_obj.h"
+#include "../../../draw/lv_draw_buf.h"
+#include "../../../misc/lv_timer.h"
+#include "../../../stdlib/lv_mem.h"
+#include "../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define USE_LZ4             (LV_USE_LZ4_INTERNAL || LV_USE_LZ4_EXTERNAL)
+
+/*A client which can't receive a message for this long is dropped to not block the rendering*/
+#define SEND_TIMEOUT_MS     1000
+
+#define RLE_MAX_RUN         255
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_draw_buf_t * draw_buf;
+    uint8_t * pack_buf;         /*The pixels of an area without the stride padding*/
+    uint8_t * enc_buf;          /*The compressed pixels of an area*/
+    uint32_t enc_buf_size;
+    lv_timer_t * timer;
+    int listen_fd;
+    int client_fd;
+    uint16_t port;
+    lv_remote_fb_encoding_t encoding;
+} lv_remote_fb_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void timer_cb(lv_timer_t * t);
+static void delete_event_cb(lv_event_t * e);
+static bool listen_open(lv_remote_fb_t * dsc, uint16_t port);
+static void client_accept(lv_display_t * disp, lv_remote_fb_t * dsc);
+static void client_close(lv_remote_fb_t * dsc);
+static bool send_all(lv_remote_fb_t * dsc, const void * data, uint32_t size);
+static bool send_area(lv_remote_fb_t * dsc, lv_color_format_t cf, const lv_area_t * area, const uint8_t * px_map);
+static bool send_msg(lv_remote_fb_t * dsc, lv_remote_fb_msg_t type, lv_remote_fb_encoding_t encoding,
+                     const lv_area_t * area, const void * payload, uint32_t size);
+static uint32_t rle_encode(const uint8_t * src, uint32_t px_cnt, uint32_t px_size, uint8_t * dst, uint32_t dst_size);
+static uint8_t * put_u16(uint8_t * p, uint32_t v);
+static uint8_t * put_u32(uint8_t * p, uint32_t v);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_display_t * lv_remote_fb_create(int32_t hor_res, int32_t ver_res, uint16_t port)
+{
+    lv_remote_fb_t * dsc = lv_malloc_zeroed(sizeof(lv_remote_fb_t));
+    LV_ASSERT_MALLOC(dsc);
+    if(dsc == NULL) return NULL;
+
+    dsc->listen_fd = -1;
+    dsc->client_fd = -1;
+#if USE_LZ4
+    dsc->encoding = LV_REMOTE_FB_ENCODING_LZ4;
+#else
+    dsc->encoding = LV_REMOTE_FB_ENCODING_RLE;
+#endif
+
+    if(!listen_open(dsc, port)) {
+        lv_free(dsc);
+        return NULL;
+    }
+
+    lv_display_t * disp = lv_display_create(hor_res, ver_res);
+    if(disp == NULL) {
+        close(dsc->listen_fd);
+        lv_free(dsc);
+        return NULL;
+    }
+
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    if(lv_color_format_get_bpp(cf) % 8 != 0) {
+        LV_LOG_ERROR("Color formats with less than 1 byte per pixel are not supported");
+        close(dsc->listen_fd);
+        lv_free(dsc);
+        lv_display_delete(disp);
+        return NULL;
+    }
+
+    /*Only the draw buffer sized buffers are needed as the areas are sent as they are flushed*/
+    uint32_t rows = LV_MIN(LV_REMOTE_FB_BUFFER_SIZE, ver_res);
+    dsc->draw_buf = lv_draw_buf_create(hor_res, rows, cf, 0);
+    dsc->enc_buf_size = dsc->draw_buf ? dsc->draw_buf->data_size : 0;
+#if USE_LZ4
+    dsc->enc_buf_size = LV_MAX(dsc->enc_buf_size, (uint32_t)LZ4_compressBound(dsc->enc_buf_size));
+#endif
+    dsc->enc_buf = dsc->draw_buf ? lv_malloc(dsc->enc_buf_size) : NULL;
+    dsc->timer = lv_timer_create(timer_cb, LV_DEF_REFR_PERIOD, disp);
+    if(dsc->draw_buf == NULL || dsc->enc_buf == NULL || dsc->timer == NULL) {
+        LV_LOG_ERROR("Out of memory");
+        if(dsc->timer) lv_timer_delete(dsc->timer);
+        if(dsc->draw_buf) lv_draw_buf_destroy(dsc->draw_buf);
+        lv_free(dsc->enc_buf);
+        close(dsc->listen_fd);
+        lv_free(dsc);
+        lv_display_delete(disp);
+        return NULL;
+    }
+
+    lv_display_set_driver_data(disp, dsc);
+    lv_display_set_draw_buffers(disp, dsc->draw_buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, delete_event_cb, LV_EVENT_DELETE, disp);
+
+    LV_LOG_INFO("Listening on port %d", dsc->port);
+
+    return disp;
+}
+
+uint16_t lv_remote_fb_get_port(lv_display_t * disp)
+{
+    lv_remote_fb_t * dsc = lv_display_get_driver_data(disp);
+    return dsc->port;
+}
+
+bool lv_remote_fb_is_connected(lv_display_t * disp)
+{
+    lv_remote_fb_t * dsc = lv_display_get_driver_data(disp);
+    return dsc->client_fd >= 0;
+}
+
+void lv_remote_fb_set_encoding(lv_display_t * disp, lv_remote_fb_encoding_t encoding)
+{
+#if USE_LZ4 == 0
+    if(encoding == LV_REMOTE_FB_ENCODING_LZ4) {
+        LV_LOG_WARN("LZ4 is not enabled");
+        return;
+    }
+#endif
+
+    lv_remote_fb_t * dsc = lv_display_get_driver_data(disp);
+    dsc->encoding = encoding;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    lv_remote_fb_t * dsc = lv_display_get_driver_data(disp);
+
+    /*Send the area right away so no frame sized buffer is needed.
+     *The client composes the frame and shows it on FRAME_END.*/
+    if(dsc->client_fd >= 0) {
+        bool ok = send_area(dsc, lv_display_get_color_format(disp), area, px_map);
+        if(ok && lv_display_flush_is_last(disp)) ok = send_msg(dsc, LV_REMOTE_FB_MSG_FRAME_END,
+                                                                   LV_REMOTE_FB_ENCODING_RAW, area, NULL, 0);
+        if(!ok) client_close(dsc);
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static void timer_cb(lv_timer_t * t)
+{
+    lv_display_t * disp = lv_timer_get_user_data(t);
+    lv_remote_fb_t * dsc = lv_display_get_driver_data(disp);
+
+    if(dsc->client_fd < 0) {
+        client_accept(disp, dsc);
+        return;
+    }
+
+    /*The client doesn't send anything, just check whether it's still connected*/
+    uint8_t buf[64];
+    while(1) {
+        ssize_t res = recv(dsc->client_fd, buf, sizeof(buf), MSG_DONTWAIT);
+        if(res > 0) continue;
+        if(res < 0 && (errno == EINTR)) continue;
+        if(res == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            LV_LOG_INFO("Client disconnected");
+            client_close(dsc);
+        }
+        break;
+    }
+}
+
+static void delete_event_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_user_data(e);
+    lv_remote_fb_t * dsc = lv_display_get_driver_data(disp);
+
+    client_close(dsc);
+    close(dsc->listen_fd);
+    lv_timer_delete(dsc->timer);
+    lv_draw_buf_destroy(dsc->draw_buf);
+    lv_free(dsc->pack_buf);
+    lv_free(dsc->enc_buf);
+    lv_free(dsc);
+}
+
+static bool listen_open(lv_remote_fb_t * dsc, uint16_t port)
+{
+    dsc->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(dsc->listen_fd < 0) {
+        LV_LOG_ERROR("socket() failed: %d", errno);
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(dsc->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    /*Only local clients. Use an SSH tunnel or similar to reach it from an other machine.*/
+    struct sockaddr_in addr;
+    lv_memzero(&addr, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+
+    socklen_t addr_len = sizeof(addr);
+    if(bind(dsc->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+       listen(dsc->listen_fd, 1) != 0 ||
+       fcntl(dsc->listen_fd, F_SETFL, O_NONBLOCK) != 0 ||
+       getsockname(dsc->listen_fd, (struct sockaddr *)&addr, &addr_len) != 0) {
+        LV_LOG_ERROR("Couldn't listen on port %d: %d", port, errno);
+        close(dsc->listen_fd);
+        dsc->listen_fd = -1;
+        return false;
+    }
+
+    dsc->port = ntohs(addr.sin_port);
+    return true;
+}
+
+static void client_accept(lv_display_t * disp, lv_remote_fb_t * dsc)
+{
+    int fd = accept(dsc->listen_fd, NULL, NULL);
+    if(fd < 0) return;
+
+    /*The accepted socket is blocking, just limit how long a send can block*/
+    int no_delay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+    struct timeval timeout;
+    timeout.tv_sec = SEND_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (SEND_TIMEOUT_MS % 1000) * 1000;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    dsc->client_fd = fd;
+
+    uint8_t hello[LV_REMOTE_FB_HEADER_SIZE];
+    uint8_t * p = hello;
+    lv_memcpy(p, LV_REMOTE_FB_MAGIC, 4);
+    p = put_u16(p + 4, LV_REMOTE_FB_PROTOCOL_VERSION);
+    p = put_u16(p, lv_display_get_color_format(disp));
+    p = put_u32(p, lv_display_get_horizontal_resolution(disp));
+    put_u32(p, lv_display_get_vertical_resolution(disp));
+
+    if(!send_all(dsc, hello, sizeof(hello))) {
+        client_close(dsc);
+        return;
+    }
+
+    LV_LOG_INFO("Client connected");
+
+    /*The client has nothing yet so send the whole screen first*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+}
+
+static void client_close(lv_remote_fb_t * dsc)
+{
+    if(dsc->client_fd < 0) return;
+
+    close(dsc->client_fd);
+    dsc->client_fd = -1;
+}
+
+static bool send_all(lv_remote_fb_t * dsc, const void * data, uint32_t size)
+{
+    const uint8_t * p = data;
+    while(size > 0) {
+        ssize_t res = send(dsc->client_fd, p, size, MSG_NOSIGNAL);
+        if(res < 0) {
+            if(errno == EINTR) continue;
+            LV_LOG_WARN("Sending failed, dropping the client: %d", errno);
+            return false;
+        }
+        p += res;
+        size -= (uint32_t)res;
+    }
+
+    return true;
+}
+
+static bool send_area(lv_remote_fb_t * dsc, lv_color_format_t cf, const lv_area_t * area, const uint8_t * px_map)
+{
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t row_size = w * px_size;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t size = row_size * h;
+
+    /*The encoded pixels have no padding between the rows*/
+    const uint8_t * data = px_map;
+    if(stride != row_size) {
+        if(dsc->pack_buf == NULL) {
+            dsc->pack_buf = lv_malloc(dsc->draw_buf->data_size);
+            LV_ASSERT_MALLOC(dsc->pack_buf);
+            if(dsc->pack_buf == NULL) return false;
+        }
+
+        uint32_t y;
+        for(y = 0; y < h; y++) lv_memcpy(dsc->pack_buf + y * row_size, px_map + y * stride, row_size);
+        data = dsc->pack_buf;
+    }
+
+    uint32_t enc_size = 0;
+    switch(dsc->encoding) {
+#if USE_LZ4
+        case LV_REMOTE_FB_ENCODING_LZ4:
+            enc_size = LZ4_compress_default((const char *)data, (char *)dsc->enc_buf, (int)size, (int)dsc->enc_buf_size);
+            break;
+#endif
+        case LV_REMOTE_FB_ENCODING_RLE:
+            enc_size = rle_encode(data, w * h, px_size, dsc->enc_buf, size);
+            break;
+        default:
+            break;
+    }
+
+    if(enc_size > 0 && enc_size < size) {
+        return send_msg(dsc, LV_REMOTE_FB_MSG_RECT, dsc->encoding, area, dsc->enc_buf, enc_size);
+    }
+    else {
+        return send_msg(dsc, LV_REMOTE_FB_MSG_RECT, LV_REMOTE_FB_ENCODING_RAW, area, data, size);
+    }
+}
+
+static bool send_msg(lv_remote_fb_t * dsc, lv_remote_fb_msg_t type, lv_remote_fb_encoding_t encoding,
+                     const lv_area_t * area, const void * payload, uint32_t size)
+{
+    uint8_t header[LV_REMOTE_FB_HEADER_SIZE];
+    uint8_t * p = header;
+    *p++ = (uint8_t)type;
+    *p++ = (uint8_t)encoding;
+    p = put_u16(p, 0);
+    if(type == LV_REMOTE_FB_MSG_RECT) {
+        p = put_u16(p, area->x1);
+        p = put_u16(p, area->y1);
+        p = put_u16(p, lv_area_get_width(area));
+        p = put_u16(p, lv_area_get_height(area));
+    }
+    else {
+        lv_memzero(p, 8);
+        p += 8;
+    }
+    put_u32(p, size);
+
+    if(!send_all(dsc, header, sizeof(header))) return false;
+    return size == 0 || send_all(dsc, payload, size);
+}
+
+/**
+ * Encode the pixels as runs of identical pixels
+ * @return      the size of the encoded data or 0 if it wouldn't be smaller than `dst_size`
+ */
+static uint32_t rle_encode(const uint8_t * src, uint32_t px_cnt, uint32_t px_size, uint8_t * dst, uint32_t dst_size)
+{
+    uint32_t out = 0;
+    uint32_t i = 0;
+    while(i < px_cnt) {
+        const uint8_t * px = src + i * px_size;
+        uint32_t run = 1;
+        while(i + run < px_cnt && run < RLE_MAX_RUN && lv_memcmp(px, px + run * px_size, px_size) == 0) run++;
+
+        if(out + 1 + px_size >= dst_size) return 0;
+        dst[out] = (uint8_t)run;
+        lv_memcpy(&dst[out + 1], px, px_size);
+        out += 1 + px_size;
+        i += run;
+    }
+
+    return out;
+}
+
+static uint8_t * put_u16(uint8_t * p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t * put_u32(uint8_t * p, uint32_t v)
+{
+    p = put_u16(p, v);
+    return put_u16(p, v >> 16);
+}
+
+#endif /*LV_USE_REMOTE_FB*/
@@ -0,0 +1,118 @@
+/**
+ * @file lv_remote_fb.h
+ *
+ */
+
+#ifndef LV_REMOTE_FB_H
+#define LV_REMOTE_FB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../display/lv_display.h"
+
+#if LV_USE_REMOTE_FB
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** First bytes of the hello message */
+#define LV_REMOTE_FB_MAGIC              "LVRF"
+
+#define LV_REMOTE_FB_PROTOCOL_VERSION   1
+
+/** Size of the hello message and the header of the other messages */
+#define LV_REMOTE_FB_HEADER_SIZE        16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Type of the messages sent to the client.
+ *
+ * All values are little endian. When a client connects it receives a hello message:
+ * - `char magic[4]`: `LV_REMOTE_FB_MAGIC`
+ * - `uint16_t version`: `LV_REMOTE_FB_PROTOCOL_VERSION`
+ * - `uint16_t color_format`: an `lv_color_format_t`
+ * - `uint32_t width`, `uint32_t height`: resolution of the display
+ *
+ * Every other message starts with a `LV_REMOTE_FB_HEADER_SIZE` byte header:
+ * - `uint8_t type`: an `lv_remote_fb_msg_t`
+ * - `uint8_t encoding`: an `lv_remote_fb_encoding_t`
+ * - `uint16_t reserved`
+ * - `uint16_t x`, `uint16_t y`, `uint16_t w`, `uint16_t h`: the updated area
+ * - `uint32_t size`: number of payload bytes following the header
+ *
+ * The first frame after connecting covers the whole screen,
+ * afterwards only the invalidated areas are sent.
+ */
+typedef enum {
+    LV_REMOTE_FB_MSG_RECT = 1,      /**< The pixels of an area */
+    LV_REMOTE_FB_MSG_FRAME_END = 2, /**< All the areas of a frame were sent */
+} lv_remote_fb_msg_t;
+
+/**
+ * Encoding of the pixels of a `LV_REMOTE_FB_MSG_RECT` message.
+ * The decoded pixels are `w * h` pixels without padding between the rows.
+ */
+typedef enum {
+    LV_REMOTE_FB_ENCODING_RAW = 0,  /**< The pixels as they are */
+    LV_REMOTE_FB_ENCODING_RLE = 1,  /**< Runs of a `uint8_t` pixel count (1..255) followed by the pixel */
+    LV_REMOTE_FB_ENCODING_LZ4 = 2,  /**< An LZ4 block. Requires `LV_USE_LZ4_INTERNAL` or `LV_USE_LZ4_EXTERNAL` */
+} lv_remote_fb_encoding_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a headless display which sends the rendered areas to a client connected over TCP.
+ * It listens on the loopback interface and serves one client at a time.
+ * @param hor_res   horizontal resolution
+ * @param ver_res   vertical resolution
+ * @param port      TCP port to listen on, or 0 to let the system choose a free port
+ * @return          the created display or NULL on error
+ */
+lv_display_t * lv_remote_fb_create(int32_t hor_res, int32_t ver_res, uint16_t port);
+
+/**
+ * Get the TCP port a remote framebuffer display listens on.
+ * @param disp      a display created by `lv_remote_fb_create()`
+ * @return          the port number
+ */
+uint16_t lv_remote_fb_get_port(lv_display_t * disp);
+
+/**
+ * Check whether a client is connected.
+ * @param disp      a display created by `lv_remote_fb_create()`
+ * @return          true: a client is connected
+ */
+bool lv_remote_fb_is_connected(lv_display_t * disp);
+
+/**
+ * Set how the areas are compressed. If the compressed data is not smaller,
+ * the area is sent as `LV_REMOTE_FB_ENCODING_RAW`.
+ * The default is `LV_REMOTE_FB_ENCODING_LZ4` if LZ4 is enabled, else `LV_REMOTE_FB_ENCODING_RLE`.
+ * @param disp      a display created by `lv_remote_fb_create()`
+ * @param encoding  the encoding to use
+ */
+void lv_remote_fb_set_encoding(lv_display_t * disp, lv_remote_fb_encoding_t encoding);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_REMOTE_FB */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_REMOTE_FB_H */
@@ -13,6 +13,8 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <string.h>
+#include <poll.h>
+#include <time.h>
 #include <sys/param.h> /*To detect BSD*/
 #ifdef BSD
     #include <dev/evdev/input.h>
@@ -24,11 +26,57 @@
 #include "../../stdlib/lv_mem.h"
 #include "../../stdlib/lv_string.h"
 #include "../../display/lv_display.h"
+#include "../../misc/lv_timer_private.h"
+#include "../../osal/lv_os.h"
+#include "../../osal/lv_atomic_private.h"
+
+#if !LV_ATOMIC_AVAILABLE
+    #error "The evdev driver requires a compiler with atomic builtins for its reader thread"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of samples the reader thread can queue. Must be a power of 2.*/
+#define EVDEV_QUEUE_SIZE    256
+
+/*Number of `input_event`s fetched from the device with one `read()`*/
+#define EVDEV_READ_BATCH    64
+
+/*Poll timeout of the reader thread in ms. Limits how long stopping the thread can take.*/
+#define EVDEV_POLL_TIMEOUT  100
+
+#define EVDEV_THREAD_STACK_SIZE (32 * 1024)
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*A complete input report (everything until a SYN_REPORT) or a key event, queued by the reader thread*/
+typedef struct {
+    int x;
+    int y;
+    int key;
+    lv_indev_state_t state;
+    uint32_t time; /*Kernel timestamp of the event in ms*/
+} lv_evdev_sample_t;
+
+typedef struct {
+    /*Single producer (reader thread), single consumer (read_cb) lock-free queue*/
+    lv_evdev_sample_t samples[EVDEV_QUEUE_SIZE];
+    uint32_t head;  /*Written only by the reader thread*/
+    uint32_t tail;  /*Written only by the read_cb*/
+
+    /*State accumulated by the reader thread between two SYN_REPORTs*/
+    lv_evdev_sample_t report;
+    bool report_changed;
+
+    lv_thread_t thread;
+    bool running;
+    bool exit;
+} lv_evdev_reader_t;
+
 typedef struct {
     /*Device*/
     int fd;
@@ -43,6 +91,8 @@ typedef struct {
     int root_y;
     int key;
     lv_indev_state_t state;
+    /*Reader thread, NULL if the device is read in the read_cb*/
+    lv_evdev_reader_t * reader;
 } lv_evdev_t;
 
 /**********************
@@ -108,37 +158,169 @@ static lv_point_t _evdev_process_pointer(lv_indev_t * indev, int x, int y)
     return p;
 }
 
+static uint32_t _evdev_event_time(const struct input_event * in)
+{
+    /*Wrap around in 32 bits like the ticks instead of overflowing the signed `time_t`*/
+    return (uint32_t)in->input_event_sec * 1000u + (uint32_t)in->input_event_usec / 1000u;
+}
+
+static void _evdev_reader_push(lv_evdev_reader_t * reader, const lv_evdev_sample_t * sample)
+{
+    uint32_t tail = lv_atomic_load(&reader->tail);
+    if(reader->head - tail >= EVDEV_QUEUE_SIZE) {
+        LV_LOG_WARN("sample queue is full, dropping a sample");
+        return;
+    }
+
+    reader->samples[reader->head & (EVDEV_QUEUE_SIZE - 1)] = *sample;
+    lv_atomic_store(&reader->head, reader->head + 1);
+}
+
+static void _evdev_reader_process(lv_evdev_reader_t * reader, const struct input_event * in)
+{
+    lv_evdev_sample_t * report = &reader->report;
+
+    if(in->type == EV_REL) {
+        if(in->code == REL_X) report->x += in->value;
+        else if(in->code == REL_Y) report->y += in->value;
+        else return;
+        reader->report_changed = true;
+    }
+    else if(in->type == EV_ABS) {
+        if(in->code == ABS_X || in->code == ABS_MT_POSITION_X) report->x = in->value;
+        else if(in->code == ABS_Y || in->code == ABS_MT_POSITION_Y) report->y = in->value;
+        else if(in->code == ABS_MT_TRACKING_ID) {
+            if(in->value == -1) report->state = LV_INDEV_STATE_RELEASED;
+            else if(in->value == 0) report->state = LV_INDEV_STATE_PRESSED;
+        }
+        else return;
+        reader->report_changed = true;
+    }
+    else if(in->type == EV_KEY) {
+        if(in->code == BTN_MOUSE || in->code == BTN_TOUCH) {
+            if(in->value == 0) report->state = LV_INDEV_STATE_RELEASED;
+            else if(in->value == 1) report->state = LV_INDEV_STATE_PRESSED;
+            reader->report_changed = true;
+        }
+        else {
+            int key = _evdev_process_key(in->code);
+            if(key) {
+                /*Every key event is queued on its own*/
+                report->key = key;
+                report->state = in->value ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+                report->time = _evdev_event_time(in);
+                _evdev_reader_push(reader, report);
+                reader->report_changed = false;
+            }
+        }
+    }
+    else if(in->type == EV_SYN && in->code == SYN_REPORT && reader->report_changed) {
+        /*All axes of a report are coalesced into a single sample*/
+        report->time = _evdev_event_time(in);
+        _evdev_reader_push(reader, report);
+        reader->report_changed = false;
+    }
+}
+
+static void _evdev_reader_thread(void * user_data)
+{
+    lv_evdev_t * dsc = user_data;
+    lv_evdev_reader_t * reader = dsc->reader;
+    struct input_event in[EVDEV_READ_BATCH];
+    struct pollfd pfd = { .fd = dsc->fd, .events = POLLIN };
+
+    while(!lv_atomic_load(&reader->exit)) {
+        int rc = poll(&pfd, 1, EVDEV_POLL_TIMEOUT);
+        if(rc < 0 && errno != EINTR) {
+            LV_LOG_ERROR("poll failed: %s", strerror(errno));
+            break;
+        }
+        if(rc <= 0) continue;
+
+        /*Drain everything the kernel has buffered with as few syscalls as possible*/
+        ssize_t len;
+        while((len = read(dsc->fd, in, sizeof(in))) > 0) {
+            size_t cnt = (size_t)len / sizeof(in[0]);
+            for(size_t i = 0; i < cnt; i++) {
+                _evdev_reader_process(reader, &in[i]);
+            }
+        }
+    }
+}
+
+static void _evdev_read_queue(lv_indev_t * indev, lv_evdev_t * dsc, lv_indev_data_t * data)
+{
+    lv_evdev_reader_t * reader = dsc->reader;
+    uint32_t head = lv_atomic_load(&reader->head);
+    uint32_t tail = reader->tail;
+    if(tail == head) return; /*No new samples, report the last state*/
+
+    lv_evdev_sample_t sample = reader->samples[tail & (EVDEV_QUEUE_SIZE - 1)];
+    tail++;
+
+    /*Merge pointer motion samples until they span a read period. This way each processed
+     *sample moves about as much as a polled one would, keeping scroll throw velocity right,
+     *while bursts which arrived between two reads are still processed step by step.*/
+    if(lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER) {
+        lv_timer_t * read_timer = lv_indev_get_read_timer(indev);
+        uint32_t period = read_timer ? read_timer->period : LV_DEF_REFR_PERIOD;
+        uint32_t start = sample.time;
+        while(tail != head) {
+            const lv_evdev_sample_t * next = &reader->samples[tail & (EVDEV_QUEUE_SIZE - 1)];
+            if(next->state != sample.state || next->time - start >= period) break;
+            sample.x = next->x;
+            sample.y = next->y;
+            sample.time = next->time;
+            tail++;
+        }
+    }
+
+    lv_atomic_store(&reader->tail, tail);
+
+    dsc->root_x = sample.x;
+    dsc->root_y = sample.y;
+    dsc->key = sample.key;
+    dsc->state = sample.state;
+    data->continue_reading = tail != head;
+}
+
 static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
 {
     lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
     LV_ASSERT_NULL(dsc);
 
-    /*Update dsc with buffered events*/
-    struct input_event in = { 0 };
-    while(read(dsc->fd, &in, sizeof(in)) > 0) {
-        if(in.type == EV_REL) {
-            if(in.code == REL_X) dsc->root_x += in.value;
-            else if(in.code == REL_Y) dsc->root_y += in.value;
-        }
-        else if(in.type == EV_ABS) {
-            if(in.code == ABS_X || in.code == ABS_MT_POSITION_X) dsc->root_x = in.value;
-            else if(in.code == ABS_Y || in.code == ABS_MT_POSITION_Y) dsc->root_y = in.value;
-            else if(in.code == ABS_MT_TRACKING_ID) {
-                if(in.value == -1) dsc->state = LV_INDEV_STATE_RELEASED;
-                else if(in.value == 0) dsc->state = LV_INDEV_STATE_PRESSED;
+    if(dsc->reader) {
+        /*The device is read by the reader thread, consume its queue*/
+        _evdev_read_queue(indev, dsc, data);
+    }
+    else {
+        /*Update dsc with buffered events*/
+        struct input_event in = { 0 };
+        while(read(dsc->fd, &in, sizeof(in)) > 0) {
+            if(in.type == EV_REL) {
+                if(in.code == REL_X) dsc->root_x += in.value;
+                else if(in.code == REL_Y) dsc->root_y += in.value;
             }
-        }
-        else if(in.type == EV_KEY) {
-            if(in.code == BTN_MOUSE || in.code == BTN_TOUCH) {
-                if(in.value == 0) dsc->state = LV_INDEV_STATE_RELEASED;
-                else if(in.value == 1) dsc->state = LV_INDEV_STATE_PRESSED;
+            else if(in.type == EV_ABS) {
+                if(in.code == ABS_X || in.code == ABS_MT_POSITION_X) dsc->root_x = in.value;
+                else if(in.code == ABS_Y || in.code == ABS_MT_POSITION_Y) dsc->root_y = in.value;
+                else if(in.code == ABS_MT_TRACKING_ID) {
+                    if(in.value == -1) dsc->state = LV_INDEV_STATE_RELEASED;
+                    else if(in.value == 0) dsc->state = LV_INDEV_STATE_PRESSED;
+                }
             }
-            else {
-                dsc->key = _evdev_process_key(in.code);
-                if(dsc->key) {
-                    dsc->state = in.value ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-                    data->continue_reading = true; /*Keep following events in buffer for now*/
-                    break;
+            else if(in.type == EV_KEY) {
+                if(in.code == BTN_MOUSE || in.code == BTN_TOUCH) {
+                    if(in.value == 0) dsc->state = LV_INDEV_STATE_RELEASED;
+                    else if(in.value == 1) dsc->state = LV_INDEV_STATE_PRESSED;
+                }
+                else {
+                    dsc->key = _evdev_process_key(in.code);
+                    if(dsc->key) {
+                        dsc->state = in.value ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+                        data->continue_reading = true; /*Keep following events in buffer for now*/
+                        break;
+                    }
                 }
             }
         }
@@ -231,10 +413,56 @@ void lv_evdev_set_calibration(lv_indev_t * indev, int min_x, int min_y, int max_
     dsc->max_y = max_y;
 }
 
+lv_result_t lv_evdev_set_reader_thread(lv_indev_t * indev, bool en)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+
+    if(en == (dsc->reader != NULL)) return LV_RESULT_OK;
+
+    if(!en) {
+        lv_atomic_store(&dsc->reader->exit, true);
+        lv_thread_delete(&dsc->reader->thread);
+        lv_free(dsc->reader);
+        dsc->reader = NULL;
+        return LV_RESULT_OK;
+    }
+
+    lv_evdev_reader_t * reader = lv_malloc_zeroed(sizeof(lv_evdev_reader_t));
+    LV_ASSERT_MALLOC(reader);
+    if(reader == NULL) return LV_RESULT_INVALID;
+
+    /*Continue from the current state, e.g. relative pointer movements are accumulated*/
+    reader->report.x = dsc->root_x;
+    reader->report.y = dsc->root_y;
+    reader->report.key = dsc->key;
+    reader->report.state = dsc->state;
+
+#ifdef EVIOCSCLOCKID
+    /*Timestamps are only compared to each other so use a clock which can't jump*/
+    int clk = CLOCK_MONOTONIC;
+    if(ioctl(dsc->fd, EVIOCSCLOCKID, &clk) < 0) {
+        LV_LOG_WARN("ioctl EVIOCSCLOCKID failed: %s", strerror(errno));
+    }
+#endif
+
+    dsc->reader = reader;
+    if(lv_thread_init(&reader->thread, LV_THREAD_PRIO_HIGH, _evdev_reader_thread, EVDEV_THREAD_STACK_SIZE,
+                      dsc) != LV_RESULT_OK) {
+        LV_LOG_ERROR("failed to create the reader thread");
+        dsc->reader = NULL;
+        lv_free(reader);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
 void lv_evdev_delete(lv_indev_t * indev)
 {
     lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
     LV_ASSERT_NULL(dsc);
+    lv_evdev_set_reader_thread(indev, false);
     close(dsc->fd);
     lv_free(dsc);
 
@@ -49,6 +49,18 @@ void lv_evdev_set_swap_axes(lv_indev_t * indev, bool swap_axes);
  */
 void lv_evdev_set_calibration(lv_indev_t * indev, int min_x, int min_y, int max_x, int max_y);
 
+/**
+ * Read the device in a dedicated thread instead of in the indev's read callback.
+ * The thread drains the device as soon as events arrive, time stamps them and queues
+ * them in a lock-free buffer, so the samples arriving between two reads are not lost.
+ * Pointer motion is coalesced to about one sample per read period.
+ * Requires `LV_USE_OS`.
+ * @param indev evdev input device
+ * @param en true: start the reader thread; false: stop it and read in the read callback again
+ * @return LV_RESULT_OK on success, LV_RESULT_INVALID if the thread couldn't be started
+ */
+lv_result_t lv_evdev_set_reader_thread(lv_indev_t * indev, bool en);
+
 /**
  * Remove evdev input device.
  * @param indev evdev input device to close and free
@@ -22,6 +22,7 @@ extern "C" {
 
 #include "display/drm/lv_linux_drm.h"
 #include "display/fb/lv_linux_fbdev.h"
+#include "display/remote_fb/lv_remote_fb.h"
 
 #include "display/tft_espi/lv_tft_espi.h"
 
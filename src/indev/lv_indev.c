@@ -80,6 +80,9 @@ static void indev_click_focus(lv_indev_t * indev);
 static void indev_gesture(lv_indev_t * indev);
 static bool indev_reset_check(lv_indev_t * indev);
 static void indev_read_core(lv_indev_t * indev, lv_indev_data_t * data);
+#if LV_USE_PERF_MONITOR
+static bool indev_data_changed(lv_indev_t * indev, const lv_indev_data_t * data);
+#endif
 static void indev_reset_core(lv_indev_t * indev, lv_obj_t * obj);
 static lv_result_t send_event(lv_event_code_t code, void * param);
 
@@ -238,6 +241,16 @@ void lv_indev_read(lv_indev_t * indev)
         indev_proc_reset_query_handler(indev);
         indev_obj_act = NULL;
 
+#if LV_USE_PERF_MONITOR
+        /*Remember when the first change which is not on the screen yet arrived
+         *to measure the input-to-photon latency*/
+        lv_sysmon_perf_info_t * perf_info = &indev->disp->perf_sysmon_info;
+        if(!perf_info->measured.input_pending && indev_data_changed(indev, &data)) {
+            perf_info->measured.input_pending = 1;
+            perf_info->measured.input_start = lv_tick_get();
+        }
+#endif
+
         indev->state = data.state;
 
         /*Save the last activity time*/
@@ -268,6 +281,14 @@ void lv_indev_read(lv_indev_t * indev)
     indev_act     = NULL;
     indev_obj_act = NULL;
 
+    /*Show the result of the input now if it changed anything*/
+    if(indev->immediate_refresh) {
+        lv_display_t * disp = indev->disp;
+        if(disp->inv_p > 0 || (disp->act_scr && disp->act_scr->scr_layout_inv)) {
+            lv_refr_now(disp);
+        }
+    }
+
     LV_TRACE_INDEV("finished");
     LV_PROFILER_INDEV_END;
 }
@@ -560,6 +581,20 @@ lv_indev_mode_t lv_indev_get_mode(lv_indev_t * indev)
     return LV_INDEV_MODE_NONE;
 }
 
+void lv_indev_set_immediate_refresh(lv_indev_t * indev, bool en)
+{
+    if(indev == NULL) return;
+
+    indev->immediate_refresh = en;
+}
+
+bool lv_indev_get_immediate_refresh(lv_indev_t * indev)
+{
+    if(indev == NULL) return false;
+
+    return indev->immediate_refresh;
+}
+
 void lv_indev_set_mode(lv_indev_t * indev, lv_indev_mode_t mode)
 {
     if(indev == NULL || indev->mode == mode)
@@ -1716,6 +1751,31 @@ static bool indev_stop_processing_check(lv_indev_t * indev)
     return indev->stop_processing_query;
 }
 
+#if LV_USE_PERF_MONITOR
+/**
+ * Check whether the read data differs from the previous read.
+ * Holding a pointer still or a key pressed is not a new input.
+ * @param indev     pointer to an input device
+ * @param data      the data just read from the input device
+ * @return          true: the state, the position, the key or the encoder changed
+ */
+static bool indev_data_changed(lv_indev_t * indev, const lv_indev_data_t * data)
+{
+    if(data->state != indev->state) return true;
+
+    switch(indev->type) {
+        case LV_INDEV_TYPE_POINTER:
+            return data->point.x != indev->pointer.last_raw_point.x || data->point.y != indev->pointer.last_raw_point.y;
+        case LV_INDEV_TYPE_KEYPAD:
+            return data->key != indev->keypad.last_key;
+        case LV_INDEV_TYPE_ENCODER:
+            return data->enc_diff != 0;
+        default:
+            return false;
+    }
+}
+#endif
+
 /**
  * Reset the indev and send event to active obj and scroll obj
  * @param indev pointer to an input device
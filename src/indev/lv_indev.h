@@ -382,6 +382,23 @@ void lv_indev_set_mode(lv_indev_t * indev, lv_indev_mode_t mode);
  */
 lv_indev_mode_t lv_indev_get_mode(lv_indev_t * indev);
 
+/**
+ * Refresh the display of the input device right after the input device was read
+ * if the input caused any change, instead of waiting for the display's refresh timer.
+ * It's useful with `LV_INDEV_MODE_EVENT` to render the result of an input
+ * as soon as the input event arrives.
+ * @param indev pointer to an input device
+ * @param en    true: refresh immediately; false: refresh on the next period of the refresh timer
+ */
+void lv_indev_set_immediate_refresh(lv_indev_t * indev, bool en);
+
+/**
+ * Get whether the display is refreshed right after reading the input device.
+ * @param indev pointer to an input device
+ * @return      true: refresh immediately; false: refresh on the next period of the refresh timer
+ */
+bool lv_indev_get_immediate_refresh(lv_indev_t * indev);
+
 /**
  * Search the most top, clickable object by a point
  * @param obj pointer to a start object, typically the screen
@@ -17,6 +17,7 @@
  *      DEFINES
  *********************/
 #define layout_list_def LV_GLOBAL_DEFAULT()->layout_list
+#define CACHE_TRACKS(cache) ((track_pos_t *)((cache) + 1))
 
 /**********************
  *      TYPEDEFS
@@ -49,6 +50,24 @@ typedef struct {
     uint32_t grow_dsc_calc : 1;
 } track_t;
 
+typedef struct {
+    int32_t first_item;     /*Index of the first item of the track*/
+    int32_t cross_pos;      /*Position of the track relative to the first track*/
+} track_pos_t;
+
+/*Saved in the container to place only the tracks from the first changed child on the next update*/
+typedef struct {
+    uint32_t layout;        /*Always `LV_LAYOUT_FLEX` to recognize the data of flex*/
+    flex_t f;
+    int32_t max_main_size;
+    int32_t item_gap;
+    int32_t track_gap;
+    uint32_t track_cnt;
+    uint32_t track_cap;
+    uint32_t valid : 1;
+    /*`track_cap` number of `track_pos_t` follow the header*/
+} flex_cache_t;
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -66,6 +85,11 @@ static void place_content(lv_flex_align_t place, int32_t max_size, int32_t conte
 static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id);
 static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj);
 static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj);
+static flex_cache_t * cache_get(lv_obj_t * cont, bool create);
+static bool cache_matches(const flex_cache_t * cache, const flex_t * f, int32_t max_main_size, int32_t item_gap,
+                          int32_t track_gap);
+static uint32_t cache_find_track(const flex_cache_t * cache, int32_t item_id);
+static flex_cache_t * cache_add_track(lv_obj_t * cont, flex_cache_t * cache, int32_t first_item, int32_t cross_pos);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -116,7 +140,7 @@ void lv_obj_set_flex_align(lv_obj_t * obj, lv_flex_align_t main_place, lv_flex_a
 void lv_obj_set_flex_grow(lv_obj_t * obj, uint8_t grow)
 {
     lv_obj_set_style_flex_grow(obj, grow, 0);
-    lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+    lv_obj_mark_layout_as_dirty_from(lv_obj_get_parent(obj), lv_obj_get_index(obj));
 }
 
 /**********************
@@ -154,6 +178,11 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
 
+    /*Can't wrap if the size is auto (i.e. the size depends on the children)*/
+    if(f.wrap && ((f.row && w_set == LV_SIZE_CONTENT) || (!f.row && h_set == LV_SIZE_CONTENT))) {
+        f.wrap = false;
+    }
+
     /*Content sized objects should squeeze the gap between the children, therefore any alignment will look like `START`*/
     if((f.row && h_set == LV_SIZE_CONTENT && cont->h_layout == 0) ||
        (!f.row && w_set == LV_SIZE_CONTENT && cont->w_layout == 0)) {
@@ -196,9 +225,55 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         *cross_pos += total_track_cross_size;
     }
 
+    /*The children before the first changed one keep their position.
+     *The tracks are independent of the next tracks only if they start from the top/left and not reversed.*/
+    uint32_t inv_child_id = cont->spec_attr->layout_inv_child_id;
+    cont->spec_attr->layout_inv_child_id = UINT32_MAX;
+
+    bool incremental = track_cross_place == LV_FLEX_ALIGN_START && !f.rev && !rtl;
+    flex_cache_t * cache = cache_get(cont, incremental);
+    int32_t cross_start = *cross_pos;
+    if(cache && !incremental) {
+        cache->valid = 0;
+        cache = NULL;
+    }
+
+    if(cache) {
+        if(cache->valid && cache_matches(cache, &f, max_main_size, item_gap, track_gap)) {
+            uint32_t track_id = cache->track_cnt;
+            if(inv_child_id != UINT32_MAX) {
+                /*The changed child might fit into the previous track*/
+                int32_t item_id = (int32_t)LV_MIN(inv_child_id, cont->spec_attr->child_cnt) - 1;
+                track_id = item_id < 0 ? 0 : cache_find_track(cache, item_id);
+            }
+
+            if(track_id < cache->track_cnt) {
+                track_first_item = CACHE_TRACKS(cache)[track_id].first_item;
+                *cross_pos = cross_start + CACHE_TRACKS(cache)[track_id].cross_pos;
+            }
+            else {
+                track_first_item = cont->spec_attr->child_cnt;   /*Nothing has changed*/
+            }
+            cache->track_cnt = track_id;
+            LV_TRACE_LAYOUT("place from track %d (item %d)", (int)track_id, (int)track_first_item);
+        }
+        else {
+            cache->track_cnt = 0;
+        }
+
+        cache->layout = LV_LAYOUT_FLEX;
+        cache->f = f;
+        cache->max_main_size = max_main_size;
+        cache->item_gap = item_gap;
+        cache->track_gap = track_gap;
+        cache->valid = 0;
+    }
+
     while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
         track_t t;
         t.grow_dsc_calc = 1;
+        if(cache) cache = cache_add_track(cont, cache, track_first_item, *cross_pos - cross_start);
+
         /*Search the first item of the next row*/
         next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
 
@@ -216,6 +291,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
             *cross_pos += t.track_cross_size + gap + track_gap;
         }
     }
+    if(cache) cache->valid = 1;
     LV_ASSERT_MEM_INTEGRITY();
 
     if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
@@ -229,17 +305,11 @@ static void flex_update(lv_obj_t * cont, void * user_data)
 
 /**
  * Find the last item of a track
+ * `f->wrap` is already cleared by `flex_update` if the container's main size is `LV_SIZE_CONTENT`
  */
 static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id, int32_t max_main_size,
                               int32_t item_gap, track_t * t)
 {
-    int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
-    int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
-
-    /*Can't wrap if the size is auto (i.e. the size depends on the children)*/
-    if(f->wrap && ((f->row && w_set == LV_SIZE_CONTENT) || (!f->row && h_set == LV_SIZE_CONTENT))) {
-        f->wrap = false;
-    }
     int32_t(*get_main_size)(const lv_obj_t *) = (f->row ? lv_obj_get_width_with_margin : lv_obj_get_height_with_margin);
     int32_t(*get_cross_size)(const lv_obj_t *) = (!f->row ? lv_obj_get_width_with_margin :
                                                   lv_obj_get_height_with_margin);
@@ -549,4 +619,83 @@ static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj)
            + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
 }
 
+/**
+ * Get the saved tracks of a container
+ * @param cont      pointer to a flex container
+ * @param create    true: allocate the data if the container doesn't have it yet
+ * @return          the saved tracks or NULL if not allocated (or the container has the data of an other layout)
+ */
+static flex_cache_t * cache_get(lv_obj_t * cont, bool create)
+{
+    flex_cache_t * cache = cont->spec_attr->layout_data;
+    if(cache && cache->layout != LV_LAYOUT_FLEX) {
+        if(!create) return NULL;
+        lv_free(cache);
+        cache = NULL;
+        cont->spec_attr->layout_data = NULL;
+    }
+
+    if(cache == NULL && create) {
+        cache = lv_malloc_zeroed(sizeof(flex_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        cache->layout = LV_LAYOUT_FLEX;
+        cont->spec_attr->layout_data = cache;
+    }
+
+    return cache;
+}
+
+static bool cache_matches(const flex_cache_t * cache, const flex_t * f, int32_t max_main_size, int32_t item_gap,
+                          int32_t track_gap)
+{
+    return cache->f.main_place == f->main_place && cache->f.cross_place == f->cross_place &&
+           cache->f.track_place == f->track_place && cache->f.row == f->row && cache->f.wrap == f->wrap &&
+           cache->f.rev == f->rev && cache->max_main_size == max_main_size &&
+           cache->item_gap == item_gap && cache->track_gap == track_gap;
+}
+
+/**
+ * Find the index of the saved track which contains an item
+ */
+static uint32_t cache_find_track(const flex_cache_t * cache, int32_t item_id)
+{
+    const track_pos_t * tracks = CACHE_TRACKS(cache);
+    uint32_t min = 0;
+    uint32_t max = cache->track_cnt;
+    while(max - min > 1) {
+        uint32_t mid = (min + max) / 2;
+        if(tracks[mid].first_item <= item_id) min = mid;
+        else max = mid;
+    }
+
+    return min;
+}
+
+/**
+ * Save the start of a track
+ * @return      the reallocated data or NULL if it couldn't be saved
+ */
+static flex_cache_t * cache_add_track(lv_obj_t * cont, flex_cache_t * cache, int32_t first_item, int32_t cross_pos)
+{
+    if(cache->track_cnt == cache->track_cap) {
+        uint32_t new_cap = cache->track_cap ? cache->track_cap * 2 : 8;
+        flex_cache_t * new_cache = lv_realloc(cache, sizeof(flex_cache_t) + new_cap * sizeof(track_pos_t));
+        if(new_cache == NULL) {
+            /*Place all the children next time*/
+            lv_free(cache);
+            cont->spec_attr->layout_data = NULL;
+            return NULL;
+        }
+        cache = new_cache;
+        cache->track_cap = new_cap;
+        cont->spec_attr->layout_data = cache;
+    }
+
+    CACHE_TRACKS(cache)[cache->track_cnt].first_item = first_item;
+    CACHE_TRACKS(cache)[cache->track_cnt].cross_pos = cross_pos;
+    cache->track_cnt++;
+    return cache;
+}
+
 #endif /*LV_USE_FLEX*/
@@ -26,6 +26,14 @@
 #define IS_CONTENT(x)  (x == LV_COORD_MAX - 101)
 #define GET_FR(x)      (x - (LV_COORD_MAX - 100))
 
+/**
+ * The saved template, sizes and positions of the columns (`row == false`) or rows (`row == true`)
+ */
+#define CACHE_CAP(cache, row)   ((row) ? (cache)->row_cap : (cache)->col_cap)
+#define CACHE_TEMPL(cache, row) ((int32_t *)((cache) + 1) + ((row) ? 3 * (cache)->col_cap : 0))
+#define CACHE_SIZE(cache, row)  (CACHE_TEMPL(cache, row) + CACHE_CAP(cache, row))
+#define CACHE_POS(cache, row)   (CACHE_TEMPL(cache, row) + 2 * CACHE_CAP(cache, row))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,6 +54,24 @@ typedef struct {
     int32_t grid_h;
 } lv_grid_calc_t;
 
+typedef struct {
+    uint32_t num;               /*Number of tracks*/
+    int32_t cont_size;          /*Content width or height of the container*/
+    int32_t gap;
+    uint32_t has_content : 1;   /*Any track is sized to the content*/
+    uint32_t valid : 1;
+} grid_tracks_t;
+
+/*Saved in the container to reuse the track sizes while neither the tracks nor the children change*/
+typedef struct {
+    uint32_t layout;            /*Always `LV_LAYOUT_GRID` to recognize the data of grid*/
+    uint32_t col_cap;
+    uint32_t row_cap;
+    grid_tracks_t cols;
+    grid_tracks_t rows;
+    /*The templates, sizes and positions of `col_cap` columns and of `row_cap` rows follow the header*/
+} grid_cache_t;
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -54,10 +80,11 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void grid_update(lv_obj_t * cont, void * user_data);
-static void calc(lv_obj_t * obj, lv_grid_calc_t * calc);
-static void calc_free(lv_grid_calc_t * calc);
-static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c);
-static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c);
+static bool calc(lv_obj_t * obj, lv_grid_calc_t * calc, bool child_changed);
+static const int32_t * get_templ(lv_obj_t * cont, bool row, uint32_t * num);
+static void calc_tracks(lv_obj_t * cont, grid_cache_t * cache, bool row, const int32_t * templ, uint32_t num,
+                        bool child_changed);
+static grid_cache_t * cache_get(lv_obj_t * cont, uint32_t col_num, uint32_t row_num);
 static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint);
 static int32_t grid_align(int32_t cont_size, bool auto_size, lv_grid_align_t align, int32_t gap,
                           uint32_t track_num,
@@ -189,29 +216,31 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     LV_LOG_INFO("update %p container", (void *)cont);
     LV_UNUSED(user_data);
 
-    //    const int32_t * col_templ = get_col_dsc(cont);
-    //    const int32_t * row_templ = get_row_dsc(cont);
-    //    if(col_templ == NULL || row_templ == NULL) return;
+    /*The sizes of the tracks are reused if neither the tracks nor the children have changed.
+     *Removing the last child marks the new number of children, a change of the container only
+     *(e.g. its size) marks `LV_OBJ_LAYOUT_INV_SELF`.*/
+    bool child_changed = cont->spec_attr->layout_inv_child_id <= cont->spec_attr->child_cnt;
+    cont->spec_attr->layout_inv_child_id = UINT32_MAX;
 
+    /*Without children or template there is nothing to place but the container's size might still depend on them*/
     lv_grid_calc_t c;
-    calc(cont, &c);
-
-    item_repos_hint_t hint;
-    lv_memzero(&hint, sizeof(hint));
-
-    /*Calculate the grids absolute x and y coordinates.
-     *It will be used as helper during item repositioning to avoid calculating this value for every children*/
-    int32_t pad_left = lv_obj_get_style_space_left(cont, LV_PART_MAIN);
-    int32_t pad_top = lv_obj_get_style_space_top(cont, LV_PART_MAIN);
-    hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
-    hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
-
-    uint32_t i;
-    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
-        lv_obj_t * item = cont->spec_attr->children[i];
-        item_repos(item, &c, &hint);
+    if(calc(cont, &c, child_changed)) {
+        item_repos_hint_t hint;
+        lv_memzero(&hint, sizeof(hint));
+
+        /*Calculate the grids absolute x and y coordinates.
+         *It will be used as helper during item repositioning to avoid calculating this value for every children*/
+        int32_t pad_left = lv_obj_get_style_space_left(cont, LV_PART_MAIN);
+        int32_t pad_top = lv_obj_get_style_space_top(cont, LV_PART_MAIN);
+        hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
+        hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
+
+        uint32_t i;
+        for(i = 0; i < cont->spec_attr->child_cnt; i++) {
+            lv_obj_t * item = cont->spec_attr->children[i];
+            item_repos(item, &c, &hint);
+        }
     }
-    calc_free(&c);
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
@@ -226,19 +255,33 @@ static void grid_update(lv_obj_t * cont, void * user_data)
 
 /**
  * Calculate the grid cells coordinates
- * @param cont an object that has a grid
- * @param calc store the calculated cells sizes here
- * @note `lv_grid_calc_free(calc_out)` needs to be called when `calc_out` is not needed anymore
+ * @param cont          an object that has a grid
+ * @param calc_out      store the calculated cells sizes here. The arrays are owned by the container.
+ * @param child_changed true: a child was added, deleted or changed since the last update
+ * @return              false: the grid can't be calculated
  */
-static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
+static bool calc(lv_obj_t * cont, lv_grid_calc_t * calc_out, bool child_changed)
 {
-    if(lv_obj_get_child(cont, 0) == NULL) {
-        lv_memzero(calc_out, sizeof(lv_grid_calc_t));
-        return;
-    }
+    if(lv_obj_get_child(cont, 0) == NULL) return false;
+
+    uint32_t col_num;
+    uint32_t row_num;
+    const int32_t * col_templ = get_templ(cont, false, &col_num);
+    const int32_t * row_templ = get_templ(cont, true, &row_num);
+    if(col_templ == NULL || row_templ == NULL || col_num == 0 || row_num == 0) return false;
 
-    calc_rows(cont, calc_out);
-    calc_cols(cont, calc_out);
+    grid_cache_t * cache = cache_get(cont, col_num, row_num);
+    if(cache == NULL) return false;
+
+    calc_tracks(cont, cache, false, col_templ, col_num, child_changed);
+    calc_tracks(cont, cache, true, row_templ, row_num, child_changed);
+
+    calc_out->col_num = col_num;
+    calc_out->row_num = row_num;
+    calc_out->x = CACHE_POS(cache, false);
+    calc_out->w = CACHE_SIZE(cache, false);
+    calc_out->y = CACHE_POS(cache, true);
+    calc_out->h = CACHE_SIZE(cache, true);
 
     int32_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
     int32_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
@@ -258,200 +301,171 @@ static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
                                   calc_out->y, false);
 
     LV_ASSERT_MEM_INTEGRITY();
+    return true;
 }
 
 /**
- * Free the a grid calculation's data
- * @param calc pointer to the calculated grid cell coordinates
+ * Get the column or row template of a container. Subgrids use a part of their parent's template.
+ * @param cont  an object that has a grid
+ * @param row   true: get the row template; false: get the column template
+ * @param num   store the number of tracks here
+ * @return      the template or NULL if there is no template even on the parent
  */
-static void calc_free(lv_grid_calc_t * calc)
+static const int32_t * get_templ(lv_obj_t * cont, bool row, uint32_t * num)
 {
-    lv_free(calc->x);
-    lv_free(calc->y);
-    lv_free(calc->w);
-    lv_free(calc->h);
+    const int32_t * templ = row ? get_row_dsc(cont) : get_col_dsc(cont);
+    if(templ) {
+        *num = count_tracks(templ);
+        return templ;
+    }
+
+    lv_obj_t * parent = lv_obj_get_parent(cont);
+    templ = row ? get_row_dsc(parent) : get_col_dsc(parent);
+    if(templ == NULL) {
+        LV_LOG_WARN("No %s descriptor found even on the parent", row ? "row" : "col");
+        return NULL;
+    }
+
+    uint32_t pos = row ? get_row_pos(cont) : get_col_pos(cont);
+    uint32_t span = row ? get_row_span(cont) : get_col_span(cont);
+    uint32_t parent_num = count_tracks(templ);
+    if(pos >= parent_num) {
+        *num = 0;
+        return templ;
+    }
+
+    *num = LV_MIN(span, parent_num - pos);
+    return &templ[pos];
 }
 
-static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
+/**
+ * Calculate the sizes of the columns or rows unless the saved ones are still valid.
+ * Only the content sized tracks depend on the children.
+ * @param cont          an object that has a grid
+ * @param cache         the saved tracks of `cont`
+ * @param row           true: calculate the rows; false: calculate the columns
+ * @param templ         the column or row template
+ * @param num           number of tracks in `templ`
+ * @param child_changed true: a child was added, deleted or changed since the last update
+ */
+static void calc_tracks(lv_obj_t * cont, grid_cache_t * cache, bool row, const int32_t * templ, uint32_t num,
+                        bool child_changed)
 {
+    grid_tracks_t * t = row ? &cache->rows : &cache->cols;
+    int32_t * saved_templ = CACHE_TEMPL(cache, row);
+    int32_t * size = CACHE_SIZE(cache, row);
+    int32_t cont_size = row ? lv_obj_get_content_height(cont) : lv_obj_get_content_width(cont);
+    int32_t gap = row ? lv_obj_get_style_pad_row(cont, LV_PART_MAIN) : lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
+
+    if(t->valid && t->num == num && t->cont_size == cont_size && t->gap == gap &&
+       !(t->has_content && child_changed) && lv_memcmp(saved_templ, templ, num * sizeof(int32_t)) == 0) {
+        LV_TRACE_LAYOUT("reuse the %s sizes", row ? "row" : "column");
+        return;
+    }
 
-    const int32_t * col_templ;
-    col_templ = get_col_dsc(cont);
-    bool subgrid = false;
-    if(col_templ == NULL) {
-        lv_obj_t * parent = lv_obj_get_parent(cont);
-        col_templ = get_col_dsc(parent);
-        if(col_templ == NULL) {
-            LV_LOG_WARN("No col descriptor found even on the parent");
-            return;
-        }
-
-        int32_t pos = get_col_pos(cont);
-        int32_t span = get_col_span(cont);
+    lv_memcpy(saved_templ, templ, num * sizeof(int32_t));
+    t->num = num;
+    t->cont_size = cont_size;
+    t->gap = gap;
+    t->has_content = 0;
 
-        int32_t * col_templ_sub = lv_malloc(sizeof(int32_t) * (span + 1));
-        lv_memcpy(col_templ_sub, &col_templ[pos], sizeof(int32_t) * span);
-        col_templ_sub[span] = LV_GRID_TEMPLATE_LAST;
-        col_templ = col_templ_sub;
-        subgrid = true;
+    uint32_t i;
+    for(i = 0; i < num; i++) {
+        if(IS_CONTENT(templ[i])) {
+            size[i] = 0;
+            t->has_content = 1;
+        }
     }
 
-    int32_t cont_w = lv_obj_get_content_width(cont);
+    /*Set sizes for CONTENT cells from the children in a single cell of them*/
+    if(t->has_content) {
+        uint32_t child_cnt = lv_obj_get_child_count(cont);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * item = cont->spec_attr->children[i];
+            if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+            uint32_t span = row ? get_row_span(item) : get_col_span(item);
+            if(span != 1) continue;
 
-    c->col_num = count_tracks(col_templ);
-    c->x = lv_malloc(sizeof(int32_t) * c->col_num);
-    c->w = lv_malloc(sizeof(int32_t) * c->col_num);
+            uint32_t pos = row ? get_row_pos(item) : get_col_pos(item);
+            if(pos >= num || !IS_CONTENT(templ[pos])) continue;
 
-    /*Set sizes for CONTENT cells*/
-    uint32_t i;
-    for(i = 0; i < c->col_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
-            }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
+            size[pos] = LV_MAX(size[pos], row ? lv_obj_get_height(item) : lv_obj_get_width(item));
         }
     }
 
-    uint32_t col_fr_cnt = 0;
-    int32_t grid_w = 0;
+    uint32_t fr_cnt = 0;
+    int32_t grid_size = 0;
 
-    for(i = 0; i < c->col_num; i++) {
-        int32_t x = col_templ[i];
+    for(i = 0; i < num; i++) {
+        int32_t x = templ[i];
         if(IS_FR(x)) {
-            col_fr_cnt += GET_FR(x);
+            fr_cnt += GET_FR(x);
         }
         else if(IS_CONTENT(x)) {
-            grid_w += c->w[i];
+            grid_size += size[i];
         }
         else {
-            c->w[i] = x;
-            grid_w += x;
+            size[i] = x;
+            grid_size += x;
         }
     }
 
-    int32_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
-    cont_w -= col_gap * (c->col_num - 1);
-    int32_t free_w = cont_w - grid_w;
-    if(free_w < 0) free_w = 0;
+    int32_t free_size = cont_size - gap * (num - 1) - grid_size;
+    if(free_size < 0) free_size = 0;
 
-    for(i = 0; i < c->col_num && col_fr_cnt; i++) {
-        int32_t x = col_templ[i];
+    for(i = 0; i < num && fr_cnt; i++) {
+        int32_t x = templ[i];
         if(IS_FR(x)) {
             int32_t f = GET_FR(x);
-            c->w[i] = lv_div_round_closest(free_w * f, col_fr_cnt);
-            /*By updating remaining fr and width, we ensure f == col_fr_cnt
+            size[i] = lv_div_round_closest(free_size * f, fr_cnt);
+            /*By updating remaining fr and size, we ensure f == fr_cnt
              *in the last loop iteration. That means the last iteration will
              *not have rounding errors and use all remaining space.*/
-            col_fr_cnt -= f;
-            free_w -= c->w[i];
+            fr_cnt -= f;
+            free_size -= size[i];
         }
     }
 
-    if(subgrid) {
-        lv_free((void *)col_templ);
-    }
+    t->valid = 1;
 }
 
-static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
+/**
+ * Get the saved tracks of a grid container
+ * @param cont      an object that has a grid
+ * @param col_num   number of columns to save
+ * @param row_num   number of rows to save
+ * @return          the saved tracks or NULL on out of memory
+ */
+static grid_cache_t * cache_get(lv_obj_t * cont, uint32_t col_num, uint32_t row_num)
 {
-    const int32_t * row_templ;
-    row_templ = get_row_dsc(cont);
-    bool subgrid = false;
-    if(row_templ == NULL) {
-        lv_obj_t * parent = lv_obj_get_parent(cont);
-        row_templ = get_row_dsc(parent);
-        if(row_templ == NULL) {
-            LV_LOG_WARN("No row descriptor found even on the parent");
-            return;
-        }
-
-        int32_t pos = get_row_pos(cont);
-        int32_t span = get_row_span(cont);
-
-        int32_t * row_templ_sub = lv_malloc(sizeof(int32_t) * (span + 1));
-        lv_memcpy(row_templ_sub, &row_templ[pos], sizeof(int32_t) * span);
-        row_templ_sub[span] = LV_GRID_TEMPLATE_LAST;
-        row_templ = row_templ_sub;
-        subgrid = true;
+    grid_cache_t * cache = cont->spec_attr->layout_data;
+    if(cache && cache->layout != LV_LAYOUT_GRID) {
+        lv_free(cache);
+        cache = NULL;
+        cont->spec_attr->layout_data = NULL;
     }
 
-    c->row_num = count_tracks(row_templ);
-    c->y = lv_malloc(sizeof(int32_t) * c->row_num);
-    c->h = lv_malloc(sizeof(int32_t) * c->row_num);
-    /*Set sizes for CONTENT cells*/
-    uint32_t i;
-    for(i = 0; i < c->row_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
-            }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
-        }
+    if(cache && cache->col_cap >= col_num && cache->row_cap >= row_num) return cache;
+
+    /*The rows are moved in the new buffer so calculate everything again*/
+    uint32_t col_cap = cache ? LV_MAX(cache->col_cap, col_num) : col_num;
+    uint32_t row_cap = cache ? LV_MAX(cache->row_cap, row_num) : row_num;
+    size_t size = sizeof(grid_cache_t) + 3 * (col_cap + row_cap) * sizeof(int32_t);
+    grid_cache_t * new_cache = cache ? lv_realloc(cache, size) : lv_malloc(size);
+    LV_ASSERT_MALLOC(new_cache);
+    if(new_cache == NULL) {
+        lv_free(cache);
+        cont->spec_attr->layout_data = NULL;
+        return NULL;
     }
 
-    uint32_t row_fr_cnt = 0;
-    int32_t grid_h = 0;
-
-    for(i = 0; i < c->row_num; i++) {
-        int32_t x = row_templ[i];
-        if(IS_FR(x)) {
-            row_fr_cnt += GET_FR(x);
-        }
-        else if(IS_CONTENT(x)) {
-            grid_h += c->h[i];
-        }
-        else {
-            c->h[i] = x;
-            grid_h += x;
-        }
-    }
-
-    int32_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
-    int32_t cont_h = lv_obj_get_content_height(cont) - row_gap * (c->row_num - 1);
-    int32_t free_h = cont_h - grid_h;
-    if(free_h < 0) free_h = 0;
-
-    for(i = 0; i < c->row_num && row_fr_cnt; i++) {
-        int32_t x = row_templ[i];
-        if(IS_FR(x)) {
-            int32_t f = GET_FR(x);
-            c->h[i] = lv_div_round_closest(free_h * f, row_fr_cnt);
-            /*By updating remaining fr and height, we ensure f == row_fr_cnt
-             *in the last loop iteration. That means the last iteration will
-             *not have rounding errors and use all remaining space.*/
-            row_fr_cnt -= f;
-            free_h -= c->h[i];
-        }
-    }
-
-    if(subgrid) {
-        lv_free((void *)row_templ);
-    }
+    new_cache->layout = LV_LAYOUT_GRID;
+    new_cache->col_cap = col_cap;
+    new_cache->row_cap = row_cap;
+    new_cache->cols.valid = 0;
+    new_cache->rows.valid = 0;
+    cont->spec_attr->layout_data = new_cache;
+    return new_cache;
 }
 
 /**
@@ -42,6 +42,7 @@ static bool freetype_image_create_cb(lv_freetype_image_cache_data_t * data, void
 static void freetype_image_free_cb(lv_freetype_image_cache_data_t * node, void * user_data);
 static lv_cache_compare_res_t freetype_image_compare_cb(const lv_freetype_image_cache_data_t * lhs,
                                                         const lv_freetype_image_cache_data_t * rhs);
+static uint32_t freetype_image_hash_cb(const lv_freetype_image_cache_data_t * key);
 
 static void freetype_image_release_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
 /**********************
@@ -62,9 +63,10 @@ lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_size)
         .compare_cb = (lv_cache_compare_cb_t)freetype_image_compare_cb,
         .create_cb = (lv_cache_create_cb_t)freetype_image_create_cb,
         .free_cb = (lv_cache_free_cb_t)freetype_image_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)freetype_image_hash_cb,
     };
 
-    lv_cache_t * draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_image_cache_data_t),
+    lv_cache_t * draw_data_cache = lv_cache_create(LV_CACHE_CLASS_DEF_COUNT, sizeof(lv_freetype_image_cache_data_t),
                                                    cache_size, ops);
     lv_cache_set_name(draw_data_cache, CACHE_NAME);
 
@@ -210,4 +212,9 @@ static lv_cache_compare_res_t freetype_image_compare_cb(const lv_freetype_image_
     return 0;
 }
 
+static uint32_t freetype_image_hash_cb(const lv_freetype_image_cache_data_t * key)
+{
+    return (uint32_t)key->glyph_index ^ ((uint32_t)key->size << 21);
+}
+
 #endif /*LV_USE_FREETYPE*/
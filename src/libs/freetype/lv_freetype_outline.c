@@ -45,6 +45,7 @@ static bool freetype_glyph_outline_create_cb(lv_freetype_outline_node_t * node,
 static void freetype_glyph_outline_free_cb(lv_freetype_outline_node_t * node, lv_freetype_font_dsc_t * dsc);
 static lv_cache_compare_res_t freetype_glyph_outline_cmp_cb(const lv_freetype_outline_node_t * node_a,
                                                             const lv_freetype_outline_node_t * node_b);
+static uint32_t freetype_glyph_outline_hash_cb(const lv_freetype_outline_node_t * node);
 
 /**********************
  *  STATIC VARIABLES
@@ -64,9 +65,10 @@ lv_cache_t * lv_freetype_create_draw_data_outline(uint32_t cache_size)
         .create_cb = (lv_cache_create_cb_t)freetype_glyph_outline_create_cb,
         .free_cb = (lv_cache_free_cb_t)freetype_glyph_outline_free_cb,
         .compare_cb = (lv_cache_compare_cb_t)freetype_glyph_outline_cmp_cb,
+        .hash_cb = (lv_cache_hash_cb_t)freetype_glyph_outline_hash_cb,
     };
 
-    lv_cache_t * draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_outline_node_t),
+    lv_cache_t * draw_data_cache = lv_cache_create(LV_CACHE_CLASS_DEF_COUNT, sizeof(lv_freetype_outline_node_t),
                                                    cache_size,
                                                    glyph_outline_cache_ops);
     lv_cache_set_name(draw_data_cache, CACHE_NAME);
@@ -161,6 +163,11 @@ static lv_cache_compare_res_t freetype_glyph_outline_cmp_cb(const lv_freetype_ou
     return node_a->glyph_index > node_b->glyph_index ? 1 : -1;
 }
 
+static uint32_t freetype_glyph_outline_hash_cb(const lv_freetype_outline_node_t * node)
+{
+    return (uint32_t)node->glyph_index;
+}
+
 static const void * freetype_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
 {
     LV_UNUSED(draw_buf);
@@ -203,6 +203,18 @@
         #endif
     #endif
 
+    /** With `LV_USE_OS` every thread can keep up to this many freed small blocks (<= 256 bytes)
+     *  per size class to serve its next allocations without locking the heap.
+     *  The blocks are returned to the heap in batches and every block gets a 4 or 8 bytes header.
+     *  0: disable */
+    #ifndef LV_MEM_THREAD_CACHE_CNT
+        #ifdef CONFIG_LV_MEM_THREAD_CACHE_CNT
+            #define LV_MEM_THREAD_CACHE_CNT CONFIG_LV_MEM_THREAD_CACHE_CNT
+        #else
+            #define LV_MEM_THREAD_CACHE_CNT 0
+        #endif
+    #endif
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #ifndef LV_MEM_ADR
         #ifdef CONFIG_LV_MEM_ADR
@@ -366,6 +378,43 @@
     #endif
 #endif
 
+/** Keep the buffers of the finished layers in a pool and reuse them for the next layers
+ * instead of allocating and freeing a buffer for each layer.
+ * The pool holds at most this many bytes of unused buffers. Buffers not reused for a while are freed.
+ * Set it to 0 to disable the pool. */
+#ifndef LV_DRAW_LAYER_POOL_SIZE
+    #ifdef CONFIG_LV_DRAW_LAYER_POOL_SIZE
+        #define LV_DRAW_LAYER_POOL_SIZE CONFIG_LV_DRAW_LAYER_POOL_SIZE
+    #else
+        #define LV_DRAW_LAYER_POOL_SIZE 0  /**< [bytes]*/
+    #endif
+#endif
+
+/** Before rendering an area collect the opaque areas of the widgets drawn later
+ * and skip the widgets and draw tasks which are fully covered by them.
+ * It saves rendering time with overlapping opaque widgets but adds some overhead to each area.
+ * Set it to 0 to disable occlusion culling. */
+#ifndef LV_DRAW_OCCLUSION_MAX_AREAS
+    #ifdef CONFIG_LV_DRAW_OCCLUSION_MAX_AREAS
+        #define LV_DRAW_OCCLUSION_MAX_AREAS CONFIG_LV_DRAW_OCCLUSION_MAX_AREAS
+    #else
+        #define LV_DRAW_OCCLUSION_MAX_AREAS 0
+    #endif
+#endif
+
+/** Allocate the draw tasks and their descriptors from a bump allocator which is reset
+ * after each rendered area instead of allocating and freeing them one by one on the heap.
+ * It's the size of the arena's first chunk which is kept between the areas. If an area needs more,
+ * additional chunks are allocated and freed when the area is rendered.
+ * Set it to 0 to disable the arena. */
+#ifndef LV_DRAW_FRAME_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_FRAME_ARENA_SIZE
+        #define LV_DRAW_FRAME_ARENA_SIZE CONFIG_LV_DRAW_FRAME_ARENA_SIZE
+    #else
+        #define LV_DRAW_FRAME_ARENA_SIZE 0  /**< [bytes]*/
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -546,7 +595,7 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /** Allow buffering some shadow calculation.
          *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
+         *  `shadow_width + radius`.  Caching a shadow has `2 * shadow_size^2` RAM cost. */
         #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
             #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
                 #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -555,6 +604,16 @@
             #endif
         #endif
 
+        /** Number of shadows (with different width, radius or small size) to cache
+         *  if LV_DRAW_SW_SHADOW_CACHE_SIZE > 0. */
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_CNT
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+                #define LV_DRAW_SW_SHADOW_CACHE_CNT CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+            #else
+                #define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+            #endif
+        #endif
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -568,6 +627,17 @@
         #endif
     #endif
 
+    /** Number of cached gradient color maps (the most recently used ones are kept).
+     *  A map uses `(width or height) * 4` bytes. Complex gradients use 256 sized maps.
+     *  - 0: disables caching */
+    #ifndef LV_DRAW_SW_GRADIENT_CACHE_CNT
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_CACHE_CNT
+            #define LV_DRAW_SW_GRADIENT_CACHE_CNT CONFIG_LV_DRAW_SW_GRADIENT_CACHE_CNT
+        #else
+            #define LV_DRAW_SW_GRADIENT_CACHE_CNT 4
+        #endif
+    #endif
+
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -1216,6 +1286,34 @@
     #endif
 #endif
 
+/** Number of independently locked shards of the image and image header caches.
+ *  With several draw units or decoder threads, lookups in different shards don't block each other.
+ *  Each shard can hold `1 / LV_CACHE_SHARD_CNT` of the cache size, so the largest decoded image
+ *  has to fit into `LV_CACHE_DEF_SIZE / LV_CACHE_SHARD_CNT`.
+ *  - 1: not sharded */
+#ifndef LV_CACHE_SHARD_CNT
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_CACHE_SHARD_CNT
+            #define LV_CACHE_SHARD_CNT CONFIG_LV_CACHE_SHARD_CNT
+        #else
+            #define LV_CACHE_SHARD_CNT 0
+        #endif
+    #else
+        #define LV_CACHE_SHARD_CNT 1
+    #endif
+#endif
+
+/** Use the scan resistant 2Q policy instead of LRU in the image, image header, FreeType and Tiny TTF caches.
+ *  Images and glyphs used only once (e.g. while scrolling through a long list) don't evict
+ *  the frequently used ones. See `lv_cache_class_2q_count/size`. */
+#ifndef LV_CACHE_USE_2Q
+    #ifdef CONFIG_LV_CACHE_USE_2Q
+        #define LV_CACHE_USE_2Q CONFIG_LV_CACHE_USE_2Q
+    #else
+        #define LV_CACHE_USE_2Q 0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -3174,6 +3272,15 @@
         #endif
     #endif
 
+    /** Profiler function to record the value of a counter */
+    #ifndef LV_PROFILER_COUNTER
+        #ifdef CONFIG_LV_PROFILER_COUNTER
+            #define LV_PROFILER_COUNTER CONFIG_LV_PROFILER_COUNTER
+        #else
+            #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+        #endif
+    #endif
+
     /*Enable layout profiler*/
     #ifndef LV_PROFILER_LAYOUT
         #ifdef LV_KCONFIG_PRESENT
@@ -3682,6 +3789,24 @@
     #endif
 #endif
 
+/** Headless display which streams the rendered areas to a client over a local TCP socket */
+#ifndef LV_USE_REMOTE_FB
+    #ifdef CONFIG_LV_USE_REMOTE_FB
+        #define LV_USE_REMOTE_FB CONFIG_LV_USE_REMOTE_FB
+    #else
+        #define LV_USE_REMOTE_FB        0
+    #endif
+#endif
+#if LV_USE_REMOTE_FB
+    #ifndef LV_REMOTE_FB_BUFFER_SIZE
+        #ifdef CONFIG_LV_REMOTE_FB_BUFFER_SIZE
+            #define LV_REMOTE_FB_BUFFER_SIZE CONFIG_LV_REMOTE_FB_BUFFER_SIZE
+        #else
+            #define LV_REMOTE_FB_BUFFER_SIZE    60  /**< Number of rows in the draw buffer */
+        #endif
+    #endif
+#endif
+
 /** Use Nuttx to open window and handle touchscreen */
 #ifndef LV_USE_NUTTX
     #ifdef CONFIG_LV_USE_NUTTX
@@ -4165,6 +4290,12 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
     #define LV_USE_MEM_MONITOR 0
 #endif /*LV_USE_SYSMON*/
 
+/*An older Kconfig without LV_CACHE_SHARD_CNT leaves it 0. Don't shard in this case.*/
+#if LV_CACHE_SHARD_CNT < 1
+    #undef LV_CACHE_SHARD_CNT
+    #define LV_CACHE_SHARD_CNT 1
+#endif
+
 #ifndef LV_USE_LZ4
     #define LV_USE_LZ4  (LV_USE_LZ4_INTERNAL || LV_USE_LZ4_EXTERNAL)
 #endif
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_cache.h"
 #include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
 #include "../lv_assert.h"
 #include "lv_cache_entry_private.h"
 #include "lv_cache_private.h"
@@ -26,6 +27,8 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_t * get_shard(lv_cache_t * cache, const void * key);
+static size_t get_shard_size(size_t size, uint32_t shard_cnt);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -55,6 +58,7 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    lv_memzero(&cache->stats, sizeof(lv_cache_stats_t));
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -67,10 +71,61 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     return cache;
 }
 
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size, uint32_t shard_cnt,
+                                     lv_cache_ops_t ops)
+{
+    if(shard_cnt <= 1) return lv_cache_create(cache_class, node_size, max_size, ops);
+
+    LV_ASSERT_NULL(ops.hash_cb);
+    if(ops.hash_cb == NULL) {
+        LV_LOG_WARN("hash_cb is required for sharding");
+        return lv_cache_create(cache_class, node_size, max_size, ops);
+    }
+
+    lv_cache_t * cache = lv_malloc_zeroed(sizeof(lv_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+
+    cache->shards = lv_malloc_zeroed(shard_cnt * sizeof(lv_cache_t *));
+    LV_ASSERT_MALLOC(cache->shards);
+    if(cache->shards == NULL) {
+        lv_free(cache);
+        return NULL;
+    }
+
+    cache->clz = cache_class;
+    cache->node_size = node_size;
+    cache->max_size = max_size;
+    cache->ops = ops;
+    cache->shard_cnt = shard_cnt;
+
+    uint32_t i;
+    for(i = 0; i < shard_cnt; i++) {
+        cache->shards[i] = lv_cache_create(cache_class, node_size, get_shard_size(max_size, shard_cnt), ops);
+        if(cache->shards[i] == NULL) {
+            lv_cache_destroy(cache, NULL);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
 void lv_cache_destroy(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            if(cache->shards[i]) lv_cache_destroy(cache->shards[i], user_data);
+        }
+        lv_free(cache->shards);
+        lv_free(cache);
+        return;
+    }
+
     lv_mutex_lock(&cache->lock);
     cache->clz->destroy_cb(cache, user_data);
     lv_mutex_unlock(&cache->lock);
@@ -83,11 +138,14 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) return lv_cache_acquire(get_shard(cache, key), key, user_data);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
 
     if(cache->size == 0) {
+        cache->stats.miss_cnt++;
         lv_mutex_unlock(&cache->lock);
 
         LV_PROFILER_CACHE_END;
@@ -97,6 +155,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->stats.hit_cnt++;
+    }
+    else {
+        cache->stats.miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -109,14 +171,25 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
-    lv_cache_entry_release_data(entry, user_data);
+    /*The entry belongs to one of the shards*/
+    if(cache->shards) cache = (lv_cache_t *)lv_cache_entry_get_cache(entry);
 
-    if(lv_cache_entry_get_ref(entry) == 0 && lv_cache_entry_is_invalid(entry)) {
+#if LV_ATOMIC_AVAILABLE
+    /*Releasing doesn't block other threads, only freeing an invalidated entry needs the lock*/
+    if(lv_cache_entry_release_data(entry, user_data)) {
+        lv_mutex_lock(&cache->lock);
+        cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
+        lv_cache_entry_delete(entry);
+        lv_mutex_unlock(&cache->lock);
+    }
+#else
+    lv_mutex_lock(&cache->lock);
+    if(lv_cache_entry_release_data(entry, user_data)) {
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
         lv_cache_entry_delete(entry);
     }
     lv_mutex_unlock(&cache->lock);
+#endif
 
     LV_PROFILER_CACHE_END;
 }
@@ -125,6 +198,8 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) return lv_cache_add(get_shard(cache, key), key, user_data);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -149,6 +224,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) return lv_cache_acquire_or_create(get_shard(cache, key), key, user_data);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -158,6 +235,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache->stats.hit_cnt++;
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_CACHE_END;
@@ -165,6 +243,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         }
     }
 
+    cache->stats.miss_cnt++;
+
     if(cache->max_size == 0) {
         lv_mutex_unlock(&cache->lock);
 
@@ -197,6 +277,14 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_reserve(cache->shards[i], get_shard_size(reserved_size, cache->shard_cnt), user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
@@ -211,6 +299,11 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) {
+        lv_cache_drop(get_shard(cache, key), key, user_data);
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -223,6 +316,21 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        /*Evict from the fullest shard first*/
+        uint32_t i;
+        uint32_t fullest = 0;
+        for(i = 1; i < cache->shard_cnt; i++) {
+            if(cache->shards[i]->size > cache->shards[fullest]->size) fullest = i;
+        }
+        if(lv_cache_evict_one(cache->shards[fullest], user_data)) return true;
+
+        for(i = 0; i < cache->shard_cnt; i++) {
+            if(i != fullest && cache->shards[i]->size > 0 && lv_cache_evict_one(cache->shards[i], user_data)) return true;
+        }
+        return false;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -236,6 +344,14 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_drop_all(cache->shards[i], user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -249,6 +365,11 @@ void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data
 {
     LV_UNUSED(user_data);
     cache->max_size = max_size;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_max_size(cache->shards[i], get_shard_size(max_size, cache->shard_cnt), user_data);
+    }
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -258,12 +379,18 @@ size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 size_t lv_cache_get_size(lv_cache_t * cache, void * user_data)
 {
     LV_UNUSED(user_data);
-    return cache->size;
+    if(cache->shards == NULL) return cache->size;
+
+    size_t size = 0;
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        size += cache->shards[i]->size;
+    }
+    return size;
 }
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
-    return cache->max_size - cache->size;
+    return cache->max_size - lv_cache_get_size(cache, user_data);
 }
 bool lv_cache_is_enabled(lv_cache_t * cache)
 {
@@ -273,31 +400,95 @@ void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_c
 {
     LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_compare_cb(cache->shards[i], compare_cb, user_data);
+    }
 }
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.create_cb = alloc_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_create_cb(cache->shards[i], alloc_cb, user_data);
+    }
 }
 void lv_cache_set_free_cb(lv_cache_t * cache, lv_cache_free_cb_t free_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.free_cb = free_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_free_cb(cache->shards[i], free_cb, user_data);
+    }
 }
 void lv_cache_set_name(lv_cache_t * cache, const char * name)
 {
     if(cache == NULL) return;
     cache->name = name;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_name(cache->shards[i], name);
+    }
 }
 const char * lv_cache_get_name(lv_cache_t * cache)
 {
     return cache->name;
 }
 
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+
+    if(cache->shards == NULL) {
+        lv_mutex_lock(&cache->lock);
+        *stats = cache->stats;
+        lv_mutex_unlock(&cache->lock);
+        return;
+    }
+
+    lv_memzero(stats, sizeof(lv_cache_stats_t));
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_stats_t shard_stats;
+        lv_cache_get_stats(cache->shards[i], &shard_stats);
+        stats->hit_cnt += shard_stats.hit_cnt;
+        stats->miss_cnt += shard_stats.miss_cnt;
+        stats->evict_cnt += shard_stats.evict_cnt;
+    }
+}
+
+void lv_cache_reset_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache->shards == NULL) {
+        lv_mutex_lock(&cache->lock);
+        lv_memzero(&cache->stats, sizeof(lv_cache_stats_t));
+        lv_mutex_unlock(&cache->lock);
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_reset_stats(cache->shards[i]);
+    }
+}
+
 lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
 {
     LV_ASSERT_NULL(cache);
     if(cache == NULL || cache->clz->iter_create_cb == NULL) return NULL;
+    if(cache->shards) {
+        LV_LOG_WARN("Iterating sharded caches is not supported");
+        return NULL;
+    }
     return cache->clz->iter_create_cb(cache);
 }
 
@@ -312,15 +503,13 @@ static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, vo
         return;
     }
 
-    if(lv_cache_entry_get_ref(entry) == 0) {
-        cache->clz->remove_cb(cache, entry, user_data);
+    cache->clz->remove_cb(cache, entry, user_data);
+
+    /*If the entry is still referenced the last `lv_cache_release` will free it*/
+    if(lv_cache_entry_invalidate(entry)) {
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
         lv_cache_entry_delete(entry);
     }
-    else {
-        lv_cache_entry_set_invalid(entry, true);
-        cache->clz->remove_cb(cache, entry, user_data);
-    }
 }
 
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data)
@@ -335,6 +524,7 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
     cache->clz->remove_cb(cache, victim, user_data);
     cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
     lv_cache_entry_delete(victim);
+    cache->stats.evict_cnt++;
     return true;
 }
 
@@ -355,3 +545,20 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+static lv_cache_t * get_shard(lv_cache_t * cache, const void * key)
+{
+    uint32_t hash = cache->ops.hash_cb(key);
+
+    /*Mix the bits as the low bits of e.g. hashed addresses are often the same*/
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+
+    return cache->shards[hash % cache->shard_cnt];
+}
+
+static size_t get_shard_size(size_t size, uint32_t shard_cnt)
+{
+    return (size + shard_cnt - 1) / shard_cnt;
+}
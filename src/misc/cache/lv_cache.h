@@ -17,6 +17,7 @@ extern "C" {
 #include "../lv_types.h"
 
 #include "lv_cache_lru_rb.h"
+#include "lv_cache_2q.h"
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
@@ -25,6 +26,15 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*The classes of the built-in image and font caches, see `LV_CACHE_USE_2Q`*/
+#if LV_CACHE_USE_2Q
+#define LV_CACHE_CLASS_DEF_COUNT    (&lv_cache_class_2q_count)
+#define LV_CACHE_CLASS_DEF_SIZE     (&lv_cache_class_2q_size)
+#else
+#define LV_CACHE_CLASS_DEF_COUNT    (&lv_cache_class_lru_rb_count)
+#define LV_CACHE_CLASS_DEF_SIZE     (&lv_cache_class_lru_rb_size)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,13 +45,18 @@ extern "C" {
 
 /**
  * Create a cache object with the given parameters.
- * @param cache_class   The class of the cache. Currently only support one two builtin classes:
+ * @param cache_class   The class of the cache. The builtin classes are:
  *                        - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  *                        - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ *                        - lv_cache_class_2q_count for 2Q cache with count-based eviction policy.
+ *                        - lv_cache_class_2q_size for 2Q cache with size-based eviction policy.
+ *                      2Q keeps the entries used only once in a small FIFO queue so that e.g. scrolling
+ *                      through a long list doesn't evict the frequently used entries. If `ops.hash_cb`
+ *                      is set, it also remembers the recently evicted keys to recognize the reused ones.
  * @param node_size     The node size is the size of the data stored in the cache..
  * @param max_size      The max size is the maximum amount of memory or count that the cache can hold.
- *                        - lv_cache_class_lru_rb_count: max_size is the maximum count of nodes in the cache.
- *                        - lv_cache_class_lru_rb_size: max_size is the maximum size of the cache in bytes.
+ *                        - lv_cache_class_*_count: max_size is the maximum count of nodes in the cache.
+ *                        - lv_cache_class_*_size: max_size is the maximum size of the cache in bytes.
  * @param ops           A set of operations that can be performed on the cache. See lv_cache_ops_t for details.
  * @return              Returns a pointer to the created cache object on success, `NULL` on error.
  */
@@ -49,6 +64,22 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
                              size_t node_size, size_t max_size,
                              lv_cache_ops_t ops);
 
+/**
+ * Create a cache object which consists of `shard_cnt` independent caches, each with its own lock.
+ * The keys are distributed among the shards by `ops.hash_cb`, so threads accessing different
+ * shards don't block each other. Each shard can hold `max_size / shard_cnt`.
+ * Sharded caches can't be iterated.
+ * @param cache_class   The class of the shards. See `lv_cache_create`.
+ * @param node_size     The node size is the size of the data stored in the cache.
+ * @param max_size      The maximum amount of memory or count that the cache can hold in total.
+ * @param shard_cnt     Number of shards. If <= 1 a normal cache is created.
+ * @param ops           A set of operations that can be performed on the cache. `hash_cb` is required.
+ * @return              Returns a pointer to the created cache object on success, `NULL` on error.
+ */
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size, uint32_t shard_cnt,
+                                     lv_cache_ops_t ops);
+
 /**
  * Destroy a cache object.
  * @param cache         The cache object pointer to destroy.
@@ -215,6 +246,20 @@ void lv_cache_set_name(lv_cache_t * cache, const char * name);
  */
 const char * lv_cache_get_name(lv_cache_t * cache);
 
+/**
+ * Get the hit, miss and eviction counters of a cache object.
+ * Lookups are counted by `lv_cache_acquire` and `lv_cache_acquire_or_create`.
+ * @param cache         The cache object pointer to get the statistics of.
+ * @param stats         Store the statistics here. For sharded caches it's the sum of all shards.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and eviction counters of a cache object.
+ * @param cache         The cache object pointer to reset the statistics of.
+ */
+void lv_cache_reset_stats(lv_cache_t * cache);
+
 /**
  * Create an iterator for the cache object. The iterator is used to iterate over all cache entries.
  * @param cache         The cache object pointer to create the iterator.
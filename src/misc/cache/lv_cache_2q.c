@@ -0,0 +1,573 @@
+/**
+* @file lv_cache_2q.c
+*
+*/
+
+/***************************************************************************\
+*                                                                           *
+*   New entries              Hit again after being evicted from A1in        *
+*       │                  ┌─────────────────────────────────────┐          *
+*       ▼                  │                                     ▼          *
+*  ┌─────────┐  evict  ┌───┴─────┐                          ┌─────────┐     *
+*  │  A1in   │────────▶│  A1out  │                          │   Am    │     *
+*  │ (FIFO)  │  keep   │ (ghost) │                          │  (LRU)  │     *
+*  └────┬────┘  hash   └─────────┘                          └────┬────┘     *
+*       │                                                        │          *
+*       ▼                                                        ▼          *
+*     evict                                                    evict        *
+*                                                                           *
+*  Entries used only once (e.g. while scrolling through a long list)       *
+*  pass through the small A1in queue and never push out the frequently     *
+*  used entries of Am.                                                      *
+*                                                                           *
+\***************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_2q.h"
+#include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_ll.h"
+#include "../lv_rb_private.h"
+#include "../lv_rb.h"
+#include "../lv_iter.h"
+#include "../lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The share of the max size used by A1in is 1 / IN_RATIO*/
+#define IN_RATIO    4
+
+/*A1out remembers GHOST_RATIO times as many keys as the cache can hold entries.
+ *It's larger than the cache to recognize the reused keys after scans longer than the cache.*/
+#define GHOST_RATIO 2
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+typedef enum {
+    QUEUE_IN,
+    QUEUE_MAIN,
+} queue_t;
+
+typedef struct {
+    void * ll_node;     /*The node in the list of its queue*/
+    queue_t queue;
+} q2_link_t;
+
+typedef struct {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    lv_ll_t in_ll;      /*A1in: FIFO of the entries used once*/
+    lv_ll_t main_ll;    /*Am: LRU of the entries used again later*/
+    uint32_t in_size;
+    uint32_t entry_cnt;
+
+    /*A1out: the hashes of the entries removed from A1in, the oldest first.
+     *Only used if the cache has a `hash_cb`*/
+    uint32_t * ghost;
+    uint32_t ghost_cnt;
+    uint32_t ghost_capacity;
+
+    get_data_size_cb_t * get_data_size_cb;
+} lv_cache_2q_t;
+
+typedef struct {
+    lv_rb_node_t ** ll_node;
+    queue_t queue;
+} iter_context_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_cache_2q_t * q, get_data_size_cb_t * get_data_size_cb);
+inline static q2_link_t * get_link(lv_cache_2q_t * q, lv_rb_node_t * node);
+inline static lv_ll_t * get_ll(lv_cache_2q_t * q, queue_t queue);
+static void unlink_node(lv_cache_2q_t * q, lv_rb_node_t * node);
+static lv_cache_entry_t * find_victim_in(lv_cache_2q_t * q, queue_t queue);
+static bool ghost_take(lv_cache_2q_t * q, uint32_t hash);
+static void ghost_add(lv_cache_2q_t * q, uint32_t hash);
+static uint32_t ghost_get_max_cnt(lv_cache_2q_t * q);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_2q_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+const lv_cache_class_t lv_cache_class_2q_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc_zeroed(sizeof(lv_cache_2q_t));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    return res;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    return init_common((lv_cache_2q_t *)cache, cnt_get_data_size_cb);
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    return init_common((lv_cache_2q_t *)cache, size_get_data_size_cb);
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+    lv_free(q->ghost);
+    q->ghost = NULL;
+    q->ghost_cnt = 0;
+    q->ghost_capacity = 0;
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(key);
+
+    if(q == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&q->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    q2_link_t * link = get_link(q, node);
+    if(link->queue == QUEUE_MAIN) {
+        lv_ll_move_before(&q->main_ll, link->ll_node, lv_ll_get_head(&q->main_ll));
+    }
+    else if(cache->ops.hash_cb == NULL) {
+        /*Without A1out only a hit can tell that an entry is used again*/
+        lv_ll_chg_list(&q->in_ll, &q->main_ll, link->ll_node, true);
+        link->queue = QUEUE_MAIN;
+        q->in_size -= q->get_data_size_cb(node->data);
+    }
+    /*Else hits in A1in are ignored as they are typically correlated (e.g. the same image drawn
+     *in a few consecutive frames). The entry gets into Am if it's used again after its eviction.*/
+
+    return lv_cache_entry_get_entry(node->data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(key);
+
+    if(q == NULL || key == NULL) {
+        return NULL;
+    }
+
+    queue_t queue = QUEUE_IN;
+    if(cache->ops.hash_cb && ghost_take(q, cache->ops.hash_cb(key))) {
+        queue = QUEUE_MAIN;
+    }
+
+    lv_rb_node_t * node = lv_rb_insert(&q->rb, (void *)key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    void * data = node->data;
+    lv_memcpy(data, key, cache->node_size);
+
+    lv_ll_t * ll = get_ll(q, queue);
+    lv_rb_node_t ** ll_node = lv_ll_ins_head(ll);
+    if(ll_node == NULL) {
+        lv_rb_drop_node(&q->rb, node);
+        return NULL;
+    }
+    *ll_node = node;
+
+    q2_link_t * link = get_link(q, node);
+    link->ll_node = ll_node;
+    link->queue = queue;
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    uint32_t data_size = q->get_data_size_cb(key);
+    cache->size += data_size;
+    if(queue == QUEUE_IN) q->in_size += data_size;
+    q->entry_cnt++;
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(entry);
+
+    if(q == NULL || entry == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&q->rb, lv_cache_entry_get_data(entry));
+    if(node == NULL) {
+        return;
+    }
+
+    /*Evicted or dropped before being used again: remember its key to recognize if it comes back*/
+    if(get_link(q, node)->queue == QUEUE_IN && cache->ops.hash_cb) {
+        ghost_add(q, cache->ops.hash_cb(node->data));
+    }
+
+    unlink_node(q, node);
+    lv_rb_remove_node(&q->rb, node);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(key);
+
+    if(q == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&q->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+    cache->ops.free_cb(data, user_data);
+
+    unlink_node(q, node);
+    lv_rb_remove_node(&q->rb, node);
+    lv_cache_entry_delete(lv_cache_entry_get_entry(data, cache->node_size));
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+
+    if(q == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    queue_t queue;
+    for(queue = QUEUE_IN; queue <= QUEUE_MAIN; queue++) {
+        lv_rb_node_t ** node;
+        LV_LL_READ(get_ll(q, queue), node) {
+            /*free user handled data and do other clean up*/
+            void * search_key = (*node)->data;
+            lv_cache_entry_t * entry = lv_cache_entry_get_entry(search_key, cache->node_size);
+            if(lv_cache_entry_get_ref(entry) == 0) {
+                cache->ops.free_cb(search_key, user_data);
+            }
+            else {
+                LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+                used_cnt++;
+            }
+        }
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_rb_destroy(&q->rb);
+    lv_ll_clear(&q->in_ll);
+    lv_ll_clear(&q->main_ll);
+
+    cache->size = 0;
+    q->in_size = 0;
+    q->entry_cnt = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+
+    /*Keep A1in in its share, but evict from it if Am has nothing to evict*/
+    queue_t first = q->in_size > cache->max_size / IN_RATIO ? QUEUE_IN : QUEUE_MAIN;
+    lv_cache_entry_t * victim = find_victim_in(q, first);
+    if(victim == NULL) {
+        victim = find_victim_in(q, first == QUEUE_IN ? QUEUE_MAIN : QUEUE_IN);
+    }
+
+    return victim;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+
+    if(q == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? q->get_data_size_cb(key) : 0;
+    if(data_size > cache->max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, cache->max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > cache->max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static bool init_common(lv_cache_2q_t * q, get_data_size_cb_t * get_data_size_cb)
+{
+    LV_ASSERT_NULL(q->cache.ops.compare_cb);
+    LV_ASSERT_NULL(q->cache.ops.free_cb);
+    LV_ASSERT(q->cache.node_size > 0);
+
+    if(q->cache.node_size <= 0 || q->cache.ops.compare_cb == NULL || q->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add the link to store the ll node and the queue*/
+    if(!lv_rb_init(&q->rb, q->cache.ops.compare_cb, lv_cache_entry_get_size(q->cache.node_size) + sizeof(q2_link_t))) {
+        return false;
+    }
+    lv_ll_init(&q->in_ll, sizeof(void *));
+    lv_ll_init(&q->main_ll, sizeof(void *));
+
+    q->get_data_size_cb = get_data_size_cb;
+
+    return true;
+}
+
+inline static q2_link_t * get_link(lv_cache_2q_t * q, lv_rb_node_t * node)
+{
+    return (q2_link_t *)((char *)node->data + q->rb.size - sizeof(q2_link_t));
+}
+
+inline static lv_ll_t * get_ll(lv_cache_2q_t * q, queue_t queue)
+{
+    return queue == QUEUE_IN ? &q->in_ll : &q->main_ll;
+}
+
+static void unlink_node(lv_cache_2q_t * q, lv_rb_node_t * node)
+{
+    q2_link_t * link = get_link(q, node);
+    lv_ll_remove(get_ll(q, link->queue), link->ll_node);
+    lv_free(link->ll_node);
+
+    uint32_t data_size = q->get_data_size_cb(node->data);
+    q->cache.size -= data_size;
+    if(link->queue == QUEUE_IN) q->in_size -= data_size;
+    q->entry_cnt--;
+}
+
+static lv_cache_entry_t * find_victim_in(lv_cache_2q_t * q, queue_t queue)
+{
+    lv_rb_node_t ** tail;
+    LV_LL_READ_BACK(get_ll(q, queue), tail) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry((*tail)->data, q->cache.node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static bool ghost_take(lv_cache_2q_t * q, uint32_t hash)
+{
+    uint32_t i;
+    for(i = 0; i < q->ghost_cnt; i++) {
+        if(q->ghost[i] == hash) {
+            q->ghost_cnt--;
+            lv_memmove(&q->ghost[i], &q->ghost[i + 1], (q->ghost_cnt - i) * sizeof(uint32_t));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void ghost_add(lv_cache_2q_t * q, uint32_t hash)
+{
+    uint32_t max_cnt = ghost_get_max_cnt(q);
+
+    /*Grow up to the max count if there is no room*/
+    if(q->ghost_cnt >= q->ghost_capacity && q->ghost_capacity < max_cnt) {
+        uint32_t new_capacity = LV_MIN(LV_MAX(q->ghost_capacity * 2, 8), max_cnt);
+        uint32_t * new_ghost = lv_realloc(q->ghost, new_capacity * sizeof(uint32_t));
+        if(new_ghost) {
+            q->ghost = new_ghost;
+            q->ghost_capacity = new_capacity;
+        }
+        else if(q->ghost_capacity == 0) {
+            return;
+        }
+    }
+
+    /*Forget the oldest keys if full or the cache got smaller*/
+    uint32_t keep_cnt = LV_MIN(max_cnt, q->ghost_capacity) - 1;
+    if(q->ghost_cnt > keep_cnt) {
+        uint32_t forget_cnt = q->ghost_cnt - keep_cnt;
+        q->ghost_cnt = keep_cnt;
+        lv_memmove(&q->ghost[0], &q->ghost[forget_cnt], q->ghost_cnt * sizeof(uint32_t));
+    }
+
+    q->ghost[q->ghost_cnt] = hash;
+    q->ghost_cnt++;
+}
+
+static uint32_t ghost_get_max_cnt(lv_cache_2q_t * q)
+{
+    /*The size based caches can hold as many entries as they have now as they are typically full*/
+    uint32_t entry_cnt = q->get_data_size_cb == cnt_get_data_size_cb ? q->cache.max_size : q->entry_cnt;
+    return LV_MAX(entry_cnt * GHOST_RATIO, 1);
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(iter_context_t), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)instance;
+    iter_context_t * ctx = context;
+
+    LV_ASSERT_NULL(ctx);
+
+    /*Iterate Am first, then A1in*/
+    if(ctx->ll_node == NULL) {
+        ctx->queue = QUEUE_MAIN;
+        ctx->ll_node = lv_ll_get_head(&q->main_ll);
+    }
+    else {
+        ctx->ll_node = lv_ll_get_next(get_ll(q, ctx->queue), ctx->ll_node);
+    }
+
+    if(ctx->ll_node == NULL && ctx->queue == QUEUE_MAIN) {
+        ctx->queue = QUEUE_IN;
+        ctx->ll_node = lv_ll_get_head(&q->in_ll);
+    }
+
+    if(ctx->ll_node == NULL) return LV_RESULT_INVALID;
+
+    lv_memcpy(elem, (*ctx->ll_node)->data, lv_cache_entry_get_size(q->cache.node_size));
+
+    return LV_RESULT_OK;
+}
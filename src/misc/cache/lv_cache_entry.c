@@ -17,15 +17,30 @@
  *      DEFINES
  *********************/
 
+/*The reference count and the invalid flag are stored in one word to update them atomically together*/
+#define REF_INVALID_FLAG    0x40000000
+#define REF_CNT_MASK        0x3FFFFFFF
+
+/*Lock-free if the compiler has atomic builtins, else `lv_cache_release` takes the cache's lock*/
+#if LV_ATOMIC_AVAILABLE
+    #define ref_add(p, v)   lv_atomic_add_fetch(p, v)
+    #define ref_or(p, v)    lv_atomic_or_fetch(p, v)
+    #define ref_and(p, v)   lv_atomic_and_fetch(p, v)
+    #define ref_load(p)     lv_atomic_load(p)
+#else
+    #define ref_add(p, v)   (*(p) += (v))
+    #define ref_or(p, v)    (*(p) |= (v))
+    #define ref_and(p, v)   (*(p) &= (v))
+    #define ref_load(p)     (*(p))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 struct _lv_cache_entry_t {
     const lv_cache_t * cache;
-    int32_t ref_cnt;
+    int32_t ref_cnt;            /**< The reference count and `REF_INVALID_FLAG`*/
     uint32_t node_size;
-
-    bool is_invalid;
 };
 /**********************
  *  STATIC PROTOTYPES
@@ -50,29 +65,29 @@ struct _lv_cache_entry_t {
 void lv_cache_entry_reset_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    entry->ref_cnt = 0;
+    ref_and(&entry->ref_cnt, REF_INVALID_FLAG);
 }
 
 void lv_cache_entry_inc_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    entry->ref_cnt++;
+    ref_add(&entry->ref_cnt, 1);
 }
 
 void lv_cache_entry_dec_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    entry->ref_cnt--;
-    if(entry->ref_cnt < 0) {
-        LV_LOG_WARN("ref_cnt(%" LV_PRIu32 ") < 0", entry->ref_cnt);
-        entry->ref_cnt = 0;
+    int32_t ref = ref_add(&entry->ref_cnt, -1);
+    if((ref & REF_CNT_MASK) == REF_CNT_MASK) {
+        LV_LOG_WARN("ref_cnt < 0");
+        ref_add(&entry->ref_cnt, 1);
     }
 }
 
 int32_t lv_cache_entry_get_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    return entry->ref_cnt;
+    return ref_load(&entry->ref_cnt) & REF_CNT_MASK;
 }
 
 uint32_t lv_cache_entry_get_node_size(lv_cache_entry_t * entry)
@@ -89,13 +104,23 @@ void lv_cache_entry_set_node_size(lv_cache_entry_t * entry, uint32_t node_size)
 void lv_cache_entry_set_invalid(lv_cache_entry_t * entry, bool is_invalid)
 {
     LV_ASSERT_NULL(entry);
-    entry->is_invalid = is_invalid;
+    if(is_invalid) ref_or(&entry->ref_cnt, REF_INVALID_FLAG);
+    else ref_and(&entry->ref_cnt, REF_CNT_MASK);
 }
 
 bool lv_cache_entry_is_invalid(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    return entry->is_invalid;
+    return (ref_load(&entry->ref_cnt) & REF_INVALID_FLAG) != 0;
+}
+
+bool lv_cache_entry_invalidate(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+
+    /*Exactly one of this and the last release sees both the flag and no references*/
+    int32_t ref = ref_or(&entry->ref_cnt, REF_INVALID_FLAG);
+    return (ref & REF_CNT_MASK) == 0;
 }
 
 void * lv_cache_entry_get_data(lv_cache_entry_t * entry)
@@ -112,17 +137,19 @@ void * lv_cache_entry_acquire_data(lv_cache_entry_t * entry)
     return lv_cache_entry_get_data(entry);
 }
 
-void lv_cache_entry_release_data(lv_cache_entry_t * entry, void * user_data)
+bool lv_cache_entry_release_data(lv_cache_entry_t * entry, void * user_data)
 {
     LV_UNUSED(user_data);
 
     LV_ASSERT_NULL(entry);
-    if(lv_cache_entry_get_ref(entry) == 0) {
-        LV_LOG_ERROR("ref_cnt(%" LV_PRIu32 ") == 0", entry->ref_cnt);
-        return;
+    int32_t ref = ref_add(&entry->ref_cnt, -1);
+    if((ref & REF_CNT_MASK) == REF_CNT_MASK) {
+        LV_LOG_ERROR("ref_cnt == 0");
+        ref_add(&entry->ref_cnt, 1);
+        return false;
     }
 
-    lv_cache_entry_dec_ref(entry);
+    return ref == REF_INVALID_FLAG;
 }
 
 lv_cache_entry_t * lv_cache_entry_get_entry(void * data, const uint32_t node_size)
@@ -169,7 +196,6 @@ void lv_cache_entry_init(lv_cache_entry_t * entry, const lv_cache_t * cache, con
     entry->cache = cache;
     entry->node_size = node_size;
     entry->ref_cnt = 0;
-    entry->is_invalid = false;
 }
 
 void lv_cache_entry_delete(lv_cache_entry_t * entry)
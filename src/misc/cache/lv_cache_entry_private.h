@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 #include "../lv_types.h"
 #include "../../osal/lv_os.h"
+#include "../../osal/lv_atomic_private.h"
 #include "../lv_profiler.h"
 
 /*********************
@@ -35,7 +36,22 @@ void   lv_cache_entry_set_node_size(lv_cache_entry_t * entry, uint32_t node_size
 void   lv_cache_entry_set_invalid(lv_cache_entry_t * entry, bool is_invalid);
 void   lv_cache_entry_set_cache(lv_cache_entry_t * entry, const lv_cache_t * cache);
 void * lv_cache_entry_acquire_data(lv_cache_entry_t * entry);
-void   lv_cache_entry_release_data(lv_cache_entry_t * entry, void * user_data);
+
+/**
+ * Decrement the reference count of a cache entry.
+ * @param entry         the cache entry
+ * @param user_data     unused
+ * @return              true: the last reference of an invalidated entry was released, so it needs to be freed
+ */
+bool   lv_cache_entry_release_data(lv_cache_entry_t * entry, void * user_data);
+
+/**
+ * Mark an entry which was removed from the cache invalid.
+ * @param entry         the cache entry
+ * @return              true: the entry isn't referenced so it needs to be freed, false: the last
+ *                      `lv_cache_entry_release_data` will report that it needs to be freed
+ */
+bool   lv_cache_entry_invalidate(lv_cache_entry_t * entry);
 
 /*************************
  *    GLOBAL VARIABLES
@@ -46,6 +46,7 @@ typedef int8_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -118,15 +119,28 @@ struct _lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Hash function for keys. Used to select the shard of sharded caches and by
+                                          *   the 2Q caches to remember the keys of the evicted entries */
 };
 
+/**
+ * Usage statistics of a cache
+ */
+typedef struct {
+    uint32_t hit_cnt;                 /**< Number of lookups which found the entry */
+    uint32_t miss_cnt;                /**< Number of lookups which didn't find the entry */
+    uint32_t evict_cnt;               /**< Number of entries evicted to make room for new ones */
+} lv_cache_stats_t;
+
 /**
  * The cache entry struct
  */
 struct _lv_cache_t {
-    const lv_cache_class_t * clz;     /**< Cache class. There are two built-in classes:
+    const lv_cache_class_t * clz;     /**< Cache class. The built-in classes are:
                                        * - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
-                                       * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy. */
+                                       * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+                                       * - lv_cache_class_2q_count for scan resistant 2Q cache with count-based eviction policy.
+                                       * - lv_cache_class_2q_size for scan resistant 2Q cache with size-based eviction policy. */
 
     uint32_t node_size;               /**< Size of a node */
 
@@ -137,6 +151,12 @@ struct _lv_cache_t {
 
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
+    lv_cache_t ** shards;             /**< The independent caches of a sharded cache (see `lv_cache_create_sharded`),
+                                       *   or NULL if the cache is not sharded */
+    uint32_t shard_cnt;               /**< Number of shards */
+
+    lv_cache_stats_t stats;           /**< Usage statistics, see `lv_cache_get_stats` */
+
     const char * name;                /**< Name of the cache */
 };
 
@@ -146,6 +166,8 @@ struct _lv_cache_t {
  * Examples:
  * - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ * - lv_cache_class_2q_count for scan resistant 2Q cache with count-based eviction policy.
+ * - lv_cache_class_2q_size for scan resistant 2Q cache with size-based eviction policy.
  */
 struct _lv_cache_class_t {
     lv_cache_alloc_cb_t alloc_cb;                 /**< The allocation function for cache entries */
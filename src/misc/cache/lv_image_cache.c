@@ -12,7 +12,7 @@
 #include "../../core/lv_global.h"
 #include "../../misc/lv_iter.h"
 
-#include "lv_image_cache.h"
+#include "lv_image_cache_private.h"
 #include "lv_image_header_cache.h"
 
 /*********************
@@ -35,6 +35,7 @@
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key);
 static void iter_inspect_cb(void * elem);
 
 /**********************
@@ -59,11 +60,12 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
-    sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
+    img_cache_p = lv_cache_create_sharded(LV_CACHE_CLASS_DEF_SIZE,
+    sizeof(lv_image_cache_data_t), size, LV_CACHE_SHARD_CNT, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
     });
 
     lv_cache_set_name(img_cache_p, CACHE_NAME);
@@ -92,6 +94,7 @@ void lv_image_cache_drop(const void * src)
         .src = src,
         .src_type = lv_image_src_get_type(src),
     };
+    search_key.src_hash = lv_image_cache_get_src_hash(src, search_key.src_type);
 
     lv_cache_drop(img_cache_p, &search_key, NULL);
 }
@@ -108,43 +111,75 @@ lv_iter_t * lv_image_cache_iter_create(void)
 
 void lv_image_cache_dump(void)
 {
+    if(img_cache_p == NULL) return;
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(img_cache_p, &stats);
+    LV_LOG_USER("Image cache: size %" LV_PRIu32 "/%" LV_PRIu32 ", hit %" LV_PRIu32 ", miss %" LV_PRIu32 ", evict %" LV_PRIu32,
+                (uint32_t)lv_cache_get_size(img_cache_p, NULL), (uint32_t)lv_cache_get_max_size(img_cache_p, NULL),
+                stats.hit_cnt, stats.miss_cnt, stats.evict_cnt);
+
     lv_iter_t * iter = lv_image_cache_iter_create();
     if(iter == NULL) return;
 
     LV_LOG_USER("Image cache dump:");
     LV_LOG_USER("\tsize\tdata_size\tcf\trc\ttype\tdecoded\t\t\tsrc");
     lv_iter_inspect(iter, iter_inspect_cb);
+    lv_iter_destroy(iter);
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+uint64_t lv_image_cache_get_src_hash(const void * src, lv_image_src_t src_type)
+{
+    if(src_type != LV_IMAGE_SRC_FILE) return (uintptr_t)src;
+
+    /*64 bit FNV-1a*/
+    const uint8_t * s = src;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    while(*s) {
+        hash ^= *s;
+        hash *= 0x100000001b3ULL;
+        s++;
+    }
+
+    return hash;
+}
 
-inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs_src, lv_image_src_t lhs_src_type,
-                                                                const void * rhs_src, lv_image_src_t rhs_src_type)
+lv_cache_compare_res_t lv_image_cache_compare_src(const void * lhs_src, lv_image_src_t lhs_src_type,
+                                                  uint64_t lhs_src_hash,
+                                                  const void * rhs_src, lv_image_src_t rhs_src_type,
+                                                  uint64_t rhs_src_hash)
 {
-    if(lhs_src_type == rhs_src_type) {
-        if(lhs_src_type == LV_IMAGE_SRC_FILE) {
-            int32_t cmp_res = lv_strcmp(lhs_src, rhs_src);
-            if(cmp_res != 0) {
-                return cmp_res > 0 ? 1 : -1;
-            }
-        }
-        else if(lhs_src_type == LV_IMAGE_SRC_VARIABLE) {
-            if(lhs_src != rhs_src) {
-                return lhs_src > rhs_src ? 1 : -1;
-            }
+    if(lhs_src_type != rhs_src_type) {
+        return lhs_src_type > rhs_src_type ? 1 : -1;
+    }
+
+    if(lhs_src_hash != rhs_src_hash) {
+        return lhs_src_hash > rhs_src_hash ? 1 : -1;
+    }
+
+    /*Same hash: compare the file names only to handle collisions*/
+    if(lhs_src_type == LV_IMAGE_SRC_FILE) {
+        int32_t cmp_res = lv_strcmp(lhs_src, rhs_src);
+        if(cmp_res != 0) {
+            return cmp_res > 0 ? 1 : -1;
         }
-        return 0;
     }
-    return lhs_src_type > rhs_src_type ? 1 : -1;
+    else if(lhs_src != rhs_src) {
+        return lhs_src > rhs_src ? 1 : -1;
+    }
+
+    return 0;
 }
 
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
 static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    return lv_image_cache_compare_src(lhs->src, lhs->src_type, lhs->src_hash, rhs->src, rhs->src_type, rhs->src_hash);
 }
 
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
@@ -161,6 +196,11 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
     if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
 }
 
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key)
+{
+    return (uint32_t)(key->src_hash ^ (key->src_hash >> 32));
+}
+
 static void iter_inspect_cb(void * elem)
 {
     lv_image_cache_data_t * data = (lv_image_cache_data_t *)elem;
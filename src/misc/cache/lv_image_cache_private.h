@@ -0,0 +1,67 @@
+/**
+ * @file lv_image_cache_private.h
+ *
+ */
+
+#ifndef LV_IMAGE_CACHE_PRIVATE_H
+#define LV_IMAGE_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_image_cache.h"
+#include "lv_cache_private.h"
+#include "../../draw/lv_image_decoder.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the hash of an image source which is used to speed up the lookup in the image and image header caches.
+ * @param src       pointer to an image source
+ * @param src_type  type of the source
+ * @return          hash of the file name or the address of a variable
+ */
+uint64_t lv_image_cache_get_src_hash(const void * src, lv_image_src_t src_type);
+
+/**
+ * Compare two image sources as cache keys. The file names are compared only if their hashes are equal.
+ * @param lhs_src       pointer to the first image source
+ * @param lhs_src_type  type of the first source
+ * @param lhs_src_hash  hash of the first source
+ * @param rhs_src       pointer to the second image source
+ * @param rhs_src_type  type of the second source
+ * @param rhs_src_hash  hash of the second source
+ * @return              0 if the sources are the same, else -1 or 1 to order them
+ */
+lv_cache_compare_res_t lv_image_cache_compare_src(const void * lhs_src, lv_image_src_t lhs_src_type,
+                                                  uint64_t lhs_src_hash,
+                                                  const void * rhs_src, lv_image_src_t rhs_src_type,
+                                                  uint64_t rhs_src_hash);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_CACHE_PRIVATE_H*/
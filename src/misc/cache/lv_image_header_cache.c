@@ -11,6 +11,7 @@
 #include "../lv_assert.h"
 #include "../../core/lv_global.h"
 
+#include "lv_image_cache_private.h"
 #include "lv_image_header_cache.h"
 #include "../lv_iter.h"
 
@@ -33,6 +34,7 @@
 static lv_cache_compare_res_t image_header_cache_compare_cb(const lv_image_header_cache_data_t * lhs,
                                                             const lv_image_header_cache_data_t * rhs);
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data);
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * key);
 static void iter_inspect_cb(void * elem);
 
 /**********************
@@ -57,11 +59,12 @@ lv_result_t lv_image_header_cache_init(uint32_t count)
         return LV_RESULT_OK;
     }
 
-    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
-    sizeof(lv_image_header_cache_data_t), count, (lv_cache_ops_t) {
+    img_header_cache_p = lv_cache_create_sharded(LV_CACHE_CLASS_DEF_COUNT,
+    sizeof(lv_image_header_cache_data_t), count, LV_CACHE_SHARD_CNT, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_header_cache_compare_cb,
         .create_cb = NULL,
-        .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb
+        .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_header_cache_hash_cb,
     });
 
     lv_cache_set_name(img_header_cache_p, CACHE_NAME);
@@ -87,6 +90,7 @@ void lv_image_header_cache_drop(const void * src)
         .src = src,
         .src_type = lv_image_src_get_type(src),
     };
+    search_key.src_hash = lv_image_cache_get_src_hash(src, search_key.src_type);
 
     lv_cache_drop(img_header_cache_p, &search_key, NULL);
 }
@@ -103,43 +107,33 @@ lv_iter_t * lv_image_header_cache_iter_create(void)
 
 void lv_image_header_cache_dump(void)
 {
-    lv_iter_t * iter = lv_image_cache_iter_create();
+    if(img_header_cache_p == NULL) return;
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(img_header_cache_p, &stats);
+    LV_LOG_USER("Image header cache: size %" LV_PRIu32 "/%" LV_PRIu32 ", hit %" LV_PRIu32 ", miss %" LV_PRIu32 ", evict %"
+                LV_PRIu32,
+                (uint32_t)lv_cache_get_size(img_header_cache_p, NULL), (uint32_t)lv_cache_get_max_size(img_header_cache_p, NULL),
+                stats.hit_cnt, stats.miss_cnt, stats.evict_cnt);
+
+    lv_iter_t * iter = lv_image_header_cache_iter_create();
     if(iter == NULL) return;
 
-    LV_LOG_USER("Image cache dump:");
-    LV_LOG_USER("\tsize\tdata_size\tcf\trc\ttype\tdecoded\t\t\tsrc");
+    LV_LOG_USER("Image header cache dump:");
+    LV_LOG_USER("\tsize\tcf\trc\ttype\tsrc");
     lv_iter_inspect(iter, iter_inspect_cb);
+    lv_iter_destroy(iter);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
-inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs_src, lv_image_src_t lhs_src_type,
-                                                                const void * rhs_src, lv_image_src_t rhs_src_type)
-{
-    if(lhs_src_type == rhs_src_type) {
-        if(lhs_src_type == LV_IMAGE_SRC_FILE) {
-            int32_t cmp_res = lv_strcmp(lhs_src, rhs_src);
-            if(cmp_res != 0) {
-                return cmp_res > 0 ? 1 : -1;
-            }
-        }
-        else if(lhs_src_type == LV_IMAGE_SRC_VARIABLE) {
-            if(lhs_src != rhs_src) {
-                return lhs_src > rhs_src ? 1 : -1;
-            }
-        }
-        return 0;
-    }
-    return lhs_src_type > rhs_src_type ? 1 : -1;
-}
-
 static lv_cache_compare_res_t image_header_cache_compare_cb(
     const lv_image_header_cache_data_t * lhs,
     const lv_image_header_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    return lv_image_cache_compare_src(lhs->src, lhs->src_type, lhs->src_hash, rhs->src, rhs->src_type, rhs->src_hash);
 }
 
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
@@ -149,31 +143,34 @@ static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, voi
     if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
 }
 
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * key)
+{
+    return (uint32_t)(key->src_hash ^ (key->src_hash >> 32));
+}
+
 static void iter_inspect_cb(void * elem)
 {
-    lv_image_cache_data_t * data = (lv_image_cache_data_t *)elem;
-    lv_draw_buf_t * decoded = (lv_draw_buf_t *)data->decoded;
-    lv_image_header_t * header = &decoded->header;
+    lv_image_header_cache_data_t * data = (lv_image_header_cache_data_t *)elem;
+    lv_image_header_t * header = &data->header;
     lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, img_header_cache_p->node_size);
 
-    LV_UNUSED(decoded);
     LV_UNUSED(header);
     LV_UNUSED(entry);
 
-    /*  size    data_size   cf  rc  type    decoded         src*/
-#define IMAGE_CACHE_DUMP_FORMAT "	%4dx%-4d	%9"LV_PRIu32"	%d	%" LV_PRId32 "	"
+    /*  size    cf  rc  type    src*/
+#define IMAGE_HEADER_CACHE_DUMP_FORMAT "	%4dx%-4d	%d	%" LV_PRId32 "	"
     switch(data->src_type) {
         case LV_IMAGE_SRC_FILE:
-            LV_LOG_USER(IMAGE_CACHE_DUMP_FORMAT "file\t%-12p\t%s", header->w, header->h, decoded->data_size, header->cf,
-                        lv_cache_entry_get_ref(entry), (void *)data->decoded, (char *)data->src);
+            LV_LOG_USER(IMAGE_HEADER_CACHE_DUMP_FORMAT "file\t%s", header->w, header->h, header->cf,
+                        lv_cache_entry_get_ref(entry), (char *)data->src);
             break;
         case LV_IMAGE_SRC_VARIABLE:
-            LV_LOG_USER(IMAGE_CACHE_DUMP_FORMAT "var \t%-12p\t%p", header->w, header->h, decoded->data_size, header->cf,
-                        lv_cache_entry_get_ref(entry), (void *)data->decoded, data->src);
+            LV_LOG_USER(IMAGE_HEADER_CACHE_DUMP_FORMAT "var \t%p", header->w, header->h, header->cf,
+                        lv_cache_entry_get_ref(entry), data->src);
             break;
         default:
-            LV_LOG_USER(IMAGE_CACHE_DUMP_FORMAT "unkn\t%-12p\t%p", header->w, header->h, decoded->data_size, header->cf,
-                        lv_cache_entry_get_ref(entry), (void *)data->decoded, data->src);
+            LV_LOG_USER(IMAGE_HEADER_CACHE_DUMP_FORMAT "unkn\t%p", header->w, header->h, header->cf,
+                        lv_cache_entry_get_ref(entry), data->src);
             break;
     }
 }
@@ -22,24 +22,51 @@
 #define LV_ANIM_RESOLUTION 1024
 #define LV_ANIM_RES_SHIFT 10
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
+
+/*Number of animations allocated together*/
+#define ANIM_BLOCK_CNT  8
+#define ANIM_BLOCK_FULL ((1U << ANIM_BLOCK_CNT) - 1)
+
+/*Initial size of the animation and batch arrays*/
+#define ANIM_LIST_CAPACITY_MIN  8
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+struct _lv_anim_block_t {
+    lv_anim_block_t * next;
+    uint32_t used_mask;             /*Bit `i` is set if `anims[i]` is used*/
+    lv_anim_t anims[ANIM_BLOCK_CNT];
+};
+
+struct _lv_anim_batch_entry_t {
+    lv_anim_t * anim;
+    uint32_t idx;                   /*Index of `anim` in `state.anims`*/
+    bool applied;
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
-static void anim_mark_list_change(void);
-static void anim_completed_handler(lv_anim_t * a);
+static void anim_update_timer(void);
+static lv_anim_t * anim_alloc(void);
+static void anim_free(lv_anim_t * a);
+static bool anim_list_add(lv_anim_t * a);
+static void anim_list_take(uint32_t idx);
+static void anim_list_lock(void);
+static void anim_list_unlock(void);
+static bool batch_add(uint32_t idx);
+static void batch_apply(uint32_t start);
+static void anim_completed_handler(uint32_t idx);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
+static int32_t anim_path_lut_get(const lv_anim_t * a, const lv_anim_path_lut_t * lut);
 static uint32_t convert_speed_to_time(uint32_t speed, int32_t start, int32_t end);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
-static void remove_anim(void * a);
+static void remove_anim(uint32_t idx);
 
 /**********************
  *  STATIC VARIABLES
@@ -60,11 +87,9 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+    lv_memzero(&state, sizeof(lv_anim_state_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
-    anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
-    state.anim_run_round = false;
+    anim_update_timer(); /*Turn off the animation timer*/
 }
 
 void lv_anim_core_deinit(void)
@@ -87,11 +112,16 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    /*Add the new animation to the end of the animation list*/
+    lv_anim_t * new_anim = anim_alloc();
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
+    if(!anim_list_add(new_anim)) {
+        anim_free(new_anim);
+        return NULL;
+    }
+
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
@@ -118,11 +148,13 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         if(new_anim->custom_exec_cb) {
             new_anim->custom_exec_cb(new_anim, new_anim->start_value);
         }
+        if(new_anim->batch_exec_cb) {
+            new_anim->current_value = new_anim->start_value;
+            new_anim->batch_exec_cb(&new_anim, 1);
+        }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
-    anim_mark_list_change();
+    anim_update_timer();
 
     LV_TRACE_ANIM("finished");
     return new_anim;
@@ -144,38 +176,46 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+
+    /*The removed animations are only cleared from the list while it's locked
+     *so the indices remain valid even if `deleted_cb` deletes other animations*/
+    anim_list_lock();
+    uint32_t i = state.anim_size;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
+            remove_anim(i);
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    anim_list_unlock();
 
     return del_any;
 }
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
-    anim_mark_list_change();
+    anim_list_lock();
+    uint32_t i = state.anim_size;
+    while(i > 0) {
+        i--;
+        if(state.anims[i]) remove_anim(i);
+    }
+    anim_list_unlock();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    /*Start from the newest animation*/
+    uint32_t i = state.anim_size;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
     }
@@ -190,11 +230,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)state.anim_cnt;
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -257,27 +293,27 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
     return new_value;
 }
 
+/*The cubic bezier curves of the built-in paths are precalculated
+ *by `scripts/anim_path_lut_gen.py` into `lv_anim_path_lut_gen.c`*/
+
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    return anim_path_lut_get(a, &lv_anim_path_lut_ease_in);
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return anim_path_lut_get(a, &lv_anim_path_lut_ease_out);
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return anim_path_lut_get(a, &lv_anim_path_lut_ease_in_out);
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+    return anim_path_lut_get(a, &lv_anim_path_lut_overshoot);
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -346,6 +382,11 @@ int32_t lv_anim_path_custom_bezier3(const lv_anim_t * a)
     return lv_anim_path_cubic_bezier(a, para->x1, para->y1, para->x2, para->y2);
 }
 
+int32_t lv_anim_path_lut(const lv_anim_t * a)
+{
+    return anim_path_lut_get(a, a->parameter.lut);
+}
+
 void lv_anim_set_var(lv_anim_t * a, void * var)
 {
     a->var = var;
@@ -356,6 +397,11 @@ void lv_anim_set_exec_cb(lv_anim_t * a, lv_anim_exec_xcb_t exec_cb)
     a->exec_cb = exec_cb;
 }
 
+void lv_anim_set_batch_exec_cb(lv_anim_t * a, lv_anim_batch_exec_cb_t batch_exec_cb)
+{
+    a->batch_exec_cb = batch_exec_cb;
+}
+
 void lv_anim_set_duration(lv_anim_t * a, uint32_t duration)
 {
     a->duration = duration;
@@ -443,6 +489,30 @@ void lv_anim_set_user_data(lv_anim_t * a, void * user_data)
     a->user_data = user_data;
 }
 
+void lv_anim_set_path_lut(lv_anim_t * a, const lv_anim_path_lut_t * lut)
+{
+    a->path_cb = lv_anim_path_lut;
+    a->parameter.lut = lut;
+}
+
+void lv_anim_path_lut_fill(const lv_anim_t * a, int16_t * values, uint32_t cnt)
+{
+    LV_ASSERT(cnt >= 2);
+
+    /*Run the path with a fake animation whose every time step is a point of the table*/
+    lv_anim_t tmp;
+    lv_memcpy(&tmp, a, sizeof(lv_anim_t));
+    tmp.start_value = 0;
+    tmp.end_value = LV_BEZIER_VAL_MAX;
+    tmp.duration = cnt - 1;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        tmp.act_time = i;
+        values[i] = (int16_t)tmp.path_cb(&tmp);
+    }
+}
+
 void lv_anim_set_bezier3_param(lv_anim_t * a, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
     lv_anim_bezier3_para_t * para = &a->parameter.bezier3;
@@ -497,86 +567,99 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
+    /*Use the same time stamp for all animations to keep them in sync*/
+    uint32_t tick = lv_tick_get();
+
+    /*Animations started while running the callbacks are appended to the end
+     *and removed ones are set to NULL, so the indices remain valid*/
+    anim_list_lock();
+    uint32_t batch_start = state.batch_size;
+    uint32_t i = state.anim_size;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
+        /*`last_timer_run` can be newer if the animation was updated by a nested call (`lv_anim_refr_now()`)*/
+        if((int32_t)(tick - a->last_timer_run) > 0) {
+            a->act_time += lv_tick_diff(tick, a->last_timer_run);
+            a->last_timer_run = tick;
+        }
 
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
-        a->act_time += elaps;
+        if(a->run_round == state.anim_run_round) continue;
+        a->run_round = state.anim_run_round;
 
-        a->last_timer_run = lv_tick_get();
+        /*The animation will run now for the first time. Call `start_cb`*/
+        if(!a->start_cb_called && a->act_time >= 0) {
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
+            }
 
-        if(a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+            resolve_time(a);
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+            if(a->start_cb) a->start_cb(a);
+            if(state.anims[i] != a) continue;  /*Deleted in `start_cb`*/
+            a->start_cb_called = 1;
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+            /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+            remove_concurrent_anims(a);
+        }
 
-                resolve_time(a);
+        if(a->act_time < 0) continue;
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+        int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
+        if(a->act_time > a->duration) a->act_time = a->duration;
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+        int32_t act_time_before_exec = a->act_time;
+        int32_t new_value = a->path_cb(a);
 
-            if(a->act_time >= 0) {
-                int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
-                if(a->act_time > a->duration) a->act_time = a->duration;
-
-                int32_t act_time_before_exec = a->act_time;
-                int32_t new_value;
-                new_value = a->path_cb(a);
-
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
-
-                if(!state.anim_list_changed) {
-                    /*Restore the original time to see is there is over time.
-                     *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
-                    if(a->act_time == act_time_before_exec) a->act_time = act_time_original;
-
-                    /*If the time is elapsed the animation is ready*/
-                    if(a->act_time >= a->duration) {
-                        anim_completed_handler(a);
-                    }
-                }
+        if(new_value != a->current_value) {
+            a->current_value = new_value;
+
+            /*Collect the batched animations and apply them together when all animations are processed*/
+            if(a->batch_exec_cb) {
+                a->act_time = act_time_original;
+                if(batch_add(i)) continue;
+
+                a->batch_exec_cb(&a, 1);
+                if(state.anims[i] != a) continue;
+                act_time_before_exec = a->act_time;
             }
+
+            /*Apply the calculated value*/
+            if(a->exec_cb) a->exec_cb(a->var, new_value);
+            if(state.anims[i] == a && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+
+            /*Deleted by the callbacks*/
+            if(state.anims[i] != a) continue;
         }
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
+        /*Restore the original time to see is there is over time.
+         *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
+        if(a->act_time == act_time_before_exec) a->act_time = act_time_original;
+
+        /*If the time is elapsed the animation is ready*/
+        if(a->act_time >= a->duration) {
+            anim_completed_handler(i);
+        }
     }
 
+    batch_apply(batch_start);
+    anim_list_unlock();
 }
 
 /**
  * Called when an animation is completed to do the necessary things
  * e.g. repeat, play in reverse, delete etc.
- * @param a pointer to an animation descriptor
+ * @param idx   index of the animation in `state.anims`
  */
-static void anim_completed_handler(lv_anim_t * a)
+static void anim_completed_handler(uint32_t idx)
 {
+    lv_anim_t * a = state.anims[idx];
+
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->reverse_play_in_progress == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
         a->repeat_cnt--;
@@ -589,14 +672,12 @@ static void anim_completed_handler(lv_anim_t * a)
 
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        anim_list_take(idx);
 
         /*Call the callback function at the end*/
         if(a->completed_cb != NULL) a->completed_cb(a);
         if(a->deleted_cb != NULL) a->deleted_cb(a);
-        lv_free(a);
+        anim_free(a);
     }
     /*If the animation is not deleted then restart it*/
     else {
@@ -623,13 +704,212 @@ static void anim_completed_handler(lv_anim_t * a)
     }
 }
 
-static void anim_mark_list_change(void)
+/**
+ * Pause the animation timer if there are no animations, else resume it
+ */
+static void anim_update_timer(void)
+{
+    if(state.anim_cnt == 0) lv_timer_pause(state.timer);
+    else lv_timer_resume(state.timer);
+}
+
+/**
+ * Allocate an animation from the blocks. Add a new block if all are full.
+ * @return      pointer to the new animation or NULL on out of memory
+ */
+static lv_anim_t * anim_alloc(void)
 {
-    state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL)
-        lv_timer_pause(state.timer);
-    else
-        lv_timer_resume(state.timer);
+    lv_anim_block_t * block;
+    for(block = state.blocks; block; block = block->next) {
+        if(block->used_mask != ANIM_BLOCK_FULL) break;
+    }
+
+    if(block == NULL) {
+        block = lv_malloc(sizeof(lv_anim_block_t));
+        if(block == NULL) return NULL;
+        block->used_mask = 0;
+        block->next = state.blocks;
+        state.blocks = block;
+    }
+
+    uint32_t i;
+    for(i = 0; i < ANIM_BLOCK_CNT; i++) {
+        if((block->used_mask & (1U << i)) == 0) break;
+    }
+
+    block->used_mask |= 1U << i;
+    return &block->anims[i];
+}
+
+/**
+ * Return an animation to its block and free the block if it became empty
+ * @param a     pointer to an animation allocated by `anim_alloc()`
+ */
+static void anim_free(lv_anim_t * a)
+{
+    lv_anim_block_t * prev = NULL;
+    lv_anim_block_t * block;
+    for(block = state.blocks; block; block = block->next) {
+        if(a >= &block->anims[0] && a < &block->anims[ANIM_BLOCK_CNT]) break;
+        prev = block;
+    }
+
+    LV_ASSERT_NULL(block);
+    if(block == NULL) return;
+
+    block->used_mask &= ~(1U << (uint32_t)(a - &block->anims[0]));
+    if(block->used_mask == 0) {
+        if(prev) prev->next = block->next;
+        else state.blocks = block->next;
+        lv_free(block);
+    }
+}
+
+/**
+ * Append an animation to the list of the running animations
+ * @param a     pointer to an animation
+ * @return      true: success; false: out of memory
+ */
+static bool anim_list_add(lv_anim_t * a)
+{
+    if(state.anim_size >= state.anim_capacity) {
+        uint32_t new_capacity = state.anim_capacity ? state.anim_capacity * 2 : ANIM_LIST_CAPACITY_MIN;
+        lv_anim_t ** new_anims = lv_realloc(state.anims, new_capacity * sizeof(lv_anim_t *));
+        if(new_anims == NULL) return false;
+        state.anims = new_anims;
+        state.anim_capacity = new_capacity;
+    }
+
+    state.anims[state.anim_size] = a;
+    state.anim_size++;
+    state.anim_cnt++;
+    return true;
+}
+
+/**
+ * Remove an animation from the list without deleting it.
+ * Can be called only while the list is locked.
+ * @param idx   index of the animation in `state.anims`
+ */
+static void anim_list_take(uint32_t idx)
+{
+    LV_ASSERT(state.iter_depth > 0);
+    state.anims[idx] = NULL;
+    state.anim_cnt--;
+}
+
+/**
+ * Prevent compacting the list while it's iterated
+ */
+static void anim_list_lock(void)
+{
+    state.iter_depth++;
+}
+
+/**
+ * Compact the list if it's not iterated anymore and update the animation timer
+ */
+static void anim_list_unlock(void)
+{
+    state.iter_depth--;
+    if(state.iter_depth == 0 && state.anim_cnt != state.anim_size) {
+        /*Remove the deleted animations keeping the order of the others*/
+        uint32_t i;
+        uint32_t j = 0;
+        for(i = 0; i < state.anim_size; i++) {
+            if(state.anims[i]) {
+                state.anims[j] = state.anims[i];
+                j++;
+            }
+        }
+        state.anim_size = j;
+
+        if(state.anim_size == 0) {
+            lv_free(state.anims);
+            state.anims = NULL;
+            state.anim_capacity = 0;
+            lv_free(state.batch);
+            state.batch = NULL;
+            lv_free(state.batch_anims);
+            state.batch_anims = NULL;
+            state.batch_capacity = 0;
+        }
+    }
+
+    anim_update_timer();
+}
+
+/**
+ * Add an animation to the batch to apply in `batch_apply()`
+ * @param idx   index of the animation in `state.anims`
+ * @return      true: added; false: out of memory
+ */
+static bool batch_add(uint32_t idx)
+{
+    if(state.batch_size >= state.batch_capacity) {
+        uint32_t new_capacity = state.batch_capacity ? state.batch_capacity * 2 : ANIM_LIST_CAPACITY_MIN;
+        lv_anim_batch_entry_t * new_batch = lv_realloc(state.batch, new_capacity * sizeof(lv_anim_batch_entry_t));
+        if(new_batch == NULL) return false;
+        state.batch = new_batch;
+
+        lv_anim_t ** new_batch_anims = lv_realloc(state.batch_anims, new_capacity * sizeof(lv_anim_t *));
+        if(new_batch_anims == NULL) return false;
+        state.batch_anims = new_batch_anims;
+
+        state.batch_capacity = new_capacity;
+    }
+
+    lv_anim_batch_entry_t * entry = &state.batch[state.batch_size];
+    entry->anim = state.anims[idx];
+    entry->idx = idx;
+    entry->applied = false;
+    state.batch_size++;
+    return true;
+}
+
+/**
+ * Call `batch_exec_cb` once for each group of animations with the same callback,
+ * then handle the completed animations of the batch
+ * @param start     index of the first entry of `state.batch` to apply
+ */
+static void batch_apply(uint32_t start)
+{
+    uint32_t end = state.batch_size;
+    uint32_t i;
+    for(i = start; i < end; i++) {
+        lv_anim_batch_entry_t * entry = &state.batch[i];
+        if(entry->applied) continue;
+
+        /*Removed by a callback after it was added to the batch*/
+        if(state.anims[entry->idx] != entry->anim) continue;
+
+        /*Collect the live animations with the same callback*/
+        lv_anim_batch_exec_cb_t cb = entry->anim->batch_exec_cb;
+        uint32_t cnt = 0;
+        uint32_t j;
+        for(j = i; j < end; j++) {
+            lv_anim_batch_entry_t * other = &state.batch[j];
+            if(other->applied) continue;
+            if(state.anims[other->idx] != other->anim) continue;
+
+            if(other->anim->batch_exec_cb == cb) {
+                state.batch_anims[cnt] = other->anim;
+                cnt++;
+                other->applied = true;
+            }
+        }
+
+        if(cnt > 0) cb(state.batch_anims, cnt);
+    }
+
+    for(i = start; i < end; i++) {
+        lv_anim_batch_entry_t * entry = &state.batch[i];
+        lv_anim_t * a = entry->anim;
+        if(state.anims[entry->idx] != a) continue;
+        if(a->act_time >= a->duration) anim_completed_handler(entry->idx);
+    }
+
+    state.batch_size = start;
 }
 
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
@@ -646,6 +926,31 @@ static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_
     return new_value;
 }
 
+static int32_t anim_path_lut_get(const lv_anim_t * a, const lv_anim_path_lut_t * lut)
+{
+    /*Calculate the current step and find it between two values of the table*/
+    int32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+    uint32_t pos = (uint32_t)t * (lut->cnt - 1);
+    uint32_t idx = pos >> LV_BEZIER_VAL_SHIFT;
+    int32_t step;
+    if(idx >= lut->cnt - 1) {
+        step = lut->values[lut->cnt - 1];
+    }
+    else {
+        int32_t frac = pos & (LV_BEZIER_VAL_MAX - 1);
+        int32_t v1 = lut->values[idx];
+        int32_t v2 = lut->values[idx + 1];
+        step = v1 + (((v2 - v1) * frac) >> LV_BEZIER_VAL_SHIFT);
+    }
+
+    int32_t new_value;
+    new_value = step * (a->end_value - a->start_value);
+    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+}
+
 static uint32_t convert_speed_to_time(uint32_t speed_or_time, int32_t start, int32_t end)
 {
     /*It was a simple time*/
@@ -678,11 +983,14 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+    anim_list_lock();
+    uint32_t i = state.anim_size;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
          *a wrapper callback is used here an the real callback data is stored in the `user_data`.
          *Therefore equality check would remove all animations.*/
@@ -691,28 +999,24 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
-            anim_mark_list_change();
-
+            remove_anim(i);
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    anim_list_unlock();
 
     return del_any;
 }
 
-static void remove_anim(void * a)
+/**
+ * Remove an animation from the list and delete it.
+ * Can be called only while the list is locked.
+ * @param idx   index of the animation in `state.anims`
+ */
+static void remove_anim(uint32_t idx)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
-    if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
-    lv_free(a);
+    lv_anim_t * a = state.anims[idx];
+    anim_list_take(idx);
+    if(a->deleted_cb != NULL) a->deleted_cb(a);
+    anim_free(a);
 }
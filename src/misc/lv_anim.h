@@ -99,6 +99,11 @@ typedef void (*lv_anim_exec_xcb_t)(void *, int32_t);
  * It's more consistent but less convenient. Might be used by binding generator functions.*/
 typedef void (*lv_anim_custom_exec_cb_t)(lv_anim_t *, int32_t);
 
+/** Apply the current value (`current_value`) of several animations at once.
+ * It's called once per animation timer run with all the animations using the same callback,
+ * e.g. to refresh a Widget only once even if many of its properties are animated.*/
+typedef void (*lv_anim_batch_exec_cb_t)(lv_anim_t ** anims, uint32_t cnt);
+
 /** Callback to call when the animation is ready*/
 typedef void (*lv_anim_completed_cb_t)(lv_anim_t *);
 
@@ -119,12 +124,21 @@ typedef struct {
     int16_t y2;
 } lv_anim_bezier3_para_t;
 
+/** A path described by its values at evenly spaced points of the animation's time.
+ * The values between the points are interpolated linearly.*/
+typedef struct {
+    const int16_t * values;     /**< `cnt` values in [0..LV_BEZIER_VAL_MAX] range (can go beyond for overshoot)*/
+    uint32_t cnt;               /**< Number of values, at least 2*/
+} lv_anim_path_lut_t;
+
 /** Describes an animation*/
 struct _lv_anim_t {
     void * var;                               /**< Variable (Widget or other user-provided object) to animate */
     lv_anim_exec_xcb_t exec_cb;               /**< Function to execute to animate */
     lv_anim_custom_exec_cb_t custom_exec_cb;  /**< Function to execute to animate,
                                                * same purpose as exec_cb but different parameters */
+    lv_anim_batch_exec_cb_t batch_exec_cb;    /**< Function to apply the values of several animations together,
+                                               * used instead of exec_cb and custom_exec_cb */
     lv_anim_start_cb_t start_cb;              /**< Call it when animation is starts (considering `delay`) */
     lv_anim_completed_cb_t completed_cb;      /**< Call it when animation is fully completed */
     lv_anim_deleted_cb_t deleted_cb;          /**< Call it when animation is deleted */
@@ -142,6 +156,7 @@ struct _lv_anim_t {
     uint32_t repeat_cnt;                      /**< Repeat count for animation */
     union _lv_anim_path_para_t {
         lv_anim_bezier3_para_t bezier3;       /**< Parameter used when path is custom_bezier */
+        const lv_anim_path_lut_t * lut;       /**< Parameter used when path is lut */
     } parameter;
 
     /* Animation system use these - user shouldn't set */
@@ -184,6 +199,15 @@ void lv_anim_set_var(lv_anim_t * a, void * var);
  */
 void lv_anim_set_exec_cb(lv_anim_t * a, lv_anim_exec_xcb_t exec_cb);
 
+/**
+ * Set a function to apply the values of all the animations having the same callback at once.
+ * It's called after all the animations are processed in an animation timer run.
+ * The animation's value is `current_value` of the animations passed to the callback.
+ * @param a             pointer to an initialized `lv_anim_t` variable
+ * @param batch_exec_cb a function to apply the values of several animations
+ */
+void lv_anim_set_batch_exec_cb(lv_anim_t * a, lv_anim_batch_exec_cb_t batch_exec_cb);
+
 /**
  * Set the duration of an animation
  * @param a         pointer to an initialized `lv_anim_t` variable
@@ -315,6 +339,25 @@ void lv_anim_set_user_data(lv_anim_t * a, void * user_data);
  */
 void lv_anim_set_bezier3_param(lv_anim_t * a, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
+/**
+ * Use a lookup table as the path of the animation.
+ * It's much faster than calculating a path, e.g. a cubic bezier, in every step.
+ * @param a         pointer to an initialized `lv_anim_t` variable
+ * @param lut       pointer to a lookup table. Only the pointer is saved so it can't be a local variable.
+ */
+void lv_anim_set_path_lut(lv_anim_t * a, const lv_anim_path_lut_t * lut);
+
+/**
+ * Sample the path of an animation into a lookup table.
+ * Typically used once at startup to make a custom curve fast.
+ * E.g. `lv_anim_set_path_cb(&a, lv_anim_path_custom_bezier3)`, `LV_ANIM_SET_EASE_IN_SINE(&a)`
+ * then `lv_anim_path_lut_fill(&a, values, 33)` and finally `lv_anim_set_path_lut(&a, &lut)`.
+ * @param a         pointer to an animation with a `path_cb` and its parameters set
+ * @param values    array to store the values
+ * @param cnt       number of values to store in `values`, at least 2
+ */
+void lv_anim_path_lut_fill(const lv_anim_t * a, int16_t * values, uint32_t cnt);
+
 /**
  * Create an animation
  * @param a         an initialized 'anim_t' variable. Not required after call.
@@ -510,10 +553,23 @@ int32_t lv_anim_path_step(const lv_anim_t * a);
  */
 int32_t lv_anim_path_custom_bezier3(const lv_anim_t * a);
 
+/**
+ * An animation path using a lookup table set by `lv_anim_set_path_lut()`
+ * @param a     pointer to an animation
+ * @return      the current value to set
+ */
+int32_t lv_anim_path_lut(const lv_anim_t * a);
+
 /**********************
  *   GLOBAL VARIABLES
  **********************/
 
+/*Lookup tables of the built-in cubic bezier paths*/
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_anim_path_lut_t lv_anim_path_lut_ease_in;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_anim_path_lut_t lv_anim_path_lut_ease_out;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_anim_path_lut_t lv_anim_path_lut_ease_in_out;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_anim_path_lut_t lv_anim_path_lut_overshoot;
+
 /**********************
  *      MACROS
  **********************/
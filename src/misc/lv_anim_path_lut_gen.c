@@ -0,0 +1,64 @@
+/*
+ **********************************************************************
+ *                            DO NOT EDIT
+ * This file is automatically generated by "anim_path_lut_gen.py"
+ **********************************************************************
+ */
+
+#include "lv_anim.h"
+
+static const int16_t ease_in_values[] = {
+    0, 0, 2, 4, 7, 11, 15, 21, 27, 33, 40, 48,
+    57, 66, 75, 85, 96, 107, 118, 130, 143, 156, 169, 183,
+    197, 211, 226, 241, 257, 273, 289, 306, 323, 340, 358, 376,
+    394, 413, 432, 451, 470, 490, 510, 531, 551, 572, 594, 615,
+    637, 659, 681, 704, 727, 750, 773, 797, 821, 845, 869, 894,
+    919, 945, 971, 997, 1024,
+};
+
+const lv_anim_path_lut_t lv_anim_path_lut_ease_in = {
+    .values = ease_in_values,
+    .cnt = 65,
+};
+
+static const int16_t ease_out_values[] = {
+    0, 27, 53, 79, 105, 130, 155, 179, 203, 227, 251, 274,
+    297, 320, 343, 365, 387, 409, 430, 452, 473, 493, 514, 534,
+    554, 573, 592, 611, 630, 648, 666, 684, 701, 718, 735, 751,
+    767, 783, 798, 813, 827, 841, 855, 868, 881, 894, 906, 917,
+    928, 939, 949, 958, 967, 976, 984, 991, 997, 1003, 1009, 1013,
+    1017, 1020, 1022, 1024, 1024,
+};
+
+const lv_anim_path_lut_t lv_anim_path_lut_ease_out = {
+    .values = ease_out_values,
+    .cnt = 65,
+};
+
+static const int16_t ease_in_out_values[] = {
+    0, 0, 2, 4, 8, 12, 18, 24, 32, 41, 50, 61,
+    73, 86, 101, 116, 132, 150, 168, 188, 208, 230, 252, 276,
+    300, 325, 350, 376, 403, 430, 457, 484, 512, 540, 567, 594,
+    621, 648, 674, 699, 724, 748, 772, 794, 816, 836, 856, 874,
+    892, 908, 923, 938, 951, 963, 974, 983, 992, 1000, 1006, 1012,
+    1016, 1020, 1022, 1024, 1024,
+};
+
+const lv_anim_path_lut_t lv_anim_path_lut_ease_in_out = {
+    .values = ease_in_out_values,
+    .cnt = 65,
+};
+
+static const int16_t overshoot_values[] = {
+    0, 1, 4, 8, 15, 22, 32, 43, 55, 69, 84, 101,
+    118, 137, 157, 177, 199, 221, 245, 269, 293, 318, 344, 370,
+    397, 424, 451, 478, 506, 533, 561, 588, 616, 643, 669, 696,
+    722, 748, 773, 797, 821, 844, 867, 888, 909, 928, 947, 964,
+    980, 995, 1009, 1021, 1032, 1041, 1049, 1055, 1059, 1062, 1062, 1061,
+    1058, 1053, 1045, 1036, 1024,
+};
+
+const lv_anim_path_lut_t lv_anim_path_lut_overshoot = {
+    .values = overshoot_values,
+    .cnt = 65,
+};
@@ -24,11 +24,30 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct _lv_anim_block_t lv_anim_block_t;
+
+typedef struct _lv_anim_batch_entry_t lv_anim_batch_entry_t;
+
 typedef struct {
-    bool anim_list_changed;
     bool anim_run_round;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+
+    /** The running animations, the newest is the last.
+     * Removed animations are NULL until the array is compacted.*/
+    lv_anim_t ** anims;
+    uint32_t anim_size;         /**< Number of elements in `anims`, including the removed ones*/
+    uint32_t anim_capacity;
+    uint32_t anim_cnt;          /**< Number of running animations*/
+    uint32_t iter_depth;        /**< >0 while `anims` is being iterated and it can't be compacted*/
+
+    /** The animations are allocated in blocks to keep them close to each other*/
+    lv_anim_block_t * blocks;
+
+    /** Animations to apply by their `batch_exec_cb` at the end of the animation timer*/
+    lv_anim_batch_entry_t * batch;
+    lv_anim_t ** batch_anims;   /**< Scratch array to pass the animations of a batch*/
+    uint32_t batch_size;
+    uint32_t batch_capacity;
 } lv_anim_state_t;
 
 /**********************
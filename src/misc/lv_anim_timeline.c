@@ -41,6 +41,7 @@ struct _lv_anim_timeline_t {
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timeline_exec_cb(void * var, int32_t v);
+static void anim_timeline_apply_value(lv_anim_t * a, int32_t value);
 static void anim_timeline_set_act_time(lv_anim_timeline_t * at, uint32_t act_time);
 static int32_t anim_timeline_path_cb(const lv_anim_t * a);
 
@@ -221,8 +222,7 @@ static void anim_timeline_set_act_time(lv_anim_timeline_t * at, uint32_t act_tim
             }
 
             value = a->start_value;
-            if(a->exec_cb) a->exec_cb(a->var, value);
-            if(a->custom_exec_cb) a->custom_exec_cb(a, value);
+            anim_timeline_apply_value(a, value);
 
             if(anim_timeline_is_started) {
                 if(at->reverse) {
@@ -242,8 +242,7 @@ static void anim_timeline_set_act_time(lv_anim_timeline_t * at, uint32_t act_tim
 
             a->act_time = act_time - start_time;
             value = a->path_cb(a);
-            if(a->exec_cb) a->exec_cb(a->var, value);
-            if(a->custom_exec_cb) a->custom_exec_cb(a, value);
+            anim_timeline_apply_value(a, value);
 
             if(anim_timeline_is_started) {
                 if(at->reverse) {
@@ -278,8 +277,7 @@ static void anim_timeline_set_act_time(lv_anim_timeline_t * at, uint32_t act_tim
             }
 
             value = a->end_value;
-            if(a->exec_cb) a->exec_cb(a->var, value);
-            if(a->custom_exec_cb) a->custom_exec_cb(a, value);
+            anim_timeline_apply_value(a, value);
 
             if(anim_timeline_is_started) {
                 if(at->reverse) {
@@ -294,6 +292,16 @@ static void anim_timeline_set_act_time(lv_anim_timeline_t * at, uint32_t act_tim
     }
 }
 
+static void anim_timeline_apply_value(lv_anim_t * a, int32_t value)
+{
+    if(a->exec_cb) a->exec_cb(a->var, value);
+    if(a->custom_exec_cb) a->custom_exec_cb(a, value);
+    if(a->batch_exec_cb) {
+        a->current_value = value;
+        a->batch_exec_cb(&a, 1);
+    }
+}
+
 static int32_t anim_timeline_path_cb(const lv_anim_t * a)
 {
     /* Directly map original timestamps to avoid loss of accuracy */
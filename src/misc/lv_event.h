@@ -95,7 +95,7 @@ typedef enum {
     LV_EVENT_GET_SELF_SIZE,       /**< Get internal size of a widget */
 
     /** Events of optional LVGL components */
-    LV_EVENT_INVALIDATE_AREA,
+    LV_EVENT_INVALIDATE_AREA,     /**< An area is invalidated on a display, or in the subtree of an object tracking it */
     LV_EVENT_RESOLUTION_CHANGED,
     LV_EVENT_COLOR_FORMAT_CHANGED,
     LV_EVENT_REFR_REQUEST,
@@ -0,0 +1,136 @@
+/**
+ * @file lv_prefix_sum.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_prefix_sum.h"
+#include "lv_assert.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The lowest set bit of a tree index. It's the number of values summed at the index.*/
+#define LSB(i) ((i) & (~(i) + 1))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_prefix_sum_init(lv_prefix_sum_t * ps)
+{
+    LV_ASSERT_NULL(ps);
+    ps->tree = NULL;
+    ps->cnt = 0;
+}
+
+lv_result_t lv_prefix_sum_build(lv_prefix_sum_t * ps, const int32_t * values, uint32_t cnt)
+{
+    LV_ASSERT_NULL(ps);
+
+    if(ps->tree == NULL || ps->cnt != cnt) {
+        int32_t * tree = lv_realloc(ps->tree, (cnt + 1) * sizeof(int32_t));
+        LV_ASSERT_MALLOC(tree);
+        if(tree == NULL) return LV_RESULT_INVALID;
+        ps->tree = tree;
+        ps->cnt = cnt;
+    }
+
+    ps->tree[0] = 0;
+    if(values == NULL) {
+        lv_memzero(&ps->tree[1], cnt * sizeof(int32_t));
+        return LV_RESULT_OK;
+    }
+
+    uint32_t i;
+    lv_memcpy(&ps->tree[1], values, cnt * sizeof(int32_t));
+
+    /*Add each partial sum to the next larger one containing it*/
+    for(i = 1; i <= cnt; i++) {
+        uint32_t parent = i + LSB(i);
+        if(parent <= cnt) ps->tree[parent] += ps->tree[i];
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_prefix_sum_add(lv_prefix_sum_t * ps, uint32_t idx, int32_t diff)
+{
+    LV_ASSERT_NULL(ps);
+    LV_ASSERT(idx < ps->cnt);
+
+    uint32_t i;
+    for(i = idx + 1; i <= ps->cnt; i += LSB(i)) {
+        ps->tree[i] += diff;
+    }
+}
+
+int32_t lv_prefix_sum_get(const lv_prefix_sum_t * ps, uint32_t idx)
+{
+    LV_ASSERT_NULL(ps);
+
+    if(idx > ps->cnt) idx = ps->cnt;
+
+    int32_t sum = 0;
+    uint32_t i;
+    for(i = idx; i > 0; i -= LSB(i)) {
+        sum += ps->tree[i];
+    }
+
+    return sum;
+}
+
+uint32_t lv_prefix_sum_find(const lv_prefix_sum_t * ps, int32_t sum)
+{
+    LV_ASSERT_NULL(ps);
+
+    if(sum < 0) return 0;
+
+    /*The largest power of 2 not greater than `cnt`*/
+    uint32_t step = 1;
+    while(step <= ps->cnt / 2) step <<= 1;
+
+    /*Walk down on the tree: take the largest partial sums which still fit*/
+    uint32_t idx = 0;
+    for(; step > 0; step >>= 1) {
+        if(idx + step <= ps->cnt && ps->tree[idx + step] <= sum) {
+            idx += step;
+            sum -= ps->tree[idx];
+        }
+    }
+
+    return idx;
+}
+
+void lv_prefix_sum_deinit(lv_prefix_sum_t * ps)
+{
+    LV_ASSERT_NULL(ps);
+    lv_free(ps->tree);
+    ps->tree = NULL;
+    ps->cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
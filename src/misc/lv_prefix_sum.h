@@ -0,0 +1,94 @@
+/**
+ * @file lv_prefix_sum.h
+ * Prefix sums of an array of values (Fenwick tree). The sum of the first N values can be
+ * queried, a value can be changed and the position of a sum can be found in O(log n).
+ * Useful to map coordinates to items of variable size.
+ */
+
+#ifndef LV_PREFIX_SUM_H
+#define LV_PREFIX_SUM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of a prefix sum*/
+struct _lv_prefix_sum_t {
+    int32_t * tree;     /**< `cnt + 1` partial sums. `tree[i]` is the sum of the values ending at `i - 1`*/
+    uint32_t cnt;       /**< Number of values*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a prefix sum without any values
+ * @param ps        pointer to an `lv_prefix_sum_t` variable to initialize
+ */
+void lv_prefix_sum_init(lv_prefix_sum_t * ps);
+
+/**
+ * Set all the values of a prefix sum in O(n)
+ * @param ps        pointer to an initialized prefix sum
+ * @param values    array of `cnt` values. Only the sums are stored, not the array.
+ *                  NULL to set all values to 0.
+ * @param cnt       number of values
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: out of memory
+ */
+lv_result_t lv_prefix_sum_build(lv_prefix_sum_t * ps, const int32_t * values, uint32_t cnt);
+
+/**
+ * Add a difference to a value
+ * @param ps        pointer to an initialized prefix sum
+ * @param idx       index of the value [0 .. cnt - 1]
+ * @param diff      the difference to add
+ */
+void lv_prefix_sum_add(lv_prefix_sum_t * ps, uint32_t idx, int32_t diff);
+
+/**
+ * Get the sum of the values before an index
+ * @param ps        pointer to an initialized prefix sum
+ * @param idx       index of a value [0 .. cnt]. `cnt` returns the sum of all values.
+ * @return          sum of the values in the [0 .. idx - 1] range
+ */
+int32_t lv_prefix_sum_get(const lv_prefix_sum_t * ps, uint32_t idx);
+
+/**
+ * Find the index of the value containing a sum, e.g. the item at a coordinate.
+ * All values need to be non-negative.
+ * @param ps        pointer to an initialized prefix sum
+ * @param sum       the sum to find
+ * @return          the largest index whose prefix sum is <= `sum`. 0 if `sum` is negative and
+ *                  `cnt` if `sum` is not less than the sum of all values.
+ */
+uint32_t lv_prefix_sum_find(const lv_prefix_sum_t * ps, int32_t sum);
+
+/**
+ * Free the memory of a prefix sum
+ * @param ps        pointer to an initialized prefix sum
+ */
+void lv_prefix_sum_deinit(lv_prefix_sum_t * ps);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PREFIX_SUM_H*/
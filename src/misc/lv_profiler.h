@@ -42,6 +42,7 @@ extern "C" {
 #define LV_PROFILER_END
 #define LV_PROFILER_BEGIN_TAG(tag) LV_UNUSED(tag)
 #define LV_PROFILER_END_TAG(tag)   LV_UNUSED(tag)
+#define LV_PROFILER_COUNTER(name, value) do { LV_UNUSED(name); LV_UNUSED(value); } while(0)
 
 #endif /*LV_USE_PROFILER*/
 
@@ -98,11 +99,13 @@ extern "C" {
 #define LV_PROFILER_REFR_END LV_PROFILER_END
 #define LV_PROFILER_REFR_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_REFR_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_REFR_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_REFR_BEGIN
 #define LV_PROFILER_REFR_END
 #define LV_PROFILER_REFR_BEGIN_TAG(tag)
 #define LV_PROFILER_REFR_END_TAG(tag)
+#define LV_PROFILER_REFR_COUNTER(name, value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_INDEV
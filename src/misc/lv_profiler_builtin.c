@@ -44,6 +44,7 @@
 typedef struct {
     uint64_t tick;     /**< The tick value of the profiler item */
     char tag;          /**< The tag of the profiler item */
+    int32_t value;     /**< The value of a counter item */
     const char * func; /**< A pointer to the function associated with the profiler item */
 #if LV_USE_OS
     int tid;           /**< The thread ID of the profiler item */
@@ -74,6 +75,7 @@ static void default_flush_cb(const char * buf);
 static int default_tid_get_cb(void);
 static int default_cpu_get_cb(void);
 static void flush_no_lock(void);
+static void write_item(const char * func, char tag, int32_t value);
 
 /**********************
  *  STATIC VARIABLES
@@ -176,33 +178,12 @@ void lv_profiler_builtin_flush(void)
 
 void lv_profiler_builtin_write(const char * func, char tag)
 {
-    LV_ASSERT_NULL(profiler_ctx);
-    LV_ASSERT_NULL(func);
-
-    if(!profiler_ctx->enable) {
-        return;
-    }
-
-    LV_PROFILER_MULTEX_LOCK;
-
-    if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
-        flush_no_lock();
-        profiler_ctx->cur_index = 0;
-    }
-
-    lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
-    item->func = func;
-    item->tag = tag;
-    item->tick = profiler_ctx->config.tick_get_cb();
-
-#if LV_USE_OS
-    item->tid = profiler_ctx->config.tid_get_cb();
-    item->cpu = profiler_ctx->config.cpu_get_cb();
-#endif
-
-    profiler_ctx->cur_index++;
+    write_item(func, tag, 0);
+}
 
-    LV_PROFILER_MULTEX_UNLOCK;
+void lv_profiler_builtin_write_counter(const char * name, int32_t value)
+{
+    write_item(name, 'C', value);
 }
 
 /**********************
@@ -244,25 +225,63 @@ static void flush_no_lock(void)
         uint32_t sec = item->tick / tick_per_sec;
         uint32_t nsec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
 
+        /*Counters are written as "C|pid|name|value"*/
+        char value_buf[16] = "";
+        if(item->tag == 'C') lv_snprintf(value_buf, sizeof(value_buf), "|%" LV_PRId32, item->value);
+
 #if LV_USE_OS
         lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-%d [%d] %" LV_PRIu32 ".%09" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
+                    "   LVGL-%d [%d] %" LV_PRIu32 ".%09" LV_PRIu32 ": tracing_mark_write: %c|1|%s%s\n",
                     item->tid,
                     item->cpu,
                     sec,
                     nsec,
                     item->tag,
-                    item->func);
+                    item->func,
+                    value_buf);
 #else
         lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-1 [0] %" LV_PRIu32 ".%09" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
+                    "   LVGL-1 [0] %" LV_PRIu32 ".%09" LV_PRIu32 ": tracing_mark_write: %c|1|%s%s\n",
                     sec,
                     nsec,
                     item->tag,
-                    item->func);
+                    item->func,
+                    value_buf);
 #endif
         profiler_ctx->config.flush_cb(buf);
     }
 }
 
+static void write_item(const char * func, char tag, int32_t value)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+    LV_ASSERT_NULL(func);
+
+    if(!profiler_ctx->enable) {
+        return;
+    }
+
+    LV_PROFILER_MULTEX_LOCK;
+
+    if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
+        flush_no_lock();
+        profiler_ctx->cur_index = 0;
+    }
+
+    lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
+    item->func = func;
+    item->tag = tag;
+    item->value = value;
+    item->tick = profiler_ctx->config.tick_get_cb();
+
+#if LV_USE_OS
+    item->tid = profiler_ctx->config.tid_get_cb();
+    item->cpu = profiler_ctx->config.cpu_get_cb();
+#endif
+
+    profiler_ctx->cur_index++;
+
+    LV_PROFILER_MULTEX_UNLOCK;
+}
+
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -28,6 +28,7 @@ extern "C" {
 #define LV_PROFILER_BUILTIN_END_TAG(tag)    lv_profiler_builtin_write((tag), 'E')
 #define LV_PROFILER_BUILTIN_BEGIN           LV_PROFILER_BUILTIN_BEGIN_TAG(__func__)
 #define LV_PROFILER_BUILTIN_END             LV_PROFILER_BUILTIN_END_TAG(__func__)
+#define LV_PROFILER_BUILTIN_COUNTER(name, value) lv_profiler_builtin_write_counter((name), (value))
 
 /**********************
  *      TYPEDEFS
@@ -72,6 +73,13 @@ void lv_profiler_builtin_flush(void);
  */
 void lv_profiler_builtin_write(const char * func, char tag);
 
+/**
+ * @brief Write the current value of a counter
+ * @param name Name of the counter
+ * @param value Value of the counter
+ */
+void lv_profiler_builtin_write_counter(const char * name, int32_t value);
+
 /**********************
  *      MACROS
  **********************/
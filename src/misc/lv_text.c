@@ -464,14 +464,10 @@ void lv_text_ins(char * txt_buf, uint32_t pos, const char * ins_txt)
     size_t ins_len = lv_strlen(ins_txt);
     if(ins_len == 0) return;
 
-    size_t new_len = ins_len + old_len;
     pos              = lv_text_encoded_get_byte_id(txt_buf, pos); /*Convert to byte index instead of letter index*/
 
-    /*Copy the second part into the end to make place to text to insert*/
-    size_t i;
-    for(i = new_len; i >= pos + ins_len; i--) {
-        txt_buf[i] = txt_buf[i - ins_len];
-    }
+    /*Copy the second part (with the closing '\0') into the end to make place to text to insert*/
+    lv_memmove(txt_buf + pos + ins_len, txt_buf + pos, old_len - pos + 1);
 
     /*Copy the text into the new space*/
     lv_memcpy(txt_buf + pos, ins_txt, ins_len);
@@ -486,11 +482,8 @@ void lv_text_cut(char * txt, uint32_t pos, uint32_t len)
     pos = lv_text_encoded_get_byte_id(txt, pos); /*Convert to byte index instead of letter index*/
     len = lv_text_encoded_get_byte_id(&txt[pos], len);
 
-    /*Copy the second part into the end to make place to text to insert*/
-    uint32_t i;
-    for(i = pos; i <= old_len - len; i++) {
-        txt[i] = txt[i + len];
-    }
+    /*Move the second part (with the closing '\0') to the place of the removed text*/
+    lv_memmove(txt + pos, txt + pos + len, old_len - pos - len + 1);
 }
 
 char * lv_text_set_text_vfmt(const char * fmt, va_list ap)
@@ -13,6 +13,7 @@
 #include "lv_assert.h"
 #include "lv_ll.h"
 #include "lv_profiler.h"
+#include "../others/observer/lv_observer.h"
 
 /*********************
  *      DEFINES
@@ -80,6 +81,11 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
     LV_PROFILER_TIMER_BEGIN;
     lv_lock();
 
+#if LV_USE_OBSERVER
+    /*Apply the values published from other threads before the timers (e.g. the display refresh) run*/
+    lv_subject_apply_published();
+#endif
+
     uint32_t handler_start = lv_tick_get();
 
     if(handler_start == 0) {
@@ -213,6 +213,8 @@ typedef struct _lv_led_t lv_led_t;
 
 typedef struct _lv_line_t lv_line_t;
 
+typedef struct _lv_list_t lv_list_t;
+
 typedef struct _lv_menu_load_page_event_data_t lv_menu_load_page_event_data_t;
 
 typedef struct _lv_menu_history_t lv_menu_history_t;
@@ -255,6 +257,8 @@ typedef struct _lv_win_t lv_win_t;
 
 typedef struct _lv_observer_t lv_observer_t;
 
+typedef struct _lv_subject_t lv_subject_t;
+
 typedef struct _lv_monkey_config_t lv_monkey_config_t;
 
 typedef struct _lv_ime_pinyin_t lv_ime_pinyin_t;
@@ -332,6 +336,10 @@ typedef struct _lv_iter_t lv_iter_t;
 
 typedef struct _lv_circle_buf_t lv_circle_buf_t;
 
+typedef struct _lv_arena_t lv_arena_t;
+
+typedef struct _lv_prefix_sum_t lv_prefix_sum_t;
+
 typedef struct _lv_draw_buf_t lv_draw_buf_t;
 
 #if LV_USE_OBJ_PROPERTY
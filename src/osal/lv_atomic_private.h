@@ -0,0 +1,88 @@
+/**
+ * @file lv_atomic_private.h
+ *
+ */
+
+#ifndef LV_ATOMIC_PRIVATE_H
+#define LV_ATOMIC_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**
+ * 1 if the compiler has atomic builtins and the `lv_atomic_...` macros are available.
+ * Without them the callers have to fall back to a lock.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define LV_ATOMIC_AVAILABLE 1
+#else
+    #define LV_ATOMIC_AVAILABLE 0
+#endif
+
+/**
+ * Storage class of thread-local variables.
+ * Not defined if the compiler doesn't support thread-local storage.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define LV_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+    #define LV_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define LV_THREAD_LOCAL _Thread_local
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#if LV_ATOMIC_AVAILABLE
+
+/** Read `*p`. Later reads and writes can't be moved before it. */
+#define lv_atomic_load(p)                   __atomic_load_n(p, __ATOMIC_ACQUIRE)
+
+/** Write `v` to `*p`. Earlier reads and writes can't be moved after it. */
+#define lv_atomic_store(p, v)               __atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+/** Write `v` to `*p` and return the old value */
+#define lv_atomic_exchange(p, v)            __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL)
+
+/**
+ * If `*p == *expected` write `v` to `*p` and return true, else copy `*p` to `*expected` and return false.
+ * It can fail spuriously so call it in a loop.
+ */
+#define lv_atomic_compare_exchange(p, expected, v) \
+    __atomic_compare_exchange_n(p, expected, v, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+/** Add `v` to `*p` and return the new value */
+#define lv_atomic_add_fetch(p, v)           __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL)
+
+/** Bitwise OR `v` to `*p` and return the new value */
+#define lv_atomic_or_fetch(p, v)            __atomic_or_fetch(p, v, __ATOMIC_ACQ_REL)
+
+/** Bitwise AND `v` to `*p` and return the new value */
+#define lv_atomic_and_fetch(p, v)           __atomic_and_fetch(p, v, __ATOMIC_ACQ_REL)
+
+#endif /*LV_ATOMIC_AVAILABLE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ATOMIC_PRIVATE_H*/
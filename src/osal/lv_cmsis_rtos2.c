@@ -17,6 +17,7 @@
 #if LV_USE_OS == LV_OS_CMSIS_RTOS2
 
 #include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -29,6 +30,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void generic_callback(void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -58,9 +60,11 @@ lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*c
         .priority = prio_map[prio],
     };
 
-    *thread = osThreadNew(callback, user_data, &c_tThreadAttribute);
+    thread->callback = callback;
+    thread->user_data = user_data;
+    thread->thread = osThreadNew(generic_callback, thread, &c_tThreadAttribute);
 
-    if(NULL == *thread) {
+    if(NULL == thread->thread) {
         LV_LOG_WARN("Error: Failed to create a cmsis-rtos2 thread.");
         return LV_RESULT_INVALID;
     }
@@ -71,8 +75,8 @@ lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*c
 
 lv_result_t lv_thread_delete(lv_thread_t * thread)
 {
-    osThreadDetach(*thread);
-    osStatus_t status = osThreadTerminate(*thread);
+    osThreadDetach(thread->thread);
+    osStatus_t status = osThreadTerminate(thread->thread);
     if(status == osOK) {
         return LV_RESULT_OK;
     }
@@ -192,4 +196,13 @@ lv_result_t lv_thread_sync_delete(lv_thread_sync_t * sync)
  *   STATIC FUNCTIONS
  **********************/
 
+static void generic_callback(void * user_data)
+{
+    lv_thread_t * thread = user_data;
+    thread->callback(thread->user_data);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+}
+
 #endif /*LV_USE_OS == LV_OS_CMSIS_RTOS2*/
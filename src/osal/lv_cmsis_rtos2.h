@@ -30,7 +30,11 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
-typedef osThreadId_t lv_thread_t;
+typedef struct {
+    osThreadId_t thread;
+    void (*callback)(void *);
+    void * user_data;
+} lv_thread_t;
 
 typedef osMutexId_t lv_mutex_t;
 
@@ -19,6 +19,7 @@
 
 #include "../tick/lv_tick.h"
 #include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
 #include "../core/lv_global.h"
 
 /*********************
@@ -432,6 +433,11 @@ static void prvRunThread(void * pxArg)
     /* Run the thread routine. */
     pxThread->pvStartRoutine((void *)pxThread->pTaskArg);
 
+#if LV_MEM_USE_THREAD_CACHE
+    /* Give back the memory cached by this thread before it's deleted. */
+    lv_mem_thread_cache_flush();
+#endif
+
     vTaskDelete(NULL);
 }
 
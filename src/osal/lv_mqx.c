@@ -12,6 +12,7 @@
 
 #include "../misc/lv_log.h"
 #include "../stdlib/lv_string.h"
+#include "../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -24,6 +25,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void generic_callback(uint32_t user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -44,14 +46,17 @@ lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*c
 
     lv_memzero(&task_template, sizeof(task_template));
 
-    task_template.TASK_ADDRESS = (TASK_FPTR)callback;
+    thread->callback = callback;
+    thread->user_data = user_data;
+
+    task_template.TASK_ADDRESS = generic_callback;
     task_template.TASK_STACKSIZE = stack_size;
     task_template.TASK_PRIORITY = _sched_get_min_priority(0) - prio;
     task_template.TASK_NAME = "lvglDraw";
-    task_template.CREATION_PARAMETER = (uint32_t)user_data;
+    task_template.CREATION_PARAMETER = (uint32_t)thread;
 
-    *thread = _task_create(0, 0, (uint32_t)&task_template);
-    if(*thread == MQX_NULL_TASK_ID) {
+    thread->thread = _task_create(0, 0, (uint32_t)&task_template);
+    if(thread->thread == MQX_NULL_TASK_ID) {
         LV_LOG_WARN("_task_create failed!");
         return LV_RESULT_INVALID;
     }
@@ -60,7 +65,7 @@ lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*c
 
 lv_result_t lv_thread_delete(lv_thread_t * thread)
 {
-    _mqx_uint ret = _task_destroy(*thread);
+    _mqx_uint ret = _task_destroy(thread->thread);
     if(ret != MQX_OK) {
         LV_LOG_WARN("_task_destroy failed!");
         return LV_RESULT_INVALID;
@@ -166,4 +171,13 @@ lv_result_t lv_thread_sync_signal_isr(lv_thread_sync_t * sync)
  *   STATIC FUNCTIONS
  **********************/
 
+static void generic_callback(uint32_t user_data)
+{
+    lv_thread_t * thread = (lv_thread_t *)user_data;
+    thread->callback(thread->user_data);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+}
+
 #endif /*LV_USE_OS == LV_OS_MQX*/
@@ -28,7 +28,11 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
-typedef _task_id lv_thread_t;
+typedef struct {
+    _task_id thread;
+    void (*callback)(void *);
+    void * user_data;
+} lv_thread_t;
 
 typedef MUTEX_STRUCT lv_mutex_t;
 
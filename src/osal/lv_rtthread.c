@@ -11,6 +11,7 @@
 #if LV_USE_OS == LV_OS_RTTHREAD
 
 #include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -25,6 +26,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void generic_callback(void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -41,9 +43,11 @@
 lv_result_t lv_thread_init(lv_thread_t * thread, lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
                            void * user_data)
 {
+    thread->callback = callback;
+    thread->user_data = user_data;
     thread->thread = rt_thread_create("thread",
-                                      callback,
-                                      user_data,
+                                      generic_callback,
+                                      thread,
                                       stack_size,
                                       prio,
                                       THREAD_TIMESLICE);
@@ -187,4 +191,13 @@ lv_result_t lv_thread_sync_signal_isr(lv_thread_sync_t * sync)
  *   STATIC FUNCTIONS
  **********************/
 
+static void generic_callback(void * user_data)
+{
+    lv_thread_t * thread = user_data;
+    thread->callback(thread->user_data);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+}
+
 #endif /*LV_USE_OS == LV_OS_RTTHREAD*/
@@ -27,6 +27,8 @@ extern "C" {
  **********************/
 typedef struct {
     rt_thread_t thread;
+    void (*callback)(void *);
+    void * user_data;
 } lv_thread_t;
 
 typedef struct {
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_os.h"
+#include "../stdlib/lv_mem.h"
 
 #if LV_USE_OS == LV_OS_SDL2
 
@@ -177,6 +178,9 @@ static int generic_callback(void * user_data)
 {
     lv_thread_t * thread = user_data;
     thread->callback(thread->user_data);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
     return 0;
 }
 
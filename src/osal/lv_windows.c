@@ -8,6 +8,7 @@
  *********************/
 
 #include "lv_os.h"
+#include "../stdlib/lv_mem.h"
 
 #if LV_USE_OS == LV_OS_WINDOWS
 
@@ -215,6 +216,9 @@ static unsigned __stdcall thread_start_routine(void * parameter)
         init_data->callback(init_data->user_data);
         free(init_data);
     }
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
 
     return 0;
 }
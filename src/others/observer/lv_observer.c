@@ -13,10 +13,14 @@
 #include "../../lvgl.h"
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_event_private.h"
+#include "../../core/lv_global.h"
+#include "../../osal/lv_atomic_private.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define published_head  LV_GLOBAL_DEFAULT()->subject_published_head
+#define applying_head   LV_GLOBAL_DEFAULT()->subject_applying_head
 
 /**********************
  *      TYPEDEFS
@@ -31,6 +35,10 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void unsubscribe_on_delete_cb(lv_event_t * e);
+static void publish(lv_subject_t * subject, lv_uintptr_t value);
+static lv_subject_t * published_list_take(void);
+static void published_list_prepend(lv_subject_t * first, lv_subject_t * last);
+static void published_list_remove(lv_subject_t * subject);
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject);
 static lv_observer_t * bind_to_bitfield(lv_subject_t * subject, lv_obj_t * obj, lv_observer_cb_t cb, uint32_t flag,
                                         int32_t ref_value, bool inv);
@@ -95,6 +103,16 @@ void lv_subject_set_int(lv_subject_t * subject, int32_t value)
     lv_subject_notify(subject);
 }
 
+void lv_subject_publish_int(lv_subject_t * subject, int32_t value)
+{
+    if(subject->type != LV_SUBJECT_TYPE_INT) {
+        LV_LOG_WARN("Subject type is not LV_SUBJECT_TYPE_INT");
+        return;
+    }
+
+    publish(subject, (lv_uintptr_t)(uint32_t)value);
+}
+
 int32_t lv_subject_get_int(lv_subject_t * subject)
 {
     if(subject->type != LV_SUBJECT_TYPE_INT) {
@@ -210,6 +228,16 @@ void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
     lv_subject_notify(subject);
 }
 
+void lv_subject_publish_pointer(lv_subject_t * subject, void * ptr)
+{
+    if(subject->type != LV_SUBJECT_TYPE_POINTER) {
+        LV_LOG_WARN("Subject type is not LV_SUBJECT_TYPE_POINTER");
+        return;
+    }
+
+    publish(subject, (lv_uintptr_t)ptr);
+}
+
 const void * lv_subject_get_pointer(lv_subject_t * subject)
 {
     if(subject->type != LV_SUBJECT_TYPE_POINTER) {
@@ -251,6 +279,16 @@ void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
     lv_subject_notify(subject);
 }
 
+void lv_subject_publish_color(lv_subject_t * subject, lv_color_t color)
+{
+    if(subject->type != LV_SUBJECT_TYPE_COLOR) {
+        LV_LOG_WARN("Subject type is not LV_SUBJECT_TYPE_COLOR");
+        return;
+    }
+
+    publish(subject, lv_color_to_int(color));
+}
+
 lv_color_t lv_subject_get_color(lv_subject_t * subject)
 {
     if(subject->type != LV_SUBJECT_TYPE_COLOR) {
@@ -275,6 +313,7 @@ void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32
 {
     subject->type = LV_SUBJECT_TYPE_GROUP;
     subject->size = list_len;
+    subject->published = 0;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
     subject->value.pointer = list;
 
@@ -288,6 +327,9 @@ void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    /*Publishing to a subject being deinitialized is not allowed, so the flag can be read without atomics*/
+    if(subject->published) published_list_remove(subject);
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -304,6 +346,52 @@ void lv_subject_deinit(lv_subject_t * subject)
     lv_ll_clear(&subject->subs_ll);
 }
 
+void lv_subject_apply_published(void)
+{
+    /*Take all the published subjects at once. Publishing meanwhile starts a new list.*/
+    lv_subject_t * subject = published_list_take();
+    if(subject == NULL) return;
+
+    /*Reverse the list to apply the values in the order of publishing*/
+    while(subject) {
+        lv_subject_t * next = subject->published_next;
+        subject->published_next = applying_head;
+        applying_head = subject;
+        subject = next;
+    }
+
+    /*The observers might deinit the subjects, so always take the next one from the list*/
+    while(applying_head) {
+        subject = applying_head;
+        applying_head = subject->published_next;
+
+        /*Clear the flag before reading the value, so a value published after this will be applied next time*/
+#if LV_ATOMIC_AVAILABLE
+        lv_atomic_exchange(&subject->published, 0);
+        lv_uintptr_t value = lv_atomic_load(&subject->published_value);
+#else
+        lv_lock();
+        subject->published = 0;
+        lv_uintptr_t value = subject->published_value;
+        lv_unlock();
+#endif
+
+        switch(subject->type) {
+            case LV_SUBJECT_TYPE_INT:
+                lv_subject_set_int(subject, (int32_t)value);
+                break;
+            case LV_SUBJECT_TYPE_POINTER:
+                lv_subject_set_pointer(subject, (void *)value);
+                break;
+            case LV_SUBJECT_TYPE_COLOR:
+                lv_subject_set_color(subject, lv_color_hex((uint32_t)value));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 lv_subject_t * lv_subject_get_group_element(lv_subject_t * subject, int32_t index)
 {
     if(subject->type != LV_SUBJECT_TYPE_GROUP) {
@@ -589,6 +677,102 @@ void * lv_observer_get_user_data(const lv_observer_t * observer)
  *   STATIC FUNCTIONS
  **********************/
 
+/*Publishing is lock-free if the compiler has atomic builtins, else it takes the LVGL lock*/
+static void publish(lv_subject_t * subject, lv_uintptr_t value)
+{
+#if LV_ATOMIC_AVAILABLE
+    lv_atomic_store(&subject->published_value, value);
+
+    /*Add to the list only if it's not there yet, else only the value is updated*/
+    if(lv_atomic_exchange(&subject->published, 1)) return;
+    published_list_prepend(subject, subject);
+#else
+    lv_lock();
+    subject->published_value = value;
+    if(subject->published == 0) {
+        subject->published = 1;
+        published_list_prepend(subject, subject);
+    }
+    lv_unlock();
+#endif
+}
+
+/**
+ * Remove all the subjects from the list of published subjects
+ * @return      the first subject of the removed list
+ */
+static lv_subject_t * published_list_take(void)
+{
+#if LV_ATOMIC_AVAILABLE
+    return lv_atomic_exchange(&published_head, NULL);
+#else
+    lv_lock();
+    lv_subject_t * head = published_head;
+    published_head = NULL;
+    lv_unlock();
+    return head;
+#endif
+}
+
+/**
+ * Add a chain of subjects to the beginning of the list of published subjects
+ * @param first     the first subject of the chain
+ * @param last      the last subject of the chain
+ */
+static void published_list_prepend(lv_subject_t * first, lv_subject_t * last)
+{
+#if LV_ATOMIC_AVAILABLE
+    lv_subject_t * head = lv_atomic_load(&published_head);
+    do {
+        last->published_next = head;
+    } while(!lv_atomic_compare_exchange(&published_head, &head, first));
+#else
+    /*Called with the LVGL lock held*/
+    last->published_next = published_head;
+    published_head = first;
+#endif
+}
+
+/**
+ * Remove a subject from the published subjects before it's deinitialized
+ * @param subject   pointer to a subject
+ */
+static void published_list_remove(lv_subject_t * subject)
+{
+    /*It can be in the list of subjects being applied*/
+    lv_subject_t ** p = &applying_head;
+    while(*p) {
+        if(*p == subject) {
+            *p = subject->published_next;
+            break;
+        }
+        p = &(*p)->published_next;
+    }
+
+    /*Take the whole list of published subjects, remove the subject and add the others back*/
+    lv_subject_t * head = published_list_take();
+    lv_subject_t * last = NULL;
+    p = &head;
+    while(*p) {
+        if(*p == subject) *p = subject->published_next;
+        else {
+            last = *p;
+            p = &(*p)->published_next;
+        }
+    }
+
+#if LV_ATOMIC_AVAILABLE
+    if(head) published_list_prepend(head, last);
+#else
+    lv_lock();
+    if(head) published_list_prepend(head, last);
+    lv_unlock();
+#endif
+
+    subject->published_next = NULL;
+    subject->published = 0;
+}
+
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject)
 {
     LV_UNUSED(subject);
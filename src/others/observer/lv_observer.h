@@ -50,7 +50,7 @@ typedef union {
 /**
  * The subject (an observable value)
  */
-typedef struct {
+struct _lv_subject_t {
     lv_ll_t subs_ll;                    /**< Subscribers*/
     uint32_t type   : 4;
     uint32_t size   : 28;               /**< Might be used to store a size related to `type`*/
@@ -58,7 +58,11 @@ typedef struct {
     lv_subject_value_t prev_value;      /**< Previous value*/
     uint32_t notify_restart_query : 1; /**< If an observer deleted start notifying from the beginning. */
     void * user_data;                   /**< Additional parameter, can be used freely by the user*/
-} lv_subject_t;
+
+    lv_uintptr_t published_value;       /**< The latest value set by `lv_subject_publish_...()`*/
+    lv_subject_t * published_next;      /**< The next subject with a published value*/
+    uint32_t published;                 /**< 1: the subject is in the list of the published subjects*/
+};
 
 /**
   * Callback called when the observed value changes
@@ -85,6 +89,16 @@ void lv_subject_init_int(lv_subject_t * subject, int32_t value);
  */
 void lv_subject_set_int(lv_subject_t * subject, int32_t value);
 
+/**
+ * Publish a new value of an integer subject from any thread without taking the LVGL lock.
+ * Only the latest published value is kept and it's set by `lv_timer_handler()`,
+ * so the observers are notified at most once per `lv_timer_handler()` call.
+ * @param subject   pointer to an initialized subject
+ * @param value     the new value
+ * @note            the subject can't be deinitialized while other threads publish to it
+ */
+void lv_subject_publish_int(lv_subject_t * subject, int32_t value);
+
 /**
  * Get the current value of an integer subject
  * @param subject   pointer to the subject
@@ -154,6 +168,14 @@ void lv_subject_init_pointer(lv_subject_t * subject, void * value);
  */
 void lv_subject_set_pointer(lv_subject_t * subject, void * ptr);
 
+/**
+ * Publish a new value of a pointer subject from any thread without taking the LVGL lock.
+ * Works like `lv_subject_publish_int()`.
+ * @param subject   pointer to an initialized subject
+ * @param ptr       new value
+ */
+void lv_subject_publish_pointer(lv_subject_t * subject, void * ptr);
+
 /**
  * Get the current value of a pointer subject
  * @param subject   pointer to the subject
@@ -182,6 +204,14 @@ void lv_subject_init_color(lv_subject_t * subject, lv_color_t color);
  */
 void lv_subject_set_color(lv_subject_t * subject, lv_color_t color);
 
+/**
+ * Publish a new value of a color subject from any thread without taking the LVGL lock.
+ * Works like `lv_subject_publish_int()`.
+ * @param subject   pointer to an initialized subject
+ * @param color     new value
+ */
+void lv_subject_publish_color(lv_subject_t * subject, lv_color_t color);
+
 /**
  * Get the current value of a color subject
  * @param subject   pointer to the subject
@@ -295,6 +325,13 @@ void * lv_observer_get_user_data(const lv_observer_t * observer);
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Set the values published by `lv_subject_publish_...()` and notify the observers.
+ * It's called by `lv_timer_handler()` and needs to be called manually only
+ * if the published values are required earlier.
+ */
+void lv_subject_apply_published(void);
+
 /**
  * Set an object flag if an integer subject's value is equal to a reference value, clear the flag otherwise
  * @param obj           pointer to an object
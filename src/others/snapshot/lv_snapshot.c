@@ -8,6 +8,7 @@
  *********************/
 #include "../../draw/lv_draw_private.h"
 #include "../../core/lv_obj_draw_private.h"
+#include "../../core/lv_obj_private.h"
 #include "lv_snapshot.h"
 #if LV_USE_SNAPSHOT
 
@@ -16,18 +17,39 @@
 #include "../../core/lv_refr_private.h"
 #include "../../display/lv_display_private.h"
 #include "../../stdlib/lv_string.h"
+#include "../../misc/lv_area_private.h"
 
 /*********************
  *      DEFINES
  *********************/
+/*If more areas are invalidated the whole image is rendered again*/
+#define INV_AREA_MAX    16
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+struct _lv_snapshot_live_t {
+    lv_obj_t * obj;
+    lv_draw_buf_t * draw_buf;
+    lv_color_format_t cf;
+    lv_area_t inv_areas[INV_AREA_MAX];      /*Relative to the snapshot area*/
+    lv_area_t dirty_areas[INV_AREA_MAX];    /*Rendered by the last update*/
+    uint32_t inv_cnt;
+    uint32_t dirty_cnt;
+    uint32_t inv_all : 1;
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static bool cf_is_supported(lv_color_format_t cf);
+static void get_snapshot_area(lv_obj_t * obj, lv_area_t * area);
+static void render(lv_obj_t * obj, lv_color_format_t cf, lv_draw_buf_t * draw_buf, const lv_area_t * snapshot_area,
+                   const lv_area_t * clip_area);
+static void live_obj_event_cb(lv_event_t * e);
+static void live_add_inv_area(lv_snapshot_live_t * snapshot, const lv_area_t * area);
+static void live_join_areas(lv_snapshot_live_t * snapshot);
 
 /**********************
  *  STATIC VARIABLES
@@ -47,11 +69,10 @@
 lv_draw_buf_t * lv_snapshot_create_draw_buf(lv_obj_t * obj, lv_color_format_t cf)
 {
     lv_obj_update_layout(obj);
-    int32_t w = lv_obj_get_width(obj);
-    int32_t h = lv_obj_get_height(obj);
-    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
-    w += ext_size * 2;
-    h += ext_size * 2;
+    lv_area_t snapshot_area;
+    get_snapshot_area(obj, &snapshot_area);
+    int32_t w = lv_area_get_width(&snapshot_area);
+    int32_t h = lv_area_get_height(&snapshot_area);
     if(w == 0 || h == 0) return NULL;
 
     return lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
@@ -60,11 +81,10 @@ lv_draw_buf_t * lv_snapshot_create_draw_buf(lv_obj_t * obj, lv_color_format_t cf
 lv_result_t lv_snapshot_reshape_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
 {
     lv_obj_update_layout(obj);
-    int32_t w = lv_obj_get_width(obj);
-    int32_t h = lv_obj_get_height(obj);
-    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
-    w += ext_size * 2;
-    h += ext_size * 2;
+    lv_area_t snapshot_area;
+    get_snapshot_area(obj, &snapshot_area);
+    int32_t w = lv_area_get_width(&snapshot_area);
+    int32_t h = lv_area_get_height(&snapshot_area);
     if(w == 0 || h == 0) return LV_RESULT_INVALID;
 
     draw_buf = lv_draw_buf_reshape(draw_buf, LV_COLOR_FORMAT_UNKNOWN, w, h, LV_STRIDE_AUTO);
@@ -77,6 +97,184 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
     LV_ASSERT_NULL(draw_buf);
     lv_result_t res;
 
+    if(!cf_is_supported(cf)) {
+        LV_LOG_WARN("Not supported color format");
+        return LV_RESULT_INVALID;
+    }
+
+    res = lv_snapshot_reshape_draw_buf(obj, draw_buf);
+    if(res != LV_RESULT_OK) return res;
+
+    /* clear draw buffer*/
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    lv_area_t snapshot_area;
+    get_snapshot_area(obj, &snapshot_area);
+    render(obj, cf, draw_buf, &snapshot_area, &snapshot_area);
+
+    return LV_RESULT_OK;
+}
+
+lv_draw_buf_t * lv_snapshot_take(lv_obj_t * obj, lv_color_format_t cf)
+{
+    LV_ASSERT_NULL(obj);
+    lv_draw_buf_t * draw_buf = lv_snapshot_create_draw_buf(obj, cf);
+    if(draw_buf == NULL) return NULL;
+
+    if(lv_snapshot_take_to_draw_buf(obj, cf, draw_buf) != LV_RESULT_OK) {
+        lv_draw_buf_destroy(draw_buf);
+        return NULL;
+    }
+
+    return draw_buf;
+}
+
+void lv_snapshot_free(lv_image_dsc_t * dsc)
+{
+    LV_LOG_WARN("Deprecated API, use lv_draw_buf_destroy directly.");
+    lv_draw_buf_destroy((lv_draw_buf_t *)dsc);
+}
+
+lv_result_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_color_format_t cf, lv_image_dsc_t * dsc,
+                                    void * buf,
+                                    uint32_t buf_size)
+{
+    lv_draw_buf_t draw_buf;
+    LV_LOG_WARN("Deprecated API, use lv_snapshot_take_to_draw_buf instead.");
+    lv_draw_buf_init(&draw_buf, 1, 1, cf, buf_size, buf, buf_size);
+    lv_result_t res = lv_snapshot_take_to_draw_buf(obj, cf, &draw_buf);
+    if(res == LV_RESULT_OK) {
+        lv_memcpy((void *)dsc, &draw_buf, sizeof(lv_image_dsc_t));
+    }
+    return res;
+}
+
+lv_snapshot_live_t * lv_snapshot_live_create(lv_obj_t * obj, lv_color_format_t cf)
+{
+    LV_ASSERT_NULL(obj);
+    if(!cf_is_supported(cf)) {
+        LV_LOG_WARN("Not supported color format");
+        return NULL;
+    }
+
+    lv_snapshot_live_t * snapshot = lv_malloc_zeroed(sizeof(lv_snapshot_live_t));
+    LV_ASSERT_MALLOC(snapshot);
+    if(snapshot == NULL) return NULL;
+
+    snapshot->obj = obj;
+    snapshot->cf = cf;
+    snapshot->inv_all = 1;
+
+    lv_obj_set_inv_area_tracked(obj, true);
+    lv_obj_add_event_cb(obj, live_obj_event_cb, LV_EVENT_INVALIDATE_AREA, snapshot);
+    lv_obj_add_event_cb(obj, live_obj_event_cb, LV_EVENT_DELETE, snapshot);
+
+    return snapshot;
+}
+
+void lv_snapshot_live_delete(lv_snapshot_live_t * snapshot)
+{
+    LV_ASSERT_NULL(snapshot);
+    lv_obj_t * obj = snapshot->obj;
+    if(obj) {
+        lv_obj_remove_event_cb_with_user_data(obj, live_obj_event_cb, snapshot);
+
+        /*Keep tracking the invalidated areas if there are other live snapshots of the object*/
+        bool tracked = false;
+        uint32_t i;
+        uint32_t event_cnt = lv_obj_get_event_count(obj);
+        for(i = 0; i < event_cnt; i++) {
+            if(lv_event_dsc_get_cb(lv_obj_get_event_dsc(obj, i)) == live_obj_event_cb) {
+                tracked = true;
+                break;
+            }
+        }
+        lv_obj_set_inv_area_tracked(obj, tracked);
+    }
+
+    if(snapshot->draw_buf) lv_draw_buf_destroy(snapshot->draw_buf);
+    lv_free(snapshot);
+}
+
+lv_result_t lv_snapshot_live_update(lv_snapshot_live_t * snapshot)
+{
+    LV_ASSERT_NULL(snapshot);
+    snapshot->dirty_cnt = 0;
+
+    lv_obj_t * obj = snapshot->obj;
+    if(obj == NULL) return LV_RESULT_INVALID;
+
+    /*The layout changes invalidate the changed areas too*/
+    lv_obj_update_layout(obj);
+
+    lv_area_t snapshot_area;
+    get_snapshot_area(obj, &snapshot_area);
+    int32_t w = lv_area_get_width(&snapshot_area);
+    int32_t h = lv_area_get_height(&snapshot_area);
+    if(w <= 0 || h <= 0) return LV_RESULT_INVALID;
+
+    lv_draw_buf_t * draw_buf = snapshot->draw_buf;
+    if(draw_buf == NULL || draw_buf->header.w != w || draw_buf->header.h != h) {
+        if(draw_buf && lv_snapshot_reshape_draw_buf(obj, draw_buf) != LV_RESULT_OK) {
+            lv_draw_buf_destroy(draw_buf);
+            draw_buf = NULL;
+        }
+        if(draw_buf == NULL) draw_buf = lv_snapshot_create_draw_buf(obj, snapshot->cf);
+        snapshot->draw_buf = draw_buf;
+        if(draw_buf == NULL) return LV_RESULT_INVALID;
+
+        snapshot->inv_all = 1;
+    }
+
+    if(snapshot->inv_all) {
+        lv_area_set(&snapshot->inv_areas[0], 0, 0, w - 1, h - 1);
+        snapshot->inv_cnt = 1;
+        snapshot->inv_all = 0;
+    }
+
+    live_join_areas(snapshot);
+
+    /*Areas invalidated while rendering are saved for the next update*/
+    lv_memcpy(snapshot->dirty_areas, snapshot->inv_areas, snapshot->inv_cnt * sizeof(lv_area_t));
+    snapshot->dirty_cnt = snapshot->inv_cnt;
+    snapshot->inv_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < snapshot->dirty_cnt; i++) {
+        lv_area_t clip_area = snapshot->dirty_areas[i];
+        lv_draw_buf_clear(draw_buf, &clip_area);
+        lv_area_move(&clip_area, snapshot_area.x1, snapshot_area.y1);
+        render(obj, snapshot->cf, draw_buf, &snapshot_area, &clip_area);
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_snapshot_live_invalidate(lv_snapshot_live_t * snapshot)
+{
+    LV_ASSERT_NULL(snapshot);
+    snapshot->inv_all = 1;
+}
+
+lv_draw_buf_t * lv_snapshot_live_get_draw_buf(lv_snapshot_live_t * snapshot)
+{
+    LV_ASSERT_NULL(snapshot);
+    return snapshot->draw_buf;
+}
+
+const lv_area_t * lv_snapshot_live_get_dirty_areas(lv_snapshot_live_t * snapshot, uint32_t * cnt)
+{
+    LV_ASSERT_NULL(snapshot);
+    *cnt = snapshot->dirty_cnt;
+    return snapshot->dirty_areas;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool cf_is_supported(lv_color_format_t cf)
+{
     switch(cf) {
         case LV_COLOR_FORMAT_RGB565:
         case LV_COLOR_FORMAT_ARGB8565:
@@ -89,36 +287,44 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
         case LV_COLOR_FORMAT_ARGB2222:
         case LV_COLOR_FORMAT_ARGB4444:
         case LV_COLOR_FORMAT_ARGB1555:
-            break;
+            return true;
         default:
-            LV_LOG_WARN("Not supported color format");
-            return LV_RESULT_INVALID;
+            return false;
     }
+}
 
-    res = lv_snapshot_reshape_draw_buf(obj, draw_buf);
-    if(res != LV_RESULT_OK) return res;
-
-    /* clear draw buffer*/
-    lv_draw_buf_clear(draw_buf, NULL);
-
-    lv_area_t snapshot_area;
-    int32_t w = draw_buf->header.w;
-    int32_t h = draw_buf->header.h;
+/**
+ * Get the area of the object with its extended draw area
+ */
+static void get_snapshot_area(lv_obj_t * obj, lv_area_t * area)
+{
     int32_t ext_size = lv_obj_get_ext_draw_size(obj);
-    lv_obj_get_coords(obj, &snapshot_area);
-    lv_area_increase(&snapshot_area, ext_size, ext_size);
+    lv_obj_get_coords(obj, area);
+    lv_area_increase(area, ext_size, ext_size);
+}
 
+/**
+ * Draw the object into a draw buffer
+ * @param obj           the object to draw
+ * @param cf            color format of the image
+ * @param draw_buf      the draw buffer covering `snapshot_area`
+ * @param snapshot_area the area of the object with its extended draw area
+ * @param clip_area     draw only this part of `snapshot_area`
+ */
+static void render(lv_obj_t * obj, lv_color_format_t cf, lv_draw_buf_t * draw_buf, const lv_area_t * snapshot_area,
+                   const lv_area_t * clip_area)
+{
     lv_layer_t layer;
     lv_memzero(&layer, sizeof(layer));
 
     layer.draw_buf = draw_buf;
-    layer.buf_area.x1 = snapshot_area.x1;
-    layer.buf_area.y1 = snapshot_area.y1;
-    layer.buf_area.x2 = snapshot_area.x1 + w - 1;
-    layer.buf_area.y2 = snapshot_area.y1 + h - 1;
+    layer.buf_area.x1 = snapshot_area->x1;
+    layer.buf_area.y1 = snapshot_area->y1;
+    layer.buf_area.x2 = snapshot_area->x1 + draw_buf->header.w - 1;
+    layer.buf_area.y2 = snapshot_area->y1 + draw_buf->header.h - 1;
     layer.color_format = cf;
-    layer._clip_area = snapshot_area;
-    layer.phy_clip_area = snapshot_area;
+    layer._clip_area = *clip_area;
+    layer.phy_clip_area = *clip_area;
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     lv_matrix_identity(&layer.matrix);
 #endif
@@ -138,46 +344,78 @@ lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t * obj, lv_color_format_t cf, l
 
     disp_new->layer_head = layer_old;
     lv_refr_set_disp_refreshing(disp_old);
-
-    return LV_RESULT_OK;
 }
 
-lv_draw_buf_t * lv_snapshot_take(lv_obj_t * obj, lv_color_format_t cf)
+static void live_obj_event_cb(lv_event_t * e)
 {
-    LV_ASSERT_NULL(obj);
-    lv_draw_buf_t * draw_buf = lv_snapshot_create_draw_buf(obj, cf);
-    if(draw_buf == NULL) return NULL;
+    lv_snapshot_live_t * snapshot = lv_event_get_user_data(e);
+    lv_event_code_t code = lv_event_get_code(e);
 
-    if(lv_snapshot_take_to_draw_buf(obj, cf, draw_buf) != LV_RESULT_OK) {
-        lv_draw_buf_destroy(draw_buf);
-        return NULL;
+    if(code == LV_EVENT_INVALIDATE_AREA) {
+        live_add_inv_area(snapshot, lv_event_get_param(e));
+    }
+    else if(code == LV_EVENT_DELETE) {
+        snapshot->obj = NULL;
     }
-
-    return draw_buf;
 }
 
-void lv_snapshot_free(lv_image_dsc_t * dsc)
+/**
+ * Save an invalidated area relative to the snapshot area.
+ * The children move together with the object, so the saved areas remain valid when it's scrolled or moved.
+ */
+static void live_add_inv_area(lv_snapshot_live_t * snapshot, const lv_area_t * area)
 {
-    LV_LOG_WARN("Deprecated API, use lv_draw_buf_destroy directly.");
-    lv_draw_buf_destroy((lv_draw_buf_t *)dsc);
+    if(snapshot->inv_all) return;
+
+    lv_area_t snapshot_area;
+    get_snapshot_area(snapshot->obj, &snapshot_area);
+
+    lv_area_t inv_area;
+    if(!lv_area_intersect(&inv_area, area, &snapshot_area)) return;
+    lv_area_move(&inv_area, -snapshot_area.x1, -snapshot_area.y1);
+
+    uint32_t i;
+    for(i = 0; i < snapshot->inv_cnt; i++) {
+        if(lv_area_is_in(&inv_area, &snapshot->inv_areas[i], 0)) return;
+    }
+
+    if(snapshot->inv_cnt == INV_AREA_MAX) {
+        snapshot->inv_all = 1;
+        return;
+    }
+
+    snapshot->inv_areas[snapshot->inv_cnt] = inv_area;
+    snapshot->inv_cnt++;
 }
 
-lv_result_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_color_format_t cf, lv_image_dsc_t * dsc,
-                                    void * buf,
-                                    uint32_t buf_size)
+/**
+ * Join the invalidated areas if the joined area is smaller than the sum of the two areas,
+ * similarly to what the display refresh does.
+ */
+static void live_join_areas(lv_snapshot_live_t * snapshot)
 {
-    lv_draw_buf_t draw_buf;
-    LV_LOG_WARN("Deprecated API, use lv_snapshot_take_to_draw_buf instead.");
-    lv_draw_buf_init(&draw_buf, 1, 1, cf, buf_size, buf, buf_size);
-    lv_result_t res = lv_snapshot_take_to_draw_buf(obj, cf, &draw_buf);
-    if(res == LV_RESULT_OK) {
-        lv_memcpy((void *)dsc, &draw_buf, sizeof(lv_image_dsc_t));
+    lv_area_t * areas = snapshot->inv_areas;
+    bool joined = true;
+    while(joined) {
+        joined = false;
+        uint32_t i;
+        uint32_t j;
+        for(i = 0; i < snapshot->inv_cnt; i++) {
+            for(j = i + 1; j < snapshot->inv_cnt; j++) {
+                if(!lv_area_is_on(&areas[i], &areas[j])) continue;
+
+                lv_area_t joined_area;
+                lv_area_join(&joined_area, &areas[i], &areas[j]);
+                if(lv_area_get_size(&joined_area) > lv_area_get_size(&areas[i]) + lv_area_get_size(&areas[j])) continue;
+
+                areas[i] = joined_area;
+                areas[j] = areas[snapshot->inv_cnt - 1];
+                snapshot->inv_cnt--;
+                joined = true;
+                j--;
+            }
+        }
     }
-    return res;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 #endif /*LV_USE_SNAPSHOT*/
@@ -28,6 +28,8 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct _lv_snapshot_live_t lv_snapshot_live_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -89,6 +91,52 @@ lv_result_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_color_format_t cf, lv_ima
                                     void * buf,
                                     uint32_t buf_size);
 
+/**
+ * Create a live snapshot of an object. It keeps a draw buffer and tracks the invalidated
+ * areas of the object and its children so that only those areas are rendered again on update.
+ * @param obj   the object to generate snapshot.
+ * @param cf    color format for the snapshot image.
+ * @return      pointer to the new live snapshot, or NULL if failed.
+ *              The image is rendered only by `lv_snapshot_live_update()`.
+ */
+lv_snapshot_live_t * lv_snapshot_live_create(lv_obj_t * obj, lv_color_format_t cf);
+
+/**
+ * Delete a live snapshot together with its draw buffer.
+ * @param snapshot  pointer to a live snapshot.
+ */
+void lv_snapshot_live_delete(lv_snapshot_live_t * snapshot);
+
+/**
+ * Render the areas invalidated since the last update. The whole image is rendered on the first
+ * update and when the size of the object changes.
+ * @param snapshot  pointer to a live snapshot.
+ * @return          LV_RESULT_OK on success, LV_RESULT_INVALID on error or if the object was deleted.
+ */
+lv_result_t lv_snapshot_live_update(lv_snapshot_live_t * snapshot);
+
+/**
+ * Render the whole image on the next update.
+ * @param snapshot  pointer to a live snapshot.
+ */
+void lv_snapshot_live_invalidate(lv_snapshot_live_t * snapshot);
+
+/**
+ * Get the draw buffer of a live snapshot. It can be reallocated by `lv_snapshot_live_update()`.
+ * @param snapshot  pointer to a live snapshot.
+ * @return          the draw buffer or NULL if it's not rendered yet.
+ */
+lv_draw_buf_t * lv_snapshot_live_get_draw_buf(lv_snapshot_live_t * snapshot);
+
+/**
+ * Get the areas rendered by the last `lv_snapshot_live_update()`,
+ * e.g. to send only the changed parts of the image to a remote viewer.
+ * @param snapshot  pointer to a live snapshot.
+ * @param cnt       store the number of areas here.
+ * @return          array of areas relative to the top left corner of the draw buffer.
+ */
+const lv_area_t * lv_snapshot_live_get_dirty_areas(lv_snapshot_live_t * snapshot, uint32_t * cnt);
+
 /**********************
  *      MACROS
  **********************/
@@ -188,10 +188,22 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
         case LV_EVENT_REFR_START:
             info->measured.refr_interval_sum += lv_tick_elaps(info->measured.refr_start);
             info->measured.refr_start = lv_tick_get();
+            info->measured.rendered_in_refr = 0;
             break;
         case LV_EVENT_REFR_READY:
             info->measured.refr_elaps_sum += lv_tick_elaps(info->measured.refr_start);
             info->measured.refr_cnt++;
+            /*The first refresh after an input shows its result. If nothing was rendered
+             *the input had no visible effect so don't count it.*/
+            if(info->measured.input_pending) {
+                if(info->measured.rendered_in_refr) {
+                    uint32_t latency = lv_tick_elaps(info->measured.input_start);
+                    info->measured.input_latency_sum += latency;
+                    info->measured.input_latency_max = LV_MAX(info->measured.input_latency_max, latency);
+                    info->measured.input_cnt++;
+                }
+                info->measured.input_pending = 0;
+            }
             break;
         case LV_EVENT_RENDER_START:
             info->measured.render_in_progress = 1;
@@ -199,6 +211,7 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
             break;
         case LV_EVENT_RENDER_READY:
             info->measured.render_in_progress = 0;
+            info->measured.rendered_in_refr = 1;
             info->measured.render_elaps_sum += lv_tick_elaps(info->measured.render_start);
             info->measured.render_cnt++;
             break;
@@ -258,6 +271,19 @@ static void perf_update_timer_cb(lv_timer_t * t)
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
 
+    info->calculated.input_latency_avg_time = info->measured.input_cnt ?
+                                              (info->measured.input_latency_sum / info->measured.input_cnt) : 0;
+    info->calculated.input_latency_max_time = info->measured.input_latency_max;
+
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    const lv_draw_global_info_t * draw_info = &LV_GLOBAL_DEFAULT()->draw_info;
+    uint32_t layer_pool_hit = draw_info->layer_pool.hit_cnt - info->measured.layer_pool_hit_cnt;
+    uint32_t layer_pool_miss = draw_info->layer_pool.miss_cnt - info->measured.layer_pool_miss_cnt;
+    info->calculated.layer_pool_size = draw_info->layer_pool.size;
+    info->calculated.layer_pool_hit_pct = (layer_pool_hit + layer_pool_miss) ?
+                                          (layer_pool_hit * 100 / (layer_pool_hit + layer_pool_miss)) : 0;
+#endif
+
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
@@ -268,6 +294,12 @@ static void perf_update_timer_cb(lv_timer_t * t)
     lv_sysmon_perf_info_t prev_info = *info;
     lv_memzero(info, sizeof(lv_sysmon_perf_info_t));
     info->measured.refr_start = prev_info.measured.refr_start;
+    info->measured.input_start = prev_info.measured.input_start;
+    info->measured.input_pending = prev_info.measured.input_pending;
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    info->measured.layer_pool_hit_cnt = draw_info->layer_pool.hit_cnt;
+    info->measured.layer_pool_miss_cnt = draw_info->layer_pool.miss_cnt;
+#endif
     info->calculated.cpu_avg_total = prev_info.calculated.cpu_avg_total;
     info->calculated.fps_avg_total = prev_info.calculated.fps_avg_total;
     info->calculated.run_cnt = prev_info.calculated.run_cnt;
@@ -285,10 +317,15 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
            "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
-           "CPU %" LV_PRIu32 "%%\n",
+           "CPU %" LV_PRIu32 "%%, "
+           "input latency %" LV_PRIu32 "ms (max %" LV_PRIu32 "ms)\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
-           perf->calculated.cpu);
+           perf->calculated.cpu, perf->calculated.input_latency_avg_time, perf->calculated.input_latency_max_time);
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    LV_LOG("sysmon: layer pool %" LV_PRIu32 " kB, %" LV_PRIu32 "%% hit\n",
+           perf->calculated.layer_pool_size / 1024, perf->calculated.layer_pool_hit_pct);
+#endif
 #else
     lv_label_set_text_fmt(
         label,
@@ -47,7 +47,15 @@ struct _lv_sysmon_perf_info_t {
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
         uint32_t last_report_timestamp;
+        uint32_t input_start;           /**< Time of the first input not rendered yet*/
+        uint32_t input_latency_sum;
+        uint32_t input_latency_max;
+        uint32_t input_cnt;
+        uint32_t layer_pool_hit_cnt;    /**< Hit count of the layer pool at the last report*/
+        uint32_t layer_pool_miss_cnt;   /**< Miss count of the layer pool at the last report*/
         uint32_t render_in_progress : 1;
+        uint32_t rendered_in_refr : 1;  /**< Something was rendered in the current refresh*/
+        uint32_t input_pending : 1;     /**< `input_start` is valid*/
     } measured;
 
     struct {
@@ -56,6 +64,10 @@ struct _lv_sysmon_perf_info_t {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t input_latency_avg_time;    /**< Time from reading an input until its result is flushed*/
+        uint32_t input_latency_max_time;
+        uint32_t layer_pool_size;       /**< Memory held by the unused buffers of the layer pool [bytes]*/
+        uint32_t layer_pool_hit_pct;    /**< Percentage of layers which got their buffer from the pool*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
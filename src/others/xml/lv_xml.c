@@ -26,7 +26,6 @@
 #include "parsers/lv_xml_slider_parser.h"
 #include "parsers/lv_xml_tabview_parser.h"
 #include "parsers/lv_xml_chart_parser.h"
-#include "../../libs/expat/expat.h"
 #include "../../draw/lv_draw_image.h"
 
 /*********************
@@ -40,8 +39,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void view_start_element_handler(void * user_data, const char * name, const char ** attrs);
-static void view_end_element_handler(void * user_data, const char * name);
+static void view_element_create(lv_xml_parser_state_t * state, const lv_xml_view_instr_t * instr, const char ** attrs);
+static void view_element_close(lv_xml_parser_state_t * state);
 
 /**********************
  *  STATIC VARIABLES
@@ -107,27 +106,37 @@ lv_obj_t * lv_xml_create_from_ctx(lv_obj_t * parent, lv_xml_component_ctx_t * pa
     lv_obj_t ** parent_node = lv_ll_ins_head(&state.parent_ll);
     *parent_node = parent;
 
-    /* Create an XML parser and set handlers */
-    XML_Parser parser = XML_ParserCreate(NULL);
-    XML_SetUserData(parser, &state);
-    XML_SetElementHandler(parser, view_start_element_handler, view_end_element_handler);
-
-    /* Parse the XML */
-    if(XML_Parse(parser, ctx->view_def, lv_strlen(ctx->view_def), XML_TRUE) == XML_STATUS_ERROR) {
-        LV_LOG_WARN("XML parsing error: %s on line %lu", XML_ErrorString(XML_GetErrorCode(parser)),
-                    XML_GetCurrentLineNumber(parser));
-        XML_ParserFree(parser);
+    /* The view was compiled when the component was registered, so just replay its elements.
+     * The attributes are copied as `$params` are resolved in place for each instance. */
+    const char ** attrs_buf = lv_malloc((ctx->view_attr_max * 2 + 1) * sizeof(const char *));
+    LV_ASSERT_MALLOC(attrs_buf);
+    if(attrs_buf == NULL) {
+        lv_ll_clear(&state.parent_ll);
         return NULL;
     }
 
+    uint32_t instr_cnt = lv_array_size(&ctx->view_instrs);
+    uint32_t i;
+    for(i = 0; i < instr_cnt; i++) {
+        const lv_xml_view_instr_t * instr = lv_array_at(&ctx->view_instrs, i);
+        if(instr->name) {
+            lv_memcpy(attrs_buf, instr->attrs, (instr->attr_cnt * 2 + 1) * sizeof(const char *));
+            view_element_create(&state, instr, attrs_buf);
+        }
+        else {
+            view_element_close(&state);
+        }
+    }
+
+    lv_free(attrs_buf);
+
     state.item = state.view;
 
-    if(attrs) {
+    if(attrs && state.view) {
         ctx->root_widget->apply_cb(&state, attrs);
     }
 
     lv_ll_clear(&state.parent_ll);
-    XML_ParserFree(parser);
 
     return state.view;
 }
@@ -271,13 +280,17 @@ static void resolve_params(lv_xml_component_ctx_t * item_ctx, lv_xml_component_c
     }
 }
 
-static void resolve_consts(const char ** item_attrs, lv_xml_component_ctx_t * ctx)
+static void resolve_consts(const char ** item_attrs, const char ** instr_attrs, lv_xml_component_ctx_t * ctx)
 {
     uint32_t i;
     for(i = 0; item_attrs[i]; i += 2) {
         const char * name = item_attrs[i];
         const char * value = item_attrs[i + 1];
         if(lv_streq(name, "styles")) continue; /*Styles will handle it themselves*/
+
+        /*The constants of the view are resolved already, only the values of the params can be constants*/
+        if(instr_attrs[i + 1][0] != '$') continue;
+
         if(value[0] == '#') {
             const char * value_clean = &value[1];
 
@@ -298,16 +311,9 @@ static void resolve_consts(const char ** item_attrs, lv_xml_component_ctx_t * ct
     }
 }
 
-static void view_start_element_handler(void * user_data, const char * name, const char ** attrs)
+static void view_element_create(lv_xml_parser_state_t * state, const lv_xml_view_instr_t * instr, const char ** attrs)
 {
-    lv_xml_parser_state_t * state = (lv_xml_parser_state_t *)user_data;
-    bool is_view = false;
-
-    if(lv_streq(name, "view")) {
-        const char * extends = lv_xml_get_value_of(attrs, "extends");
-        name = extends ? extends : "lv_obj";
-        is_view = true;
-    }
+    const char * name = instr->name;
 
     lv_obj_t ** current_parent_p = lv_ll_get_tail(&state->parent_ll);
     if(current_parent_p == NULL) {
@@ -329,13 +335,15 @@ static void view_start_element_handler(void * user_data, const char * name, cons
      *E.g. in `my_button` `<lv_label x="5" text="${title}".
      *This function changes the pointers in the child attributes if the start with '$'
      *with the corresponding parameter. E.g. "text", "${title}" -> "text", "Hello" */
-    resolve_params(&state->ctx, state->parent_ctx, attrs, state->parent_attrs);
-
-    resolve_consts(attrs, &state->ctx);
+    if(instr->has_param) {
+        resolve_params(&state->ctx, state->parent_ctx, attrs, state->parent_attrs);
+        resolve_consts(attrs, instr->attrs, &state->ctx);
+    }
 
     void * item = NULL;
-    /* Select the widget specific parser type based on the name */
-    lv_widget_processor_t * p = lv_xml_widget_get_processor(name);
+    /* The processor is looked up again only if the widget was registered after the component */
+    lv_widget_processor_t * p = instr->processor;
+    if(p == NULL) p = lv_xml_widget_get_processor(name);
     if(p) {
         item = p->create_cb(state, attrs);
         state->item = item;
@@ -368,17 +376,13 @@ static void view_start_element_handler(void * user_data, const char * name, cons
     void ** new_parent = lv_ll_ins_tail(&state->parent_ll);
     *new_parent = item;
 
-    if(is_view) {
+    if(instr->is_view) {
         state->view = item;
     }
 }
 
-static void view_end_element_handler(void * user_data, const char * name)
+static void view_element_close(lv_xml_parser_state_t * state)
 {
-    LV_UNUSED(name);
-
-    lv_xml_parser_state_t * state = (lv_xml_parser_state_t *)user_data;
-
     lv_obj_t ** current_parent = lv_ll_get_tail(&state->parent_ll);
     if(current_parent) {
         lv_ll_remove(&state->parent_ll, current_parent);
@@ -18,16 +18,42 @@
 #include "parsers/lv_xml_obj_parser.h"
 #include "../../libs/expat/expat.h"
 #include "../../misc/lv_fs.h"
-#include <string.h>
+#include "../../misc/lv_math.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/* Offsets in the header of the binary components*/
+#define BIN_HDR_VERSION     4
+#define BIN_HDR_FLAGS       6
+#define BIN_HDR_NAME        8
+#define BIN_HDR_EXTENDS     12
+#define BIN_HDR_PARAMS      16
+#define BIN_HDR_CONSTS      24
+#define BIN_HDR_STYLES      32
+#define BIN_HDR_INSTRS      40
+#define BIN_HDR_REFS        48
+#define BIN_HDR_STRS        56
+
+/* Size of the records in the binary components*/
+#define BIN_PARAM_SIZE      12
+#define BIN_CONST_SIZE      8
+#define BIN_STYLE_SIZE      8
+#define BIN_INSTR_SIZE      16
+#define BIN_REF_SIZE        4
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    const uint8_t * data;
+    uint32_t size;
+    const char * str;       /*The string table*/
+    uint32_t str_size;
+} bin_reader_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -35,7 +61,14 @@ static void start_metadata_handler(void * user_data, const char * name, const ch
 static void end_metadata_handler(void * user_data, const char * name);
 static void process_const_element(lv_xml_parser_state_t * state, const char ** attrs);
 static void process_prop_element(lv_xml_parser_state_t * state, const char ** attrs);
-static char * extract_view_content(const char * xml_definition);
+static void view_instr_add(lv_xml_component_ctx_t * ctx, const char * name, const char ** attrs);
+static void view_instrs_finalize(lv_xml_component_ctx_t * ctx);
+static void view_instrs_free(lv_xml_component_ctx_t * ctx);
+static void styles_free(lv_xml_component_ctx_t * ctx);
+static void metadata_free(lv_xml_component_ctx_t * ctx);
+static char * read_file(const char * path, uint32_t * size);
+static lv_result_t register_from_binary(const void * data, uint32_t size, void * bin_buf);
+static bool bin_validate(bin_reader_t * bin);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,8 +123,9 @@ lv_result_t lv_xml_component_register_from_data(const char * name, const char *
     lv_xml_parser_state_t state;
     lv_xml_parser_state_init(&state);
     state.ctx.name = name;
+    lv_array_init(&state.ctx.view_instrs, 8, sizeof(lv_xml_view_instr_t));
 
-    /* Parse the XML to extract metadata */
+    /* Parse the XML to extract metadata and compile the view */
     XML_Parser parser = XML_ParserCreate(NULL);
     XML_SetUserData(parser, &state);
     XML_SetElementHandler(parser, start_metadata_handler, end_metadata_handler);
@@ -101,25 +135,28 @@ lv_result_t lv_xml_component_register_from_data(const char * name, const char *
                     XML_ErrorString(XML_GetErrorCode(parser)),
                     (unsigned long)XML_GetCurrentLineNumber(parser));
         XML_ParserFree(parser);
+        view_instrs_free(&state.ctx);
+        metadata_free(&state.ctx);
         return LV_RESULT_INVALID;
     }
 
     XML_ParserFree(parser);
 
+    if(lv_array_is_empty(&state.ctx.view_instrs)) {
+        LV_LOG_WARN("'%s' has no view", name);
+        view_instrs_free(&state.ctx);
+        metadata_free(&state.ctx);
+        return LV_RESULT_INVALID;
+    }
+
+    /* The constants are known now so they can be resolved in the view */
+    view_instrs_finalize(&state.ctx);
+
     /* Copy extracted metadata to component processor */
     lv_xml_component_ctx_t * ctx = lv_ll_ins_head(&component_ctx_ll);
     lv_memzero(ctx, sizeof(lv_xml_component_ctx_t));
     lv_memcpy(ctx, &state.ctx, sizeof(lv_xml_component_ctx_t));
-
-    /* Extract view content directly instead of using XML parser */
-    ctx->view_def = extract_view_content(xml_def);
     ctx->name = lv_strdup(name);
-    if(!ctx->view_def) {
-        LV_LOG_WARN("Failed to extract view content");
-        /* Clean up and return error */
-        lv_free(ctx);
-        return LV_RESULT_INVALID;
-    }
 
     return LV_RESULT_OK;
 }
@@ -133,51 +170,36 @@ lv_result_t lv_xml_component_register_from_file(const char * path)
     const char * ext = lv_fs_get_ext(filename);
     filename[lv_strlen(filename) - lv_strlen(ext) - 1] = '\0'; /*Trim the extension*/
 
-    lv_fs_res_t fs_res;
-    lv_fs_file_t f;
-    fs_res = lv_fs_open(&f, path, LV_FS_MODE_RD);
-    if(fs_res != LV_FS_RES_OK) {
-        LV_LOG_WARN("Couldn't open %s", path);
-        lv_free(filename);
-        return LV_RESULT_INVALID;
-    }
-
-    /* Determine file size */
-    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
-    uint32_t file_size = 0;
-    lv_fs_tell(&f, &file_size);
-    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
-
-    /* Create the buffer */
-    char * xml_buf = lv_malloc(file_size + 1);
+    char * xml_buf = read_file(path, NULL);
     if(xml_buf == NULL) {
-        LV_LOG_WARN("Memory allocation failed for file %s (%d bytes)", path, file_size + 1);
         lv_free(filename);
-        lv_fs_close(&f);
         return LV_RESULT_INVALID;
     }
 
-    /* Read the file content  */
-    uint32_t rn;
-    lv_fs_read(&f, xml_buf, file_size, &rn);
-    if(rn != file_size) {
-        LV_LOG_WARN("Couldn't read %s fully", path);
-        lv_free(filename);
-        lv_free(xml_buf);
-        lv_fs_close(&f);
-        return LV_RESULT_INVALID;
-    }
-
-    /* Null-terminate the buffer */
-    xml_buf[rn] = '\0';
-
     /* Register the component */
     lv_result_t res = lv_xml_component_register_from_data(filename, xml_buf);
 
     /* Housekeeping */
     lv_free(filename);
     lv_free(xml_buf);
-    lv_fs_close(&f);
+
+    return res;
+}
+
+lv_result_t lv_xml_component_register_from_binary_data(const void * data, uint32_t size)
+{
+    return register_from_binary(data, size, NULL);
+}
+
+lv_result_t lv_xml_component_register_from_binary_file(const char * path)
+{
+    uint32_t size;
+    char * bin_buf = read_file(path, &size);
+    if(bin_buf == NULL) return LV_RESULT_INVALID;
+
+    /* The component keeps using the strings of the buffer so it's freed only on unregister */
+    lv_result_t res = register_from_binary(bin_buf, size, bin_buf);
+    if(res != LV_RESULT_OK) lv_free(bin_buf);
 
     return res;
 }
@@ -190,9 +212,9 @@ lv_result_t lv_xml_component_unregister(const char * name)
     lv_ll_remove(&component_ctx_ll, ctx);
 
     lv_free((char *)ctx->name);
-    lv_free((char *)ctx->view_def);
-    lv_ll_clear(&ctx->param_ll);
-    lv_ll_clear(&ctx->style_ll);
+    view_instrs_free(ctx);
+    metadata_free(ctx);
+    lv_free(ctx->bin_buf);
     lv_free(ctx);
 
     return LV_RESULT_OK;
@@ -249,6 +271,12 @@ static void start_metadata_handler(void * user_data, const char * name, const ch
 
     if(lv_streq(name, "widget")) state->ctx.is_widget = 1;
 
+    /* Store the elements of the view to create them later without parsing the XML again */
+    if(state->section == LV_XML_PARSER_SECTION_VIEW) {
+        view_instr_add(&state->ctx, name, attrs);
+        return;
+    }
+
     if(old_section != state->section) return;   /*Ignore the section opening, e.g. <styles>*/
 
     /* Process elements based on current context */
@@ -275,32 +303,391 @@ static void start_metadata_handler(void * user_data, const char * name, const ch
 static void end_metadata_handler(void * user_data, const char * name)
 {
     lv_xml_parser_state_t * state = (lv_xml_parser_state_t *)user_data;
+
+    /* Close the element in the view */
+    if(state->section == LV_XML_PARSER_SECTION_VIEW) {
+        view_instr_add(&state->ctx, NULL, NULL);
+    }
+
     lv_xml_parser_end_section(state, name);
 }
 
-static char * extract_view_content(const char * xml_definition)
+static void view_instr_add(lv_xml_component_ctx_t * ctx, const char * name, const char ** attrs)
 {
-    if(!xml_definition) return NULL;
+    lv_xml_view_instr_t instr;
+    lv_memzero(&instr, sizeof(instr));
+
+    if(name) {
+        if(lv_streq(name, "view")) {
+            const char * extends = lv_xml_get_value_of(attrs, "extends");
+            name = extends ? extends : "lv_obj";
+            instr.is_view = 1;
+        }
+
+        uint32_t cnt = 0;
+        while(attrs[cnt * 2]) cnt++;
+
+        instr.name = lv_strdup(name);
+        instr.processor = lv_xml_widget_get_processor(name);
+        instr.attr_cnt = cnt;
+        instr.attrs = lv_malloc((cnt * 2 + 1) * sizeof(const char *));
+        LV_ASSERT_MALLOC(instr.attrs);
+
+        uint32_t i;
+        for(i = 0; i < cnt * 2; i++) instr.attrs[i] = lv_strdup(attrs[i]);
+        instr.attrs[cnt * 2] = NULL;
+
+        ctx->view_attr_max = LV_MAX(ctx->view_attr_max, cnt);
+    }
 
-    /* Find start of view tag */
-    const char * start = strstr(xml_definition, "<view");
-    if(!start) return NULL;
+    lv_array_push_back(&ctx->view_instrs, &instr);
+}
 
-    /* Find end of view tag */
-    const char * end = strstr(xml_definition, "</view>");
-    if(!end) return NULL;
-    end += 7; /* Include "</view>" in result */
+static void view_instrs_finalize(lv_xml_component_ctx_t * ctx)
+{
+    uint32_t instr_cnt = lv_array_size(&ctx->view_instrs);
+    uint32_t i;
+    for(i = 0; i < instr_cnt; i++) {
+        lv_xml_view_instr_t * instr = lv_array_at(&ctx->view_instrs, i);
+        if(instr->name == NULL) continue;
+
+        uint32_t a;
+        for(a = 0; a < instr->attr_cnt * 2; a += 2) {
+            const char * name = instr->attrs[a];
+            const char * value = instr->attrs[a + 1];
+            if(lv_streq(name, "styles")) continue; /*Styles will handle it themselves*/
+
+            if(value[0] == '$') {
+                instr->has_param = 1;
+            }
+            else if(value[0] == '#') {
+                const char * const_value = NULL;
+                lv_xml_const_t * c;
+                LV_LL_READ(&ctx->const_ll, c) {
+                    if(lv_streq(c->name, &value[1])) {
+                        const_value = c->value;
+                        break;
+                    }
+                }
+
+                lv_free((char *)instr->attrs[a + 1]);
+                if(const_value) {
+                    instr->attrs[a + 1] = lv_strdup(const_value);
+                }
+                else {
+                    /*If the const attribute is not provide don't set it*/
+                    lv_free((char *)instr->attrs[a]);
+                    instr->attrs[a] = lv_strdup("");
+                    instr->attrs[a + 1] = lv_strdup("");
+                }
+            }
+        }
+    }
 
-    /* Calculate and allocate length */
-    size_t len = end - start;
-    char * view_content = lv_malloc(len + 1);
-    if(!view_content) return NULL;
+    lv_array_shrink(&ctx->view_instrs);
+}
 
-    /* Copy content and null terminate */
-    lv_memcpy(view_content, start, len);
-    view_content[len] = '\0';
+static void view_instrs_free(lv_xml_component_ctx_t * ctx)
+{
+    uint32_t instr_cnt = lv_array_size(&ctx->view_instrs);
+    uint32_t i;
+    for(i = 0; i < instr_cnt; i++) {
+        lv_xml_view_instr_t * instr = lv_array_at(&ctx->view_instrs, i);
+        if(instr->name == NULL) continue;
+
+        if(!ctx->is_binary) {
+            uint32_t a;
+            for(a = 0; a < instr->attr_cnt * 2; a++) lv_free((char *)instr->attrs[a]);
+            lv_free((char *)instr->name);
+        }
+        lv_free(instr->attrs);
+    }
 
-    return view_content;
+    lv_array_deinit(&ctx->view_instrs);
+}
+
+static void styles_free(lv_xml_component_ctx_t * ctx)
+{
+    lv_xml_style_t * xml_style;
+    LV_LL_READ(&ctx->style_ll, xml_style) {
+        lv_free((char *)xml_style->name);
+        lv_free((char *)xml_style->long_name);
+        lv_style_reset(&xml_style->style);
+    }
+    lv_ll_clear(&ctx->style_ll);
+}
+
+/*Free the params, the constants and the styles. The strings of a binary component are in its buffer.*/
+static void metadata_free(lv_xml_component_ctx_t * ctx)
+{
+    if(!ctx->is_binary) {
+        lv_xml_param_t * param;
+        LV_LL_READ(&ctx->param_ll, param) {
+            lv_free((char *)param->name);
+            lv_free((char *)param->def);
+            lv_free((char *)param->type);
+        }
+
+        lv_xml_const_t * cnst;
+        LV_LL_READ(&ctx->const_ll, cnst) {
+            lv_free((char *)cnst->name);
+            lv_free((char *)cnst->value);
+        }
+    }
+    lv_ll_clear(&ctx->param_ll);
+    lv_ll_clear(&ctx->const_ll);
+
+    styles_free(ctx);
+}
+
+static char * read_file(const char * path, uint32_t * size)
+{
+    lv_fs_res_t fs_res;
+    lv_fs_file_t f;
+    fs_res = lv_fs_open(&f, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) {
+        LV_LOG_WARN("Couldn't open %s", path);
+        return NULL;
+    }
+
+    /* Determine file size */
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    uint32_t file_size = 0;
+    lv_fs_tell(&f, &file_size);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+
+    /* Create the buffer */
+    char * buf = lv_malloc(file_size + 1);
+    if(buf == NULL) {
+        LV_LOG_WARN("Memory allocation failed for file %s (%d bytes)", path, file_size + 1);
+        lv_fs_close(&f);
+        return NULL;
+    }
+
+    /* Read the file content  */
+    uint32_t rn;
+    lv_fs_read(&f, buf, file_size, &rn);
+    lv_fs_close(&f);
+    if(rn != file_size) {
+        LV_LOG_WARN("Couldn't read %s fully", path);
+        lv_free(buf);
+        return NULL;
+    }
+
+    /* Null-terminate the buffer */
+    buf[rn] = '\0';
+    if(size) *size = rn;
+
+    return buf;
+}
+
+static uint32_t bin_u32(const bin_reader_t * bin, uint32_t ofs)
+{
+    const uint8_t * p = bin->data + ofs;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t bin_u16(const bin_reader_t * bin, uint32_t ofs)
+{
+    const uint8_t * p = bin->data + ofs;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static const char * bin_str(const bin_reader_t * bin, uint32_t ref)
+{
+    if(ref == LV_XML_BIN_STR_NONE) return NULL;
+    return bin->str + ref;
+}
+
+static bool bin_str_valid(const bin_reader_t * bin, uint32_t ref, bool optional)
+{
+    if(ref == LV_XML_BIN_STR_NONE) return optional;
+    return ref < bin->str_size;
+}
+
+/**
+ * Check if a count-offset pair of the header describes an array inside the data
+ */
+static bool bin_array_valid(const bin_reader_t * bin, uint32_t hdr_ofs, uint32_t item_size)
+{
+    uint64_t cnt = bin_u32(bin, hdr_ofs);
+    uint64_t ofs = bin_u32(bin, hdr_ofs + 4);
+    return ofs + cnt * item_size <= bin->size;
+}
+
+/**
+ * Check all the offsets and string references once so that they can be used without checks later
+ */
+static bool bin_validate(bin_reader_t * bin)
+{
+    if(bin->data == NULL || bin->size < LV_XML_BIN_HEADER_SIZE) return false;
+    if(lv_memcmp(bin->data, LV_XML_BIN_MAGIC, 4) != 0) return false;
+    if(bin_u16(bin, BIN_HDR_VERSION) != LV_XML_BIN_VERSION) {
+        LV_LOG_WARN("Unsupported binary component version: %d", (int)bin_u16(bin, BIN_HDR_VERSION));
+        return false;
+    }
+
+    if(!bin_array_valid(bin, BIN_HDR_PARAMS, BIN_PARAM_SIZE)) return false;
+    if(!bin_array_valid(bin, BIN_HDR_CONSTS, BIN_CONST_SIZE)) return false;
+    if(!bin_array_valid(bin, BIN_HDR_STYLES, BIN_STYLE_SIZE)) return false;
+    if(!bin_array_valid(bin, BIN_HDR_INSTRS, BIN_INSTR_SIZE)) return false;
+    if(!bin_array_valid(bin, BIN_HDR_REFS, BIN_REF_SIZE)) return false;
+    if(!bin_array_valid(bin, BIN_HDR_STRS, 1)) return false;
+
+    /*The string table needs to be closed so that all the references are terminated*/
+    bin->str_size = bin_u32(bin, BIN_HDR_STRS);
+    bin->str = (const char *)bin->data + bin_u32(bin, BIN_HDR_STRS + 4);
+    if(bin->str_size == 0 || bin->str[bin->str_size - 1] != '\0') return false;
+
+    if(!bin_str_valid(bin, bin_u32(bin, BIN_HDR_NAME), false)) return false;
+    if(!bin_str_valid(bin, bin_u32(bin, BIN_HDR_EXTENDS), false)) return false;
+
+    uint32_t i;
+    uint32_t cnt = bin_u32(bin, BIN_HDR_PARAMS);
+    uint32_t ofs = bin_u32(bin, BIN_HDR_PARAMS + 4);
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_PARAM_SIZE;
+        if(!bin_str_valid(bin, bin_u32(bin, p), false)) return false;
+        if(!bin_str_valid(bin, bin_u32(bin, p + 4), true)) return false;
+        if(!bin_str_valid(bin, bin_u32(bin, p + 8), true)) return false;
+    }
+
+    cnt = bin_u32(bin, BIN_HDR_CONSTS);
+    ofs = bin_u32(bin, BIN_HDR_CONSTS + 4);
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_CONST_SIZE;
+        if(!bin_str_valid(bin, bin_u32(bin, p), false)) return false;
+        if(!bin_str_valid(bin, bin_u32(bin, p + 4), false)) return false;
+    }
+
+    uint32_t ref_cnt = bin_u32(bin, BIN_HDR_REFS);
+    ofs = bin_u32(bin, BIN_HDR_REFS + 4);
+    for(i = 0; i < ref_cnt; i++) {
+        if(!bin_str_valid(bin, bin_u32(bin, ofs + i * BIN_REF_SIZE), false)) return false;
+    }
+
+    cnt = bin_u32(bin, BIN_HDR_STYLES);
+    ofs = bin_u32(bin, BIN_HDR_STYLES + 4);
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_STYLE_SIZE;
+        if((uint64_t)bin_u32(bin, p + 4) + (uint64_t)bin_u32(bin, p) * 2 > ref_cnt) return false;
+    }
+
+    cnt = bin_u32(bin, BIN_HDR_INSTRS);
+    ofs = bin_u32(bin, BIN_HDR_INSTRS + 4);
+    if(cnt == 0) return false;   /*No view*/
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_INSTR_SIZE;
+        if(!bin_str_valid(bin, bin_u32(bin, p), true)) return false;
+        if((uint64_t)bin_u32(bin, p + 12) + (uint64_t)bin_u32(bin, p + 8) * 2 > ref_cnt) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Create a NULL terminated attribute list from the string references of a binary component
+ */
+static const char ** bin_attrs_create(const bin_reader_t * bin, uint32_t pair_cnt, uint32_t ref_idx)
+{
+    const char ** attrs = lv_malloc((pair_cnt * 2 + 1) * sizeof(const char *));
+    LV_ASSERT_MALLOC(attrs);
+    if(attrs == NULL) return NULL;
+
+    uint32_t ref_ofs = bin_u32(bin, BIN_HDR_REFS + 4) + ref_idx * BIN_REF_SIZE;
+    uint32_t i;
+    for(i = 0; i < pair_cnt * 2; i++) {
+        attrs[i] = bin_str(bin, bin_u32(bin, ref_ofs + i * BIN_REF_SIZE));
+    }
+    attrs[pair_cnt * 2] = NULL;
+
+    return attrs;
+}
+
+static lv_result_t register_from_binary(const void * data, uint32_t size, void * bin_buf)
+{
+    bin_reader_t bin;
+    lv_memzero(&bin, sizeof(bin));
+    bin.data = data;
+    bin.size = size;
+
+    if(!bin_validate(&bin)) {
+        LV_LOG_WARN("Invalid binary component");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_xml_parser_state_t state;
+    lv_xml_parser_state_init(&state);
+    lv_xml_component_ctx_t * ctx = &state.ctx;
+    const char * name = bin_str(&bin, bin_u32(&bin, BIN_HDR_NAME));
+    ctx->name = name;
+    ctx->is_binary = 1;
+    ctx->bin_buf = bin_buf;
+    ctx->is_widget = (bin_u16(&bin, BIN_HDR_FLAGS) & LV_XML_BIN_FLAG_WIDGET) ? 1 : 0;
+    ctx->root_widget = lv_xml_widget_get_processor(bin_str(&bin, bin_u32(&bin, BIN_HDR_EXTENDS)));
+
+    uint32_t i;
+    uint32_t cnt = bin_u32(&bin, BIN_HDR_PARAMS);
+    uint32_t ofs = bin_u32(&bin, BIN_HDR_PARAMS + 4);
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_PARAM_SIZE;
+        lv_xml_param_t * param = lv_ll_ins_tail(&ctx->param_ll);
+        param->name = bin_str(&bin, bin_u32(&bin, p));
+        param->type = bin_str(&bin, bin_u32(&bin, p + 4));
+        param->def = bin_str(&bin, bin_u32(&bin, p + 8));
+    }
+
+    cnt = bin_u32(&bin, BIN_HDR_CONSTS);
+    ofs = bin_u32(&bin, BIN_HDR_CONSTS + 4);
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_CONST_SIZE;
+        lv_xml_const_t * cnst = lv_ll_ins_tail(&ctx->const_ll);
+        cnst->name = bin_str(&bin, bin_u32(&bin, p));
+        cnst->value = bin_str(&bin, bin_u32(&bin, p + 4));
+    }
+
+    /* The styles are created from their attributes as when parsing the XML */
+    cnt = bin_u32(&bin, BIN_HDR_STYLES);
+    ofs = bin_u32(&bin, BIN_HDR_STYLES + 4);
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_STYLE_SIZE;
+        const char ** attrs = bin_attrs_create(&bin, bin_u32(&bin, p), bin_u32(&bin, p + 4));
+        if(attrs == NULL) continue;
+        lv_xml_style_register(ctx, attrs);
+        lv_free(attrs);
+    }
+
+    cnt = bin_u32(&bin, BIN_HDR_INSTRS);
+    ofs = bin_u32(&bin, BIN_HDR_INSTRS + 4);
+    lv_array_init(&ctx->view_instrs, cnt, sizeof(lv_xml_view_instr_t));
+    for(i = 0; i < cnt; i++) {
+        uint32_t p = ofs + i * BIN_INSTR_SIZE;
+        lv_xml_view_instr_t instr;
+        lv_memzero(&instr, sizeof(instr));
+        instr.name = bin_str(&bin, bin_u32(&bin, p));
+        if(instr.name) {
+            uint32_t flags = bin_u32(&bin, p + 4);
+            instr.is_view = (flags & LV_XML_BIN_INSTR_VIEW) ? 1 : 0;
+            instr.has_param = (flags & LV_XML_BIN_INSTR_PARAM) ? 1 : 0;
+            instr.attr_cnt = bin_u32(&bin, p + 8);
+            instr.attrs = bin_attrs_create(&bin, instr.attr_cnt, bin_u32(&bin, p + 12));
+            instr.processor = lv_xml_widget_get_processor(instr.name);
+            ctx->view_attr_max = LV_MAX(ctx->view_attr_max, instr.attr_cnt);
+            if(instr.attrs == NULL) {
+                view_instrs_free(ctx);
+                metadata_free(ctx);
+                return LV_RESULT_INVALID;
+            }
+        }
+        lv_array_push_back(&ctx->view_instrs, &instr);
+    }
+
+    /* Copy extracted metadata to component processor */
+    lv_xml_component_ctx_t * new_ctx = lv_ll_ins_head(&component_ctx_ll);
+    lv_memcpy(new_ctx, ctx, sizeof(lv_xml_component_ctx_t));
+    new_ctx->name = lv_strdup(name);
+
+    return LV_RESULT_OK;
 }
 
 #endif /* LV_USE_XML */
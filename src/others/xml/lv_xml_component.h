@@ -48,6 +48,24 @@ lv_result_t lv_xml_component_register_from_data(const char * name, const char *
  */
 lv_result_t lv_xml_component_register_from_file(const char * path);
 
+/**
+ * Load a component from binary data created by `scripts/xml_to_bin.py`.
+ * The strings are used from the data directly so it needs to be kept valid
+ * while the component is registered (e.g. it can be in flash or memory mapped).
+ * @param data      pointer to the binary data
+ * @param size      size of the data in bytes
+ * @return          LV_RES_OK: loaded successfully, LV_RES_INVALID: otherwise
+ */
+lv_result_t lv_xml_component_register_from_binary_data(const void * data, uint32_t size);
+
+/**
+ * Load a component from a binary file created by `scripts/xml_to_bin.py`.
+ * The component name is stored in the file.
+ * @param path      path to a binary file
+ * @return          LV_RES_OK: loaded successfully, LV_RES_INVALID: otherwise
+ */
+lv_result_t lv_xml_component_register_from_binary_file(const char * path);
+
 /**
  * Get the ctx of a component which was registered by
  * `lv_xml_component_register_from_data` or `lv_xml_component_register_from_file`
@@ -58,6 +76,7 @@ lv_xml_component_ctx_t * lv_xml_component_get_ctx(const char * component_name);
 
 /**
  * Remove a component from from the list.
+ * The styles of the component are freed too, so the widgets using them should be deleted first.
  * @param name      the name of the component (used during registration)
  * @return          LV_RESULT_OK on successful  unregistration, LV_RESULT_INVALID otherwise.
  */
@@ -18,6 +18,32 @@ extern "C" {
 
 #include "lv_xml_utils.h"
 #include "../../misc/lv_ll.h"
+#include "../../misc/lv_array.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Binary components created by `scripts/xml_to_bin.py`.
+ * All the values are little endian `uint32_t`s and all the offsets are from the beginning of the data.
+ * The header:
+ *   magic ("LVXB"), version (u16) and flags (u16, bit 0: `<widget>`),
+ *   name, extends (string references),
+ *   count and offset of the params (name, type, default),
+ *   count and offset of the consts (name, value),
+ *   count and offset of the styles (attribute pair count, index of the first reference),
+ *   count and offset of the view elements (name or none to close, flags, attribute pair count, index of the first reference),
+ *   count and offset of the string references of the attributes,
+ *   size and offset of the string table.
+ * A string reference is an offset in the string table of a `\0` terminated string or `LV_XML_BIN_STR_NONE`.
+ * The constants are already resolved in the view.*/
+#define LV_XML_BIN_MAGIC            "LVXB"
+#define LV_XML_BIN_VERSION          1
+#define LV_XML_BIN_HEADER_SIZE      64
+#define LV_XML_BIN_STR_NONE         0xFFFFFFFF
+#define LV_XML_BIN_FLAG_WIDGET      0x01
+#define LV_XML_BIN_INSTR_VIEW       0x01
+#define LV_XML_BIN_INSTR_PARAM      0x02
 
 /**********************
  *      TYPEDEFS
@@ -25,14 +51,30 @@ extern "C" {
 
 typedef  void * (*lv_xml_component_process_cb_t)(lv_obj_t * parent, const char * data, const char ** attrs);
 
+/**
+ * An element of a component's `<view>` parsed once when the component is registered.
+ * Creating the component replays the instructions instead of parsing the XML again.
+ */
+typedef struct {
+    const char * name;                          /**< Widget or component to create. NULL: closes the last element*/
+    struct _lv_widget_processor_t * processor;  /**< The widget processor or NULL if unknown at registration (e.g. components)*/
+    const char ** attrs;                        /**< NULL terminated name-value pairs with the constants already resolved*/
+    uint32_t attr_cnt : 30;                     /**< Number of name-value pairs in `attrs`*/
+    uint32_t is_view : 1;                       /**< 1: it's the `<view>` element itself*/
+    uint32_t has_param : 1;                     /**< 1: some values refer to `$params` and need to be resolved on creation*/
+} lv_xml_view_instr_t;
+
 struct _lv_xml_component_ctx_t {
     const char * name;
     lv_ll_t style_ll;
     lv_ll_t const_ll;
     lv_ll_t param_ll;
-    const char * view_def;
+    lv_array_t view_instrs;                         /*Elements of the view as `lv_xml_view_instr_t`*/
+    uint32_t view_attr_max;                         /*The most attribute name-value pairs of an element*/
     struct _lv_widget_processor_t * root_widget;
+    void * bin_buf;                                 /*The loaded binary file if registered from a binary file*/
     uint32_t is_widget : 1;                         /*1: not component but widget registered as a component for preview*/
+    uint32_t is_binary : 1;                         /*1: the strings point into a binary data and shouldn't be freed*/
     struct _lv_xml_component_ctx_t * next;
 };
 
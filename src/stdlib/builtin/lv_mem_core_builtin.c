@@ -15,6 +15,7 @@
 #include "../../misc/lv_ll.h"
 #include "../../misc/lv_math.h"
 #include "../../osal/lv_os.h"
+#include "../../osal/lv_atomic_private.h"
 #include "../../core/lv_global.h"
 
 #ifdef LV_MEM_POOL_INCLUDE
@@ -38,18 +39,70 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_MEM_USE_THREAD_CACHE
+    #ifndef LV_THREAD_LOCAL
+        #error "LV_MEM_THREAD_CACHE_CNT requires thread-local storage support"
+    #endif
+
+    /*Large enough for a `cached_block_t`*/
+    #define THREAD_CACHE_MIN_SIZE   16
+    #define THREAD_CACHE_MAX_SIZE   (THREAD_CACHE_MIN_SIZE << (LV_MEM_THREAD_CACHE_CLASS_CNT - 1))
+
+    /*Number of blocks moved between a thread cache and the heap with one lock*/
+    #define THREAD_CACHE_BATCH_CNT  LV_MAX(LV_MEM_THREAD_CACHE_CNT / 2, 1)
+
+    /*Every block starts with a header: the size of the heap block if it belongs to a thread cache,
+     *else 0. Unlike the TLSF header it's written only by the allocating thread,
+     *so `lv_free` and `lv_realloc` can read it without locking the heap.*/
+    #define BLOCK_HEADER_SIZE       sizeof(MEM_UNIT)
+    #define BLOCK_HEADER(p)         (((MEM_UNIT *)(p))[-1])
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_USE_THREAD_CACHE
+/*The free blocks of a thread cache are linked in place and keep the size of their heap block*/
+typedef struct _cached_block_t {
+    struct _cached_block_t * next;
+    size_t size;
+} cached_block_t;
+
+typedef struct _thread_cache_t {
+    struct _thread_cache_t * next;  /*In the list of all thread caches*/
+    size_t size;                    /*Total size of the cached blocks*/
+    struct {
+        cached_block_t * head;      /*Free blocks linked in place*/
+        uint32_t cnt;
+        uint32_t hit_cnt;
+        uint32_t miss_cnt;
+    } classes[LV_MEM_THREAD_CACHE_CLASS_CNT];
+} thread_cache_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+#if LV_MEM_USE_THREAD_CACHE
+    static thread_cache_t * get_thread_cache(void);
+    static thread_cache_t * get_or_create_thread_cache(void);
+    static void * thread_cache_malloc(size_t size);
+    static bool thread_cache_free(void * p, size_t size);
+    static void thread_cache_return_no_lock(thread_cache_t * tc, uint32_t class_id, uint32_t cnt);
+    static void thread_cache_monitor(lv_mem_monitor_t * mon_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_MEM_USE_THREAD_CACHE
+/*The cache of the current thread. It's valid only if `thread_cache_gen` matches `mem_gen`,
+ *as the cache is allocated from the heap which is destroyed by `lv_mem_deinit`.*/
+static LV_THREAD_LOCAL thread_cache_t * thread_cache;
+static LV_THREAD_LOCAL uint32_t thread_cache_gen;
+static uint32_t mem_gen;
+#endif
 
 /**********************
  *      MACROS
@@ -74,6 +127,14 @@ void lv_mem_init(void)
     lv_mutex_init(&state.mutex);
 #endif
 
+#if LV_MEM_USE_THREAD_CACHE
+    /*Invalidate the thread caches of the previous heap*/
+    mem_gen++;
+    state.thread_caches = NULL;
+    lv_memzero(state.thread_cache_hit_cnt, sizeof(state.thread_cache_hit_cnt));
+    lv_memzero(state.thread_cache_miss_cnt, sizeof(state.thread_cache_miss_cnt));
+#endif
+
 #if LV_MEM_ADR == 0
 #ifdef LV_MEM_POOL_ALLOC
     state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
@@ -138,6 +199,16 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
 
 void * lv_malloc_core(size_t size)
 {
+#if LV_MEM_USE_THREAD_CACHE
+    if(size <= THREAD_CACHE_MAX_SIZE) {
+        void * p = thread_cache_malloc(size);
+        if(p) return p;
+    }
+
+    if(size > SIZE_MAX - BLOCK_HEADER_SIZE) return NULL;
+    size += BLOCK_HEADER_SIZE;
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -151,11 +222,40 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
 #endif
+
+#if LV_MEM_USE_THREAD_CACHE
+    if(p) {
+        /*Not cached, it goes back to the heap when it's freed*/
+        *(MEM_UNIT *)p = 0;
+        p = (uint8_t *)p + BLOCK_HEADER_SIZE;
+    }
+#endif
     return p;
 }
 
 void * lv_realloc_core(void * p, size_t new_size)
 {
+#if LV_MEM_USE_THREAD_CACHE
+    if(p == NULL) return lv_malloc_core(new_size);
+
+    size_t cached_size = BLOCK_HEADER(p);
+    if(cached_size) {
+        /*Move the block between the thread cache's classes to avoid locking the heap*/
+        size_t old_size = cached_size - BLOCK_HEADER_SIZE;
+        if(new_size <= old_size) return p;
+
+        void * p_new = lv_malloc_core(new_size);
+        if(p_new == NULL) return NULL;
+        lv_memcpy(p_new, p, old_size);
+        lv_free_core(p);
+        return p_new;
+    }
+
+    if(new_size > SIZE_MAX - BLOCK_HEADER_SIZE) return NULL;
+    new_size += BLOCK_HEADER_SIZE;
+    p = (uint8_t *)p - BLOCK_HEADER_SIZE;
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -172,19 +272,32 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_unlock(&state.mutex);
 #endif
 
+#if LV_MEM_USE_THREAD_CACHE
+    /*The header (0) is kept by `lv_tlsf_realloc`*/
+    if(p_new) p_new = (uint8_t *)p_new + BLOCK_HEADER_SIZE;
+#endif
     return p_new;
 }
 
 void lv_free_core(void * p)
 {
+#if LV_MEM_USE_THREAD_CACHE
+    size_t cached_size = BLOCK_HEADER(p);
+    p = (uint8_t *)p - BLOCK_HEADER_SIZE;
+    if(cached_size && thread_cache_free(p, cached_size)) return;
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
 
+    /*The TLSF header can be modified by the heap when the neighbor blocks are allocated or freed
+     *so it's read under the lock*/
+    size_t size = lv_tlsf_block_size(p);
+
 #if LV_MEM_ADD_JUNK
-    lv_memset(p, 0xbb, lv_tlsf_block_size(data));
+    lv_memset(p, 0xbb, size);
 #endif
-    size_t size = lv_tlsf_block_size(p);
     lv_tlsf_free(state.tlsf, p);
     if(state.cur_used > size) state.cur_used -= size;
     else state.cur_used = 0;
@@ -205,6 +318,10 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
+#if LV_MEM_USE_THREAD_CACHE
+    thread_cache_monitor(mon_p);
+#endif
+
     mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
@@ -219,6 +336,35 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     LV_TRACE_MEM("finished");
 }
 
+#if LV_MEM_USE_THREAD_CACHE
+void lv_mem_thread_cache_flush(void)
+{
+    thread_cache_t * tc = get_thread_cache();
+    if(tc == NULL) return;
+
+    lv_mutex_lock(&state.mutex);
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_CACHE_CLASS_CNT; i++) {
+        thread_cache_return_no_lock(tc, i, tc->classes[i].cnt);
+        state.thread_cache_hit_cnt[i] += tc->classes[i].hit_cnt;
+        state.thread_cache_miss_cnt[i] += tc->classes[i].miss_cnt;
+    }
+
+    /*Unlink and free the cache itself too as the thread is probably about to exit*/
+    thread_cache_t ** tc_p = (thread_cache_t **)&state.thread_caches;
+    while(*tc_p != tc) tc_p = &(*tc_p)->next;
+    *tc_p = tc->next;
+
+    size_t size = lv_tlsf_block_size(tc);
+    lv_tlsf_free(state.tlsf, tc);
+    if(state.cur_used > size) state.cur_used -= size;
+    else state.cur_used = 0;
+    lv_mutex_unlock(&state.mutex);
+
+    thread_cache = NULL;
+}
+#endif
+
 lv_result_t lv_mem_test_core(void)
 {
 #if LV_USE_OS
@@ -254,6 +400,166 @@ lv_result_t lv_mem_test_core(void)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_MEM_USE_THREAD_CACHE
+
+/**
+ * Get the cache of the current thread
+ * @return      the cache or NULL if it's not created yet
+ */
+static thread_cache_t * get_thread_cache(void)
+{
+    if(thread_cache_gen != mem_gen) {
+        thread_cache = NULL;
+        thread_cache_gen = mem_gen;
+    }
+
+    return thread_cache;
+}
+
+static thread_cache_t * get_or_create_thread_cache(void)
+{
+    thread_cache_t * tc = get_thread_cache();
+    if(tc) return tc;
+
+    lv_mutex_lock(&state.mutex);
+    tc = lv_tlsf_malloc(state.tlsf, sizeof(thread_cache_t));
+    if(tc) {
+        lv_memzero(tc, sizeof(thread_cache_t));
+        tc->next = state.thread_caches;
+        state.thread_caches = tc;
+        state.cur_used += lv_tlsf_block_size(tc);
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+    lv_mutex_unlock(&state.mutex);
+
+    thread_cache = tc;
+    return tc;
+}
+
+static void * thread_cache_malloc(size_t size)
+{
+    uint32_t class_id = 0;
+    while((size_t)(THREAD_CACHE_MIN_SIZE << class_id) < size) class_id++;
+
+    thread_cache_t * tc = get_or_create_thread_cache();
+    if(tc == NULL) return NULL;
+
+    if(tc->classes[class_id].head == NULL) {
+        /*Refill a batch of blocks with one lock*/
+        tc->classes[class_id].miss_cnt++;
+
+        size_t block_size = (THREAD_CACHE_MIN_SIZE << class_id) + BLOCK_HEADER_SIZE;
+        lv_mutex_lock(&state.mutex);
+        uint32_t i;
+        for(i = 0; i < THREAD_CACHE_BATCH_CNT; i++) {
+            void * p = lv_tlsf_malloc(state.tlsf, block_size);
+            if(p == NULL) break;
+            cached_block_t * block = p;
+            block->size = lv_tlsf_block_size(p);
+            state.cur_used += block->size;
+            tc->size += block->size;
+            block->next = tc->classes[class_id].head;
+            tc->classes[class_id].head = block;
+            tc->classes[class_id].cnt++;
+        }
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+        lv_mutex_unlock(&state.mutex);
+
+        if(tc->classes[class_id].head == NULL) return NULL;
+    }
+    else {
+        tc->classes[class_id].hit_cnt++;
+    }
+
+    cached_block_t * block = tc->classes[class_id].head;
+    tc->classes[class_id].head = block->next;
+    tc->classes[class_id].cnt--;
+    size_t block_size = block->size;
+    tc->size -= block_size;
+
+    MEM_UNIT * header = (MEM_UNIT *)block;
+    *header = block_size;
+    return header + 1;
+}
+
+static bool thread_cache_free(void * p, size_t size)
+{
+    /*The largest class the block can serve*/
+    uint32_t class_id = LV_MEM_THREAD_CACHE_CLASS_CNT - 1;
+    while((size_t)(THREAD_CACHE_MIN_SIZE << class_id) + BLOCK_HEADER_SIZE > size) class_id--;
+
+    thread_cache_t * tc = get_or_create_thread_cache();
+    if(tc == NULL) return false;
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, size);
+#endif
+
+    cached_block_t * block = p;
+    block->next = tc->classes[class_id].head;
+    block->size = size;
+    tc->classes[class_id].head = block;
+    tc->classes[class_id].cnt++;
+    tc->size += size;
+
+    if(tc->classes[class_id].cnt > LV_MEM_THREAD_CACHE_CNT) {
+        lv_mutex_lock(&state.mutex);
+        thread_cache_return_no_lock(tc, class_id, THREAD_CACHE_BATCH_CNT);
+        lv_mutex_unlock(&state.mutex);
+    }
+
+    return true;
+}
+
+static void thread_cache_return_no_lock(thread_cache_t * tc, uint32_t class_id, uint32_t cnt)
+{
+    while(cnt > 0 && tc->classes[class_id].head) {
+        cached_block_t * block = tc->classes[class_id].head;
+        tc->classes[class_id].head = block->next;
+        tc->classes[class_id].cnt--;
+        cnt--;
+
+        size_t size = block->size;
+        tc->size -= size;
+        lv_tlsf_free(state.tlsf, block);
+        if(state.cur_used > size) state.cur_used -= size;
+        else state.cur_used = 0;
+    }
+}
+
+static void thread_cache_monitor(lv_mem_monitor_t * mon_p)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_CACHE_CLASS_CNT; i++) {
+        mon_p->thread_cache[i].block_size = THREAD_CACHE_MIN_SIZE << i;
+    }
+
+    lv_mutex_lock(&state.mutex);
+    for(i = 0; i < LV_MEM_THREAD_CACHE_CLASS_CNT; i++) {
+        mon_p->thread_cache[i].hit_cnt = state.thread_cache_hit_cnt[i];
+        mon_p->thread_cache[i].miss_cnt = state.thread_cache_miss_cnt[i];
+    }
+
+    /*The counters are updated without locking by their threads, it's fine for statistics*/
+    thread_cache_t * tc;
+    for(tc = state.thread_caches; tc; tc = tc->next) {
+        for(i = 0; i < LV_MEM_THREAD_CACHE_CLASS_CNT; i++) {
+            mon_p->thread_cache[i].cached_cnt += tc->classes[i].cnt;
+            mon_p->thread_cache[i].hit_cnt += tc->classes[i].hit_cnt;
+            mon_p->thread_cache[i].miss_cnt += tc->classes[i].miss_cnt;
+            mon_p->used_cnt -= tc->classes[i].cnt;
+            mon_p->free_cnt += tc->classes[i].cnt;
+        }
+        mon_p->thread_cache_size += tc->size;
+    }
+    lv_mutex_unlock(&state.mutex);
+
+    /*The cached blocks are free for the application*/
+    mon_p->free_size += mon_p->thread_cache_size;
+}
+
+#endif /*LV_MEM_USE_THREAD_CACHE*/
+
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
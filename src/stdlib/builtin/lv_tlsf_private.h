@@ -18,6 +18,7 @@ extern "C" {
 
 #include "lv_tlsf.h"
 #include "../../osal/lv_os.h"
+#include "../lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -35,6 +36,11 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_USE_THREAD_CACHE
+    void * thread_caches;   /**< Linked list of the per-thread caches*/
+    uint32_t thread_cache_hit_cnt[LV_MEM_THREAD_CACHE_CLASS_CNT];   /**< Counters of the already flushed caches*/
+    uint32_t thread_cache_miss_cnt[LV_MEM_THREAD_CACHE_CLASS_CNT];
+#endif
 } lv_tlsf_state_t;
 
 /**********************
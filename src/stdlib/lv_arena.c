@@ -0,0 +1,161 @@
+/**
+ * @file lv_arena.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_arena.h"
+#include "lv_mem.h"
+#include "lv_string.h"
+#include "../misc/lv_math.h"
+#include "../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_arena_chunk_t {
+    lv_arena_chunk_t * next;    /**< The previously allocated chunk*/
+    uint8_t * cur;              /**< The first free byte*/
+    uint8_t * end;              /**< The end of the chunk*/
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_arena_chunk_t * chunk_create(size_t size);
+static void * chunk_alloc(lv_arena_chunk_t * chunk, size_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_arena_init(lv_arena_t * arena, uint32_t chunk_size)
+{
+    LV_ASSERT_NULL(arena);
+    lv_memzero(arena, sizeof(lv_arena_t));
+    arena->chunk_size = chunk_size;
+}
+
+void * lv_arena_alloc(lv_arena_t * arena, size_t size)
+{
+    LV_ASSERT_NULL(arena);
+
+    void * p = NULL;
+    if(arena->chunk_head) p = chunk_alloc(arena->chunk_head, size);
+
+    if(p == NULL) {
+        /*Reserve space for the alignment too*/
+        lv_arena_chunk_t * chunk = chunk_create(LV_MAX(arena->chunk_size, size + LV_ARENA_ALIGN));
+        if(chunk == NULL) return NULL;
+
+        chunk->next = arena->chunk_head;
+        arena->chunk_head = chunk;
+        p = chunk_alloc(chunk, size);
+    }
+
+    arena->used += size;
+    arena->max_used = LV_MAX(arena->max_used, arena->used);
+    return p;
+}
+
+void * lv_arena_alloc_zeroed(lv_arena_t * arena, size_t size)
+{
+    void * p = lv_arena_alloc(arena, size);
+    if(p) lv_memzero(p, size);
+    return p;
+}
+
+bool lv_arena_contains(const lv_arena_t * arena, const void * p)
+{
+    LV_ASSERT_NULL(arena);
+
+    const uint8_t * p8 = p;
+    const lv_arena_chunk_t * chunk;
+    for(chunk = arena->chunk_head; chunk; chunk = chunk->next) {
+        if(p8 > (const uint8_t *)chunk && p8 < chunk->end) return true;
+    }
+
+    return false;
+}
+
+void lv_arena_free(lv_arena_t * arena, void * p)
+{
+    if(p == NULL) return;
+    if(lv_arena_contains(arena, p)) return;
+
+    lv_free(p);
+}
+
+void lv_arena_reset(lv_arena_t * arena)
+{
+    LV_ASSERT_NULL(arena);
+
+    lv_arena_chunk_t * chunk = arena->chunk_head;
+    if(chunk == NULL) return;
+
+    /*Keep only the first chunk as it's large enough for the typical use*/
+    while(chunk->next) {
+        lv_arena_chunk_t * next = chunk->next;
+        lv_free(chunk);
+        chunk = next;
+    }
+
+    chunk->cur = (uint8_t *)chunk + sizeof(lv_arena_chunk_t);
+    arena->chunk_head = chunk;
+    arena->used = 0;
+}
+
+void lv_arena_deinit(lv_arena_t * arena)
+{
+    LV_ASSERT_NULL(arena);
+
+    lv_arena_chunk_t * chunk = arena->chunk_head;
+    while(chunk) {
+        lv_arena_chunk_t * next = chunk->next;
+        lv_free(chunk);
+        chunk = next;
+    }
+
+    arena->chunk_head = NULL;
+    arena->used = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_arena_chunk_t * chunk_create(size_t size)
+{
+    lv_arena_chunk_t * chunk = lv_malloc(sizeof(lv_arena_chunk_t) + size);
+    LV_ASSERT_MALLOC(chunk);
+    if(chunk == NULL) return NULL;
+
+    chunk->next = NULL;
+    chunk->cur = (uint8_t *)chunk + sizeof(lv_arena_chunk_t);
+    chunk->end = chunk->cur + size;
+    return chunk;
+}
+
+static void * chunk_alloc(lv_arena_chunk_t * chunk, size_t size)
+{
+    uint8_t * p = (uint8_t *)LV_ALIGN_UP((lv_uintptr_t)chunk->cur, LV_ARENA_ALIGN);
+    if(p > chunk->end || (size_t)(chunk->end - p) < size) return NULL;
+
+    chunk->cur = p + size;
+    return p;
+}
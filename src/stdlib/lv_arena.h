@@ -0,0 +1,105 @@
+/**
+ * @file lv_arena.h
+ * Bump allocator for memory with a common lifetime. Allocations are not freed one by one
+ * but all together by resetting the arena.
+ */
+
+#ifndef LV_ARENA_H
+#define LV_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Alignment of the memory returned by an arena*/
+#define LV_ARENA_ALIGN  8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_arena_chunk_t lv_arena_chunk_t;
+
+/** Description of an arena*/
+struct _lv_arena_t {
+    lv_arena_chunk_t * chunk_head;  /**< The chunk to allocate from. The first allocated chunk is the last*/
+    uint32_t chunk_size;            /**< Size of the chunks in bytes*/
+    size_t used;                    /**< Memory allocated since the last reset in bytes*/
+    size_t max_used;                /**< The largest `used` ever seen. Useful to tune `chunk_size`*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an arena. Memory is allocated only on the first `lv_arena_alloc()`.
+ * @param arena         pointer to an `lv_arena_t` variable to initialize
+ * @param chunk_size    the arena allocates its memory in chunks of this size [bytes].
+ *                      Larger allocations get a dedicated chunk.
+ */
+void lv_arena_init(lv_arena_t * arena, uint32_t chunk_size);
+
+/**
+ * Allocate memory from an arena
+ * @param arena     pointer to an initialized arena
+ * @param size      size of the memory to allocate in bytes
+ * @return          pointer to the allocated memory aligned to `LV_ARENA_ALIGN` or NULL if out of memory
+ */
+void * lv_arena_alloc(lv_arena_t * arena, size_t size);
+
+/**
+ * Allocate zeroed memory from an arena
+ * @param arena     pointer to an initialized arena
+ * @param size      size of the memory to allocate in bytes
+ * @return          pointer to the allocated memory or NULL if out of memory
+ */
+void * lv_arena_alloc_zeroed(lv_arena_t * arena, size_t size);
+
+/**
+ * Check if a memory was allocated from an arena
+ * @param arena     pointer to an initialized arena
+ * @param p         pointer to a memory
+ * @return          true: `p` points into one of the chunks of the arena
+ */
+bool lv_arena_contains(const lv_arena_t * arena, const void * p);
+
+/**
+ * Free a memory which was allocated either from an arena or by `lv_malloc()`.
+ * Arena memory is not reused until `lv_arena_reset()`, other memory is freed by `lv_free()`.
+ * @param arena     pointer to an initialized arena
+ * @param p         pointer to the memory to free
+ */
+void lv_arena_free(lv_arena_t * arena, void * p);
+
+/**
+ * Release all the allocations of an arena at once. The first chunk is kept for
+ * the next allocations, the others are freed.
+ * @param arena     pointer to an initialized arena
+ */
+void lv_arena_reset(lv_arena_t * arena);
+
+/**
+ * Free all the memory of an arena
+ * @param arena     pointer to an initialized arena
+ */
+void lv_arena_deinit(lv_arena_t * arena);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ARENA_H*/
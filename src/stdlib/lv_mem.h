@@ -23,6 +23,15 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_OS
+    #define LV_MEM_USE_THREAD_CACHE (LV_MEM_THREAD_CACHE_CNT > 0)
+#else
+    #define LV_MEM_USE_THREAD_CACHE 0
+#endif
+
+/** Number of size classes of the per-thread caches: 16, 32, 64, 128 and 256 bytes */
+#define LV_MEM_THREAD_CACHE_CLASS_CNT   5
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,6 +50,15 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+#if LV_MEM_USE_THREAD_CACHE
+    size_t thread_cache_size;       /**< Size of the free blocks held by the per-thread caches (included in `free_size`) */
+    struct {
+        uint32_t block_size;        /**< Size of the blocks of the class */
+        uint32_t cached_cnt;        /**< Number of blocks held by all threads */
+        uint32_t hit_cnt;           /**< Number of allocations served by a thread cache */
+        uint32_t miss_cnt;          /**< Number of allocations which had to refill a thread cache from the heap */
+    } thread_cache[LV_MEM_THREAD_CACHE_CLASS_CNT];
+#endif
 } lv_mem_monitor_t;
 
 /**********************
@@ -145,6 +163,15 @@ lv_result_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_MEM_USE_THREAD_CACHE
+/**
+ * Return the small blocks cached by the calling thread to the heap.
+ * It's called automatically when a thread created by `lv_thread_init` returns.
+ * Other threads which allocated from LVGL's heap should call it before they exit.
+ */
+void lv_mem_thread_cache_flush(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -66,15 +66,18 @@ uint32_t lv_tick_get(void)
 
 uint32_t lv_tick_elaps(uint32_t prev_tick)
 {
-    uint32_t act_time = lv_tick_get();
+    return lv_tick_diff(lv_tick_get(), prev_tick);
+}
 
+uint32_t lv_tick_diff(uint32_t tick, uint32_t prev_tick)
+{
     /*If there is no overflow in sys_time simple subtract*/
-    if(act_time >= prev_tick) {
-        prev_tick = act_time - prev_tick;
+    if(tick >= prev_tick) {
+        prev_tick = tick - prev_tick;
     }
     else {
         prev_tick = UINT32_MAX - prev_tick + 1;
-        prev_tick += act_time;
+        prev_tick += tick;
     }
 
     return prev_tick;
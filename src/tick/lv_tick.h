@@ -54,6 +54,14 @@ uint32_t lv_tick_get(void);
  */
 uint32_t lv_tick_elaps(uint32_t prev_tick);
 
+/**
+ * Get the elapsed milliseconds between two time stamps
+ * @param tick          a time stamp (return value of lv_tick_get() )
+ * @param prev_tick     an earlier time stamp
+ * @return              the elapsed milliseconds from 'prev_tick' to 'tick'
+ */
+uint32_t lv_tick_diff(uint32_t tick, uint32_t prev_tick);
+
 /**
  * Delay for the given milliseconds.
  * By default it's a blocking delay, but with `lv_delay_set_cb()`
@@ -15,6 +15,7 @@
 #if LV_USE_CANVAS != 0
 #include "../../misc/lv_assert.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_area_private.h"
 #include "../../draw/lv_draw_private.h"
 #include "../../core/lv_refr.h"
 #include "../../display/lv_display.h"
@@ -35,6 +36,9 @@
  **********************/
 static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void set_px(lv_draw_buf_t * draw_buf, int32_t x, int32_t y, lv_color_t color, lv_opa_t opa);
+static bool get_layer_draw_area(lv_layer_t * layer, lv_area_t * area);
+static void invalidate_buf_area(lv_obj_t * obj, const lv_area_t * buf_area);
 
 /**********************
  *  STATIC VARIABLES
@@ -109,72 +113,39 @@ void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
-    lv_draw_buf_t * draw_buf = canvas->draw_buf;
+    set_px(canvas->draw_buf, x, y, color, opa);
 
-    lv_color_format_t cf = draw_buf->header.cf;
-    uint8_t * data = lv_draw_buf_goto_xy(draw_buf, x, y);
+    lv_area_t area = {x, y, x, y};
+    invalidate_buf_area(obj, &area);
+}
 
-    if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
-        uint8_t shift;
-        uint8_t c_int = color.blue;
-        switch(cf) {
-            case LV_COLOR_FORMAT_I1:
-                shift = 7 - (x & 0x7);
-                break;
-            case LV_COLOR_FORMAT_I2:
-                shift = 6 - 2 * (x & 0x3);
-                break;
-            case LV_COLOR_FORMAT_I4:
-                shift = 4 - 4 * (x & 0x1);
-                break;
-            case LV_COLOR_FORMAT_I8:
-                /*Indexed8 format is a easy case, process and return.*/
-                *data = c_int;
-            default:
-                return;
-        }
+void lv_canvas_set_px_spans(lv_obj_t * obj, const lv_canvas_span_t * spans, uint32_t span_cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(spans);
 
-        uint8_t bpp = lv_color_format_get_bpp(cf);
-        uint8_t mask = (1 << bpp) - 1;
-        c_int &= mask;
-        *data = (*data & ~(mask << shift)) | (c_int << shift);
-    }
-    else if(cf == LV_COLOR_FORMAT_L8) {
-        *data = lv_color_luminance(color);
-    }
-    else if(cf == LV_COLOR_FORMAT_A8) {
-        *data = opa;
-    }
-    else if(cf == LV_COLOR_FORMAT_RGB565) {
-        lv_color16_t * buf = (lv_color16_t *)data;
-        buf->red = color.red >> 3;
-        buf->green = color.green >> 2;
-        buf->blue = color.blue >> 3;
-    }
-    else if(cf == LV_COLOR_FORMAT_RGB888) {
-        data[2] = color.red;
-        data[1] = color.green;
-        data[0] = color.blue;
-    }
-    else if(cf == LV_COLOR_FORMAT_XRGB8888) {
-        data[2] = color.red;
-        data[1] = color.green;
-        data[0] = color.blue;
-        data[3] = 0xFF;
-    }
-    else if(cf == LV_COLOR_FORMAT_ARGB8888) {
-        lv_color32_t * buf = (lv_color32_t *)data;
-        buf->red = color.red;
-        buf->green = color.green;
-        buf->blue = color.blue;
-        buf->alpha = opa;
-    }
-    else if(cf == LV_COLOR_FORMAT_AL88) {
-        lv_color16a_t * buf = (lv_color16a_t *)data;
-        buf->lumi = lv_color_luminance(color);
-        buf->alpha = 255;
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_draw_buf_t * draw_buf = canvas->draw_buf;
+    if(draw_buf == NULL) return;
+
+    lv_area_t buf_area = {0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1};
+    lv_area_t inv_area;
+    bool has_inv_area = false;
+    uint32_t i;
+    for(i = 0; i < span_cnt; i++) {
+        const lv_canvas_span_t * span = &spans[i];
+        lv_area_t area = {span->x, span->y, span->x + span->len - 1, span->y};
+        if(!lv_area_intersect(&area, &area, &buf_area)) continue;
+
+        int32_t x;
+        for(x = area.x1; x <= area.x2; x++) set_px(draw_buf, x, area.y1, span->color, span->opa);
+
+        if(has_inv_area) lv_area_join(&inv_area, &inv_area, &area);
+        else inv_area = area;
+        has_inv_area = true;
     }
-    lv_obj_invalidate(obj);
+
+    if(has_inv_area) invalidate_buf_area(obj, &inv_area);
 }
 
 void lv_canvas_set_palette(lv_obj_t * obj, uint8_t index, lv_color32_t color)
@@ -359,7 +330,7 @@ void lv_canvas_fill_bg(lv_obj_t * obj, lv_color_t color, lv_opa_t opa)
     else {
         for(y = 0; y < header->h; y++) {
             for(x = 0; x < header->w; x++) {
-                lv_canvas_set_px(obj, x, y, color, opa);
+                set_px(draw_buf, x, y, color, opa);
             }
         }
     }
@@ -392,6 +363,10 @@ void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
 {
     if(layer->draw_task_head == NULL) return;
 
+    /*Get the area before the tasks are finished and removed*/
+    lv_area_t inv_area;
+    bool has_inv_area = get_layer_draw_area(layer, &inv_area);
+
     bool task_dispatched;
 
     while(layer->draw_task_head) {
@@ -403,7 +378,8 @@ void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
             lv_draw_dispatch_request();
         }
     }
-    lv_obj_invalidate(canvas);
+
+    if(has_inv_area) invalidate_buf_area(canvas, &inv_area);
 }
 
 uint32_t lv_canvas_buf_size(int32_t w, int32_t h, uint8_t bpp, uint8_t stride)
@@ -432,4 +408,132 @@ static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_image_cache_drop(&canvas->draw_buf);
 }
 
+static void set_px(lv_draw_buf_t * draw_buf, int32_t x, int32_t y, lv_color_t color, lv_opa_t opa)
+{
+    lv_color_format_t cf = draw_buf->header.cf;
+    uint8_t * data = lv_draw_buf_goto_xy(draw_buf, x, y);
+
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        uint8_t shift;
+        uint8_t c_int = color.blue;
+        switch(cf) {
+            case LV_COLOR_FORMAT_I1:
+                shift = 7 - (x & 0x7);
+                break;
+            case LV_COLOR_FORMAT_I2:
+                shift = 6 - 2 * (x & 0x3);
+                break;
+            case LV_COLOR_FORMAT_I4:
+                shift = 4 - 4 * (x & 0x1);
+                break;
+            case LV_COLOR_FORMAT_I8:
+                /*Indexed8 format is a easy case, process and return.*/
+                *data = c_int;
+            default:
+                return;
+        }
+
+        uint8_t bpp = lv_color_format_get_bpp(cf);
+        uint8_t mask = (1 << bpp) - 1;
+        c_int &= mask;
+        *data = (*data & ~(mask << shift)) | (c_int << shift);
+    }
+    else if(cf == LV_COLOR_FORMAT_L8) {
+        *data = lv_color_luminance(color);
+    }
+    else if(cf == LV_COLOR_FORMAT_A8) {
+        *data = opa;
+    }
+    else if(cf == LV_COLOR_FORMAT_RGB565) {
+        lv_color16_t * buf = (lv_color16_t *)data;
+        buf->red = color.red >> 3;
+        buf->green = color.green >> 2;
+        buf->blue = color.blue >> 3;
+    }
+    else if(cf == LV_COLOR_FORMAT_RGB888) {
+        data[2] = color.red;
+        data[1] = color.green;
+        data[0] = color.blue;
+    }
+    else if(cf == LV_COLOR_FORMAT_XRGB8888) {
+        data[2] = color.red;
+        data[1] = color.green;
+        data[0] = color.blue;
+        data[3] = 0xFF;
+    }
+    else if(cf == LV_COLOR_FORMAT_ARGB8888) {
+        lv_color32_t * buf = (lv_color32_t *)data;
+        buf->red = color.red;
+        buf->green = color.green;
+        buf->blue = color.blue;
+        buf->alpha = opa;
+    }
+    else if(cf == LV_COLOR_FORMAT_AL88) {
+        lv_color16a_t * buf = (lv_color16a_t *)data;
+        buf->lumi = lv_color_luminance(color);
+        buf->alpha = 255;
+    }
+}
+
+/**
+ * Get the area of the canvas which is modified by the draw tasks of a layer
+ * @param layer     pointer to a layer initialized by `lv_canvas_init_layer`
+ * @param area      store the bounding box of the drawn areas here
+ * @return          false: nothing is drawn on the canvas
+ */
+static bool get_layer_draw_area(lv_layer_t * layer, lv_area_t * area)
+{
+    bool has_area = false;
+    lv_draw_task_t * t;
+    for(t = layer->draw_task_head; t; t = t->next) {
+        lv_area_t draw_area;
+        if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) continue;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        /*The areas are not transformed yet*/
+        if(!lv_matrix_is_identity_or_translation(&t->matrix)) draw_area = layer->buf_area;
+        else draw_area = lv_matrix_transform_area(&t->matrix, &draw_area);
+#endif
+
+        if(has_area) lv_area_join(area, area, &draw_area);
+        else *area = draw_area;
+        has_area = true;
+    }
+
+    return has_area && lv_area_intersect(area, area, &layer->buf_area);
+}
+
+/**
+ * Invalidate the part of the canvas where an area of its buffer is shown
+ * @param obj       pointer to a canvas
+ * @param buf_area  area in the canvas buffer
+ */
+static void invalidate_buf_area(lv_obj_t * obj, const lv_area_t * buf_area)
+{
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_image_t * img = (lv_image_t *)obj;
+
+    /*Find where the buffer is drawn the same way as the image does. Invalidate everything if the pixels
+     *are not mapped 1:1 to the screen*/
+    if(canvas->draw_buf == NULL || img->src != canvas->draw_buf ||
+       img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align == LV_IMAGE_ALIGN_TILE) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t image_area;
+    lv_area_set(&image_area, obj->coords.x1, obj->coords.y1, obj->coords.x1 + img->w - 1, obj->coords.y1 + img->h - 1);
+    if(img->align < LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_area_align(&obj->coords, &image_area, img->align, img->offset.x, img->offset.y);
+    }
+
+    lv_area_t area;
+    lv_area_t canvas_area = {0, 0, img->w - 1, img->h - 1};
+    if(!lv_area_intersect(&area, buf_area, &canvas_area)) return;
+
+    lv_area_move(&area, image_area.x1, image_area.y1);
+    lv_obj_invalidate_area(obj, &area);
+}
+
 #endif
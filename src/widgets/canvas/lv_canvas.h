@@ -29,6 +29,15 @@ extern "C" {
  **********************/
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_canvas_class;
 
+/** A horizontal run of pixels with the same color */
+typedef struct {
+    int32_t x;          /**< X coordinate of the first pixel */
+    int32_t y;          /**< Y coordinate of the pixels */
+    int32_t len;        /**< Number of pixels */
+    lv_color_t color;   /**< Color of the pixels */
+    lv_opa_t opa;       /**< Opacity of the pixels */
+} lv_canvas_span_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -84,6 +93,16 @@ void lv_canvas_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
  */
 void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv_opa_t opa);
 
+/**
+ * Set the color and opacity of many pixels and invalidate only the area they cover once.
+ * Faster than calling `lv_canvas_set_px()` for each pixel, e.g. to draw a curve on every refresh.
+ * @param obj       pointer to a canvas
+ * @param spans     array of horizontal runs of pixels. The parts outside of the canvas are ignored.
+ * @param span_cnt  number of elements in `spans`
+ * @note            The same color formats are supported as by `lv_canvas_set_px()`
+ */
+void lv_canvas_set_px_spans(lv_obj_t * obj, const lv_canvas_span_t * spans, uint32_t span_cnt);
+
 /**
  * Set the palette color of a canvas for index format. Valid only for `LV_COLOR_FORMAT_I1/2/4/8`
  * @param obj       pointer to canvas object
@@ -160,6 +179,7 @@ void lv_canvas_init_layer(lv_obj_t * canvas, lv_layer_t * layer);
 /**
  * Wait until all the drawings are finished on layer.
  * Needs to be usd in pair with `lv_canvas_init_layer`.
+ * Only the area covered by the draw tasks is invalidated.
  * @param canvas    pointer to a canvas
  * @param layer     pointer to a layer to finalize
  */
@@ -56,6 +56,20 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+static lv_text_flag_t lines_normalize_flag(lv_text_flag_t flag);
+static lv_label_lines_t * lines_get(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                                    lv_text_flag_t flag);
+static lv_label_lines_t * lines_build(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                                      lv_text_flag_t flag);
+static uint32_t lines_find(const lv_label_lines_t * lines, uint32_t byte_id);
+static void lines_update(lv_label_t * label, uint32_t byte_pos, uint32_t del_len, uint32_t ins_len);
+static bool lines_get_text_size(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t line_space,
+                                int32_t max_w, lv_text_flag_t flag, lv_point_t * size_res);
+static void lines_invalidate(lv_label_t * label);
+static void set_text_buf(lv_label_t * label, char * text, size_t size, bool static_txt, bool same_text);
+#if LV_LABEL_LONG_TXT_HINT
+    static void lines_init_hint(lv_label_t * label, lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
+#endif
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords, lv_text_flag_t flags);
 
@@ -143,9 +157,11 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
 
     /*If set its own text then reallocate it (maybe its size changed)*/
     if(label->text == text && label->static_txt == 0) {
-        label->text = lv_realloc(label->text, text_len);
-        LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
+        /*The text might have been modified directly too so wrap it again*/
+        char * new_text = lv_realloc(label->text, text_len);
+        LV_ASSERT_MALLOC(new_text);
+        if(new_text == NULL) return;
+        set_text_buf(label, new_text, text_len, false, false);
 
 #if LV_USE_ARABIC_PERSIAN_CHARS
         lv_text_ap_proc(label->text, label->text);
@@ -156,17 +172,15 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
         /*Free the old text*/
         if(label->text != NULL && label->static_txt == 0) {
             lv_free(label->text);
-            label->text = NULL;
         }
 
-        label->text = lv_malloc(text_len);
-        LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
+        /*Now the text is dynamically allocated*/
+        char * new_text = lv_malloc(text_len);
+        LV_ASSERT_MALLOC(new_text);
+        set_text_buf(label, new_text, new_text ? text_len : 0, false, false);
+        if(new_text == NULL) return;
 
         copy_text_to_label(label, text);
-
-        /*Now the text is dynamically allocated*/
-        label->static_txt = 0;
     }
 
     lv_label_refr_text(obj);
@@ -188,14 +202,15 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
 
     if(label->text != NULL && label->static_txt == 0) {
         lv_free(label->text);
-        label->text = NULL;
     }
 
     va_list args;
     va_start(args, fmt);
-    label->text = lv_text_set_text_vfmt(fmt, args);
+    char * new_text = lv_text_set_text_vfmt(fmt, args);
     va_end(args);
-    label->static_txt = 0; /*Now the text is dynamically allocated*/
+
+    /*Now the text is dynamically allocated*/
+    set_text_buf(label, new_text, new_text ? lv_strlen(new_text) + 1 : 0, false, false);
 
     lv_label_refr_text(obj);
 }
@@ -207,12 +222,11 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
 
     if(label->static_txt == 0 && label->text != NULL) {
         lv_free(label->text);
-        label->text = NULL;
+        set_text_buf(label, NULL, 0, false, false);
     }
 
     if(text != NULL) {
-        label->static_txt = 1;
-        label->text       = (char *)text;
+        set_text_buf(label, (char *)text, 0, true, false);
     }
 
     lv_label_refr_text(obj);
@@ -343,16 +357,28 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
+    const lv_label_lines_t * lines = lines_get(label, font, letter_space, max_w, flag);
+    if(lines && lv_array_size(&lines->lines) > 0) {
+        /*The lines of edited labels are known, so just find the line of the letter*/
+        uint32_t line_id = lines_find(lines, byte_id);
+        const lv_label_line_t * line = lv_array_at(&lines->lines, line_id);
+        const lv_label_line_t * next_line = lv_array_at(&lines->lines, line_id + 1);
+        line_start = line->start;
+        new_line_start = next_line ? next_line->start : lv_strlen(txt);
+        y = line_id * (letter_height + line_space);
+    }
+    else {
+        while(txt[new_line_start] != '\0') {
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -667,20 +693,37 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
 
     lv_obj_invalidate(obj);
 
-    /*Allocate space for the new text*/
+    /*Allocate space for the new text.
+     *Reserve some extra space too to not reallocate the text on each insert.*/
     size_t old_len = lv_strlen(label->text);
     size_t ins_len = lv_strlen(txt);
     size_t new_len = ins_len + old_len;
-    label->text        = lv_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
+    if(new_len + 1 > label->text_size) {
+        size_t new_size = LV_MAX(new_len + 1, label->text_size + label->text_size / 2);
+        char * new_text = lv_realloc(label->text, new_size);
+        LV_ASSERT_MALLOC(new_text);
+        if(new_text == NULL) return;
+        set_text_buf(label, new_text, new_size, false, true);
+    }
 
     if(pos == LV_LABEL_POS_LAST) {
         pos = lv_text_get_encoded_length(label->text);
     }
 
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The whole text needs to be processed again*/
     lv_text_ins(label->text, pos, txt);
     lv_label_set_text(obj, NULL);
+#else
+    /*Wrap only the changed lines from now*/
+    if(label->lines == NULL) label->lines = lv_zalloc(sizeof(lv_label_lines_t));
+
+    lv_label_revert_dots(obj);
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label->text, pos);
+    lv_text_ins(label->text, pos, txt);
+    lines_update(label, byte_pos, 0, ins_len);
+    lv_label_refr_text(obj);
+#endif
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -693,9 +736,16 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
 
     lv_obj_invalidate(obj);
 
+    /*Wrap only the changed lines from now*/
+    if(label->lines == NULL) label->lines = lv_zalloc(sizeof(lv_label_lines_t));
+
     char * label_txt = lv_label_get_text(obj);
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label_txt, pos);
+    uint32_t byte_cnt = lv_text_encoded_get_byte_id(&label_txt[byte_pos], cnt);
+
     /*Delete the characters*/
     lv_text_cut(label_txt, pos, cnt);
+    lines_update(label, byte_pos, byte_cnt, 0);
 
     /*Refresh the label*/
     lv_label_refr_text(obj);
@@ -712,9 +762,8 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     lv_label_t * label = (lv_label_t *)obj;
 
-    label->text       = NULL;
+    set_text_buf(label, NULL, 0, false, false);
     label->recolor    = 0;
-    label->static_txt = 0;
     label->dot_begin  = LV_LABEL_DOT_BEGIN_INV;
     label->long_mode  = LV_LABEL_LONG_MODE_WRAP;
     lv_point_set(&label->offset, 0, 0);
@@ -743,7 +792,13 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     if(!label->static_txt) lv_free(label->text);
-    label->text = NULL;
+    set_text_buf(label, NULL, 0, false, false);
+
+    if(label->lines) {
+        lv_array_deinit(&label->lines->lines);
+        lv_free(label->lines);
+        label->lines = NULL;
+    }
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -786,7 +841,9 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
             uint32_t dot_begin = label->dot_begin;
             lv_label_revert_dots(obj);
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            if(!lines_get_text_size(label, font, letter_space, line_space, w, flag, &label->size_cache)) {
+                lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            }
             lv_label_set_dots(obj, dot_begin);
 
             label->invalid_size_cache = false;
@@ -859,6 +916,10 @@ static void draw_main(lv_event_t * e)
         lv_area_move(&txt_coords, 0, -s);
         txt_coords.y2 = obj->coords.y2;
     }
+
+#if LV_LABEL_LONG_TXT_HINT
+    lines_init_hint(label, &label_draw_dsc, &txt_coords);
+#endif
     if(label->long_mode == LV_LABEL_LONG_MODE_SCROLL || label->long_mode == LV_LABEL_LONG_MODE_SCROLL_CIRCULAR) {
         const lv_area_t clip_area_ori = layer->_clip_area;
         layer->_clip_area = txt_clip;
@@ -948,7 +1009,14 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_text_flag_t flag = get_label_flags(label);
 
     lv_label_revert_dots(obj);
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+
+    /*Only the scrolling and dots modes need the size of the text here*/
+    if(label->long_mode != LV_LABEL_LONG_MODE_WRAP && label->long_mode != LV_LABEL_LONG_MODE_CLIP) {
+        lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    }
+    else {
+        lv_point_set(&size, 0, 0);
+    }
 
     lv_obj_refresh_self_size(obj);
 
@@ -1267,6 +1335,261 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/**
+ * Keep only the flags which affect wrapping. EXPAND and FIT both ignore the width.
+ */
+static lv_text_flag_t lines_normalize_flag(lv_text_flag_t flag)
+{
+    lv_text_flag_t res = flag & (LV_TEXT_FLAG_RECOLOR | LV_TEXT_FLAG_BREAK_ALL);
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) res |= LV_TEXT_FLAG_EXPAND;
+    return res;
+}
+
+/**
+ * Get the wrapped lines of a label if they are valid with the given parameters
+ */
+static lv_label_lines_t * lines_get(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                                    lv_text_flag_t flag)
+{
+    lv_label_lines_t * lines = label->lines;
+    if(lines == NULL || lines->valid == 0) return NULL;
+
+    /*The dots and the scrolling modes modify the text or its position*/
+    if(label->long_mode != LV_LABEL_LONG_MODE_WRAP && label->long_mode != LV_LABEL_LONG_MODE_CLIP) return NULL;
+
+    flag = lines_normalize_flag(flag);
+    if(flag & LV_TEXT_FLAG_EXPAND) max_w = LV_COORD_MAX;
+
+    if(lines->font != font || lines->letter_space != letter_space || lines->max_w != max_w || lines->flag != flag) {
+        return NULL;
+    }
+
+    return lines;
+}
+
+/**
+ * Wrap the whole text of a label and save the lines
+ */
+static lv_label_lines_t * lines_build(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                                      lv_text_flag_t flag)
+{
+    lv_label_lines_t * lines = label->lines;
+    flag = lines_normalize_flag(flag);
+    if(flag & LV_TEXT_FLAG_EXPAND) max_w = LV_COORD_MAX;
+
+    if(lines->lines.data == NULL) lv_array_init(&lines->lines, LV_ARRAY_DEFAULT_CAPACITY, sizeof(lv_label_line_t));
+    lv_array_clear(&lines->lines);
+
+    lines->font = font;
+    lines->letter_space = letter_space;
+    lines->max_w = max_w;
+    lines->flag = flag;
+    lines->valid = 0;
+
+    const char * text = label->text;
+    uint32_t start = 0;
+    while(text[start] != '\0') {
+        lv_label_line_t line;
+        uint32_t len = lv_text_get_next_line(&text[start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+        line.start = start;
+        line.width = lv_text_get_width(&text[start], len, font, letter_space);
+        if(lv_array_push_back(&lines->lines, &line) != LV_RESULT_OK) return NULL;
+        start += len;
+    }
+
+    lines->valid = 1;
+    return lines;
+}
+
+/**
+ * Find the line of a byte
+ * @return      index of the last line starting before or at `byte_id`
+ */
+static uint32_t lines_find(const lv_label_lines_t * lines, uint32_t byte_id)
+{
+    const lv_label_line_t * line = (const lv_label_line_t *)lines->lines.data;
+    uint32_t min = 0;
+    uint32_t max = lv_array_size(&lines->lines);
+    while(max - min > 1) {
+        uint32_t mid = (min + max) / 2;
+        if(line[mid].start <= byte_id) min = mid;
+        else max = mid;
+    }
+
+    return min;
+}
+
+/**
+ * Update the lines after `del_len` bytes were replaced by `ins_len` bytes at `byte_pos`.
+ * The text is wrapped again from the start of the changed word's line until a line starts
+ * where an old line started. The remaining lines are the same, only shifted.
+ */
+static void lines_update(lv_label_t * label, uint32_t byte_pos, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_lines_t * lines = label->lines;
+    if(lines == NULL || lines->valid == 0) return;
+
+    if(label->long_mode != LV_LABEL_LONG_MODE_WRAP && label->long_mode != LV_LABEL_LONG_MODE_CLIP) {
+        lines->valid = 0;
+        return;
+    }
+
+    const char * text = label->text;
+    lv_array_t * arr = &lines->lines;
+    lv_label_line_t * old_lines = (lv_label_line_t *)arr->data;
+    uint32_t line_cnt = lv_array_size(arr);
+
+    /*A changed word can move back to the previous line, and long words can be broken
+     *over several lines, so start from the line where the changed word begins.*/
+    uint32_t first = line_cnt ? lines_find(lines, byte_pos) : 0;
+    if(first > 0) first--;
+    while(first > 0) {
+        char prev = text[old_lines[first].start - 1];
+        if(prev == '\n' || prev == '\r' || lv_text_is_break_char(prev)) break;
+        first--;
+    }
+
+    int32_t diff = (int32_t)ins_len - (int32_t)del_len;
+    uint32_t edit_end = byte_pos + ins_len;
+    uint32_t start = line_cnt ? old_lines[first].start : 0;
+    uint32_t next = first + 1;  /*The first old line which might be the same*/
+
+    lv_array_t new_lines;
+    lv_array_init(&new_lines, LV_ARRAY_DEFAULT_CAPACITY, sizeof(lv_label_line_t));
+
+    bool same_found = false;
+    while(text[start] != '\0') {
+        lv_label_line_t line;
+        uint32_t len = lv_text_get_next_line(&text[start], LV_TEXT_LEN_MAX, lines->font, lines->letter_space,
+                                             lines->max_w, NULL, lines->flag);
+        line.start = start;
+        line.width = lv_text_get_width(&text[start], len, lines->font, lines->letter_space);
+        if(lv_array_push_back(&new_lines, &line) != LV_RESULT_OK) {
+            lv_array_deinit(&new_lines);
+            lines->valid = 0;
+            return;
+        }
+        start += len;
+
+        /*Lines starting after the changed bytes are wrapped the same way as before*/
+        if(start < edit_end) continue;
+        int64_t old_start = (int64_t)start - diff;
+        while(next < line_cnt && old_lines[next].start < old_start) next++;
+        if(next < line_cnt && old_lines[next].start == old_start) {
+            same_found = true;
+            break;
+        }
+    }
+
+    uint32_t tail = same_found ? next : line_cnt;
+    uint32_t tail_cnt = line_cnt - tail;
+    uint32_t new_cnt = lv_array_size(&new_lines);
+    uint32_t res_cnt = first + new_cnt + tail_cnt;
+
+    if(res_cnt > lv_array_capacity(arr) && !lv_array_resize(arr, res_cnt)) {
+        lv_array_deinit(&new_lines);
+        lines->valid = 0;
+        return;
+    }
+
+    /*Keep the lines before the change, replace the changed ones and shift the rest*/
+    lv_label_line_t * res = (lv_label_line_t *)arr->data;
+    lv_memmove(&res[first + new_cnt], &res[tail], tail_cnt * sizeof(lv_label_line_t));
+    uint32_t i;
+    for(i = first + new_cnt; i < res_cnt; i++) res[i].start += diff;
+    if(new_cnt) lv_memcpy(&res[first], new_lines.data, new_cnt * sizeof(lv_label_line_t));
+    arr->size = res_cnt;
+
+    lv_array_deinit(&new_lines);
+}
+
+/**
+ * Get the size of the text from the lines of an edited label
+ * @return      false: the lines are not used so the size needs to be calculated normally
+ */
+static bool lines_get_text_size(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t line_space,
+                                int32_t max_w, lv_text_flag_t flag, lv_point_t * size_res)
+{
+    if(label->lines == NULL) return false;
+    if(label->long_mode != LV_LABEL_LONG_MODE_WRAP && label->long_mode != LV_LABEL_LONG_MODE_CLIP) return false;
+
+    lv_label_lines_t * lines = lines_get(label, font, letter_space, max_w, flag);
+    if(lines == NULL) lines = lines_build(label, font, letter_space, max_w, flag);
+    if(lines == NULL) return false;
+
+    /*The same as `lv_text_get_size()` but without wrapping the text*/
+    int32_t letter_height = lv_font_get_line_height(font);
+    uint32_t line_cnt = lv_array_size(&lines->lines);
+    const lv_label_line_t * line = (const lv_label_line_t *)lines->lines.data;
+    uint32_t i;
+    size_res->x = 0;
+    for(i = 0; i < line_cnt; i++) size_res->x = LV_MAX(size_res->x, line[i].width);
+
+    size_res->y = line_cnt * (letter_height + line_space);
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    size_t len = lv_strlen(label->text);
+    if(len > 0 && (label->text[len - 1] == '\n' || label->text[len - 1] == '\r')) {
+        size_res->y += letter_height + line_space;
+    }
+
+    if(size_res->y == 0) size_res->y = letter_height;
+    else size_res->y -= line_space;
+
+    return true;
+}
+
+static void lines_invalidate(lv_label_t * label)
+{
+    if(label->lines) label->lines->valid = 0;
+}
+
+/**
+ * Set the text buffer of a label. Every change of `label->text` goes through here
+ * so that `text_size` and the wrapped lines can't get out of sync with the text.
+ * @param label         pointer to a label
+ * @param text          the new text buffer. The old one needs to be freed by the caller if required.
+ * @param size          allocated size of `text` in bytes, 0 for static texts
+ * @param static_txt    true: `text` is not allocated by the label
+ * @param same_text     true: only the buffer has changed (e.g. it was reallocated) so the wrapped lines are still valid
+ */
+static void set_text_buf(lv_label_t * label, char * text, size_t size, bool static_txt, bool same_text)
+{
+    label->text = text;
+    label->text_size = (uint32_t)size;
+    label->static_txt = static_txt ? 1 : 0;
+    if(!same_text) lines_invalidate(label);
+}
+
+#if LV_LABEL_LONG_TXT_HINT
+/**
+ * Set the draw hint from the lines of an edited label instead of
+ * wrapping the text from the beginning to find the first visible line.
+ */
+static void lines_init_hint(lv_label_t * label, lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    if(dsc->hint == NULL || dsc->hint->line_start >= 0) return;
+    if(dsc->ofs_y != 0 || coords->y1 >= 0) return;
+
+    const lv_label_lines_t * lines = lines_get(label, dsc->font, dsc->letter_space, lv_area_get_width(coords),
+                                               dsc->flag);
+    if(lines == NULL) return;
+
+    int32_t line_h = lv_font_get_line_height(dsc->font) + dsc->line_space;
+    if(line_h <= 0) return;
+
+    /*Use the first line below the threshold, just like the hint would be saved while drawing*/
+    int32_t line_id = 0;
+    if(coords->y1 < -LV_LABEL_HINT_UPDATE_TH) line_id = (-LV_LABEL_HINT_UPDATE_TH - coords->y1 + line_h - 1) / line_h;
+    if((uint32_t)line_id >= lv_array_size(&lines->lines)) return;
+
+    const lv_label_line_t * line = lv_array_at(&lines->lines, line_id);
+    dsc->hint->line_start = line->start;
+    dsc->hint->y = line_id * line_h;
+    dsc->hint->coord_y = coords->y1;
+}
+#endif
+
 /* Function created because of this pattern be used in multiple functions */
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords, lv_text_flag_t flags)
@@ -17,6 +17,7 @@ extern "C" {
 #include "../../draw/lv_draw_label_private.h"
 #include "../../core/lv_obj_private.h"
 #include "lv_label.h"
+#include "../../misc/lv_array.h"
 
 #if LV_USE_LABEL != 0
 
@@ -28,9 +29,32 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** A wrapped line of a label*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the first letter of the line*/
+    int32_t width;      /**< Width of the line in pixels*/
+} lv_label_line_t;
+
+/**
+ * The wrapped lines of an edited label. Created by `lv_label_ins_text` and `lv_label_cut_text`
+ * so that editing wraps the text again only from the changed line until the lines
+ * are the same as before.
+ * The lines are valid only with the same font, letter space, width and flags.
+ */
+typedef struct {
+    lv_array_t lines;           /**< Array of `lv_label_line_t`*/
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_w;
+    lv_text_flag_t flag;
+    uint8_t valid : 1;
+} lv_label_lines_t;
+
 struct _lv_label_t {
     lv_obj_t obj;
     char * text;
+    uint32_t text_size;                 /**< Allocated size of `text` in bytes, can be larger than the text*/
+    lv_label_lines_t * lines;           /**< Wrapped lines if the text is edited, else NULL*/
     char dot[LV_LABEL_DOT_NUM + 1]; /**< Bytes that have been replaced with dots */
     uint32_t dot_begin;  /**< Offset where bytes have been replaced with dots */
 
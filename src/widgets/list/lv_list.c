@@ -7,12 +7,14 @@
  *      INCLUDES
  *********************/
 #include "../../core/lv_obj_class_private.h"
-#include "lv_list.h"
+#include "lv_list_private.h"
 #include "../../layouts/flex/lv_flex.h"
 #include "../../display/lv_display.h"
 #include "../label/lv_label.h"
 #include "../image/lv_image.h"
 #include "../button/lv_button.h"
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
 
 #if LV_USE_LIST
 
@@ -23,6 +25,12 @@
 #define MY_CLASS_BUTTON (&lv_list_button_class)
 #define MY_CLASS_TEXT   (&lv_list_text_class)
 
+/*Number of estimated item heights to keep bound above and below the visible area*/
+#define ITEM_MARGIN_CNT 2
+
+/*Limit the refreshes caused by the size and scroll changes of a refresh*/
+#define REFRESH_REPEAT_MAX 4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,10 +38,25 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void lv_list_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void refr_items(lv_obj_t * obj, bool rebind);
+static void refr_items_core(lv_obj_t * obj, bool rebind);
+static void reset_item_heights(lv_obj_t * obj, uint32_t start);
+static bool measure_item(lv_obj_t * obj, lv_obj_t * item, uint32_t index);
+static lv_list_slot_t * get_slot(lv_list_t * list, uint32_t index);
+static lv_list_slot_t * get_free_slot(lv_obj_t * obj);
+static void remove_deleted_slots(lv_obj_t * obj);
+
 const lv_obj_class_t lv_list_class = {
+    .constructor_cb = lv_list_constructor,
+    .destructor_cb = lv_list_destructor,
+    .event_cb = lv_list_event,
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
     .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_list_t),
     .name = "list",
 };
 
@@ -134,8 +157,365 @@ void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt)
     }
 }
 
+void lv_list_set_item_cb(lv_obj_t * obj, lv_list_item_create_cb_t create_cb, lv_list_item_bind_cb_t bind_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    bool was_virtual = list->item_bind_cb != NULL;
+
+    list->item_create_cb = create_cb;
+    list->item_bind_cb = bind_cb;
+
+    if(bind_cb == NULL) {
+        if(was_virtual) {
+            /*Delete the items and return to the normal flex layout*/
+            uint32_t i;
+            for(i = 0; i < lv_array_size(&list->slots); i++) {
+                lv_list_slot_t * slot = lv_array_at(&list->slots, i);
+                lv_obj_delete(slot->item);
+            }
+            lv_array_clear(&list->slots);
+            lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_COLUMN);
+            lv_obj_refresh_self_size(obj);
+        }
+        return;
+    }
+
+    /*The items are positioned by the list*/
+    if(!was_virtual) lv_obj_set_layout(obj, LV_LAYOUT_NONE);
+
+    list->item_gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+    reset_item_heights(obj, 0);
+    refr_items(obj, true);
+}
+
+void lv_list_set_item_count(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->item_cnt == cnt) return;
+
+    int32_t * item_h = lv_realloc(list->item_h, cnt * sizeof(int32_t));
+    LV_ASSERT_MALLOC(item_h);
+    if(item_h == NULL) return;
+
+    uint32_t old_cnt = list->item_cnt;
+    list->item_h = item_h;
+    list->item_cnt = cnt;
+    reset_item_heights(obj, LV_MIN(old_cnt, cnt));
+    refr_items(obj, false);
+}
+
+void lv_list_set_item_height(lv_obj_t * obj, int32_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    list->item_h_def = h;
+    reset_item_heights(obj, 0);
+    refr_items(obj, true);
+}
+
+void lv_list_refresh_items(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    refr_items(obj, true);
+}
+
+void lv_list_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    if(index >= list->item_cnt) return;
+
+    lv_obj_scroll_to_y(obj, lv_prefix_sum_get(&list->item_y, index), anim_en);
+}
+
+uint32_t lv_list_get_item_count(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    return list->item_cnt;
+}
+
+uint32_t lv_list_get_item_index(lv_obj_t * obj, lv_obj_t * item)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&list->slots); i++) {
+        lv_list_slot_t * slot = lv_array_at(&list->slots, i);
+        if(slot->item == item) return slot->index;
+    }
+
+    return LV_LIST_ITEM_NONE;
+}
+
+lv_obj_t * lv_list_get_item(lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_slot_t * slot = get_slot((lv_list_t *)obj, index);
+    return slot ? slot->item : NULL;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void lv_list_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    list->item_h_def = LV_DPI_DEF / 3;
+    lv_prefix_sum_init(&list->item_y);
+    lv_array_init(&list->slots, 0, sizeof(lv_list_slot_t));
+}
+
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+    /*The items were deleted as children*/
+    lv_list_t * list = (lv_list_t *)obj;
+    lv_array_deinit(&list->slots);
+    lv_prefix_sum_deinit(&list->item_y);
+    lv_free(list->item_h);
+    list->item_h = NULL;
+}
+
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    if(list->item_bind_cb == NULL) return;
+
+    if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        refr_items(obj, false);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        /*Only the gap affects the positions directly*/
+        int32_t gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+        if(gap != list->item_gap) {
+            uint32_t i;
+            for(i = 0; i < list->item_cnt; i++) list->item_h[i] += gap - list->item_gap;
+            list->item_gap = gap;
+            lv_prefix_sum_build(&list->item_y, list->item_h, list->item_cnt);
+            lv_obj_refresh_self_size(obj);
+            refr_items(obj, false);
+        }
+    }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t * p = lv_event_get_param(e);
+        int32_t h = lv_prefix_sum_get(&list->item_y, list->item_cnt);
+        if(list->item_cnt > 0) h -= list->item_gap;
+        p->y = LV_MAX(p->y, h);
+    }
+    else if(code == LV_EVENT_CHILD_CHANGED) {
+        /*Move the next items if the size of an item has changed*/
+        lv_obj_t * item = lv_event_get_param(e);
+        if(item == NULL || list->refreshing) return;
+
+        uint32_t index = lv_list_get_item_index(obj, item);
+        if(index != LV_LIST_ITEM_NONE && measure_item(obj, item, index)) {
+            lv_obj_refresh_self_size(obj);
+            refr_items(obj, false);
+        }
+    }
+    else if(code == LV_EVENT_CHILD_DELETED) {
+        remove_deleted_slots(obj);
+    }
+}
+
+/**
+ * Bind the items needed to fill the visible area and its margin
+ * @param obj       pointer to a virtual list
+ * @param rebind    true: bind all the items again even if they show the right index
+ */
+static void refr_items(lv_obj_t * obj, bool rebind)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->item_bind_cb == NULL) return;
+
+    /*Measuring the items updates the layout which can resize or scroll the list too*/
+    if(list->refreshing) {
+        list->refresh_pending = 1;
+        return;
+    }
+
+    list->refreshing = 1;
+
+    uint32_t i;
+    for(i = 0; i < REFRESH_REPEAT_MAX; i++) {
+        list->refresh_pending = 0;
+        refr_items_core(obj, rebind);
+        if(!list->refresh_pending) break;
+        rebind = false;
+    }
+
+    list->refreshing = 0;
+}
+
+static void refr_items_core(lv_obj_t * obj, bool rebind)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*Be sure the size of the list is up to date*/
+    lv_obj_update_layout(obj);
+
+    /*The first visible item stays in place when the items above it get their real size*/
+    int32_t scroll_y = lv_obj_get_scroll_y(obj);
+    int32_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    uint32_t anchor = lv_prefix_sum_find(&list->item_y, scroll_y - pad_top);
+    int32_t anchor_y = lv_prefix_sum_get(&list->item_y, anchor);
+
+    int32_t margin = list->item_h_def * ITEM_MARGIN_CNT;
+    int32_t y_start = scroll_y - pad_top - margin;
+    int32_t y_end = y_start + lv_obj_get_height(obj) + 2 * margin;
+
+    uint32_t first = lv_prefix_sum_find(&list->item_y, y_start);
+    uint32_t last = lv_prefix_sum_find(&list->item_y, y_end);
+
+    /*Free the items out of the range to reuse them for the new indices*/
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&list->slots); i++) {
+        lv_list_slot_t * slot = lv_array_at(&list->slots, i);
+        if(rebind || slot->index < first || slot->index > last) slot->index = LV_LIST_ITEM_NONE;
+    }
+
+    /*Bind and position the items in the range. The heights of the newly bound items are
+     *measured on the way so the range is updated too.*/
+    bool changed = false;
+    int32_t y = lv_prefix_sum_get(&list->item_y, first);
+    uint32_t index;
+    for(index = first; index < list->item_cnt && y <= y_end; index++) {
+        lv_list_slot_t * slot = get_slot(list, index);
+        if(slot == NULL) {
+            slot = get_free_slot(obj);
+            if(slot == NULL) break;
+
+            slot->index = index;
+            lv_obj_remove_flag(slot->item, LV_OBJ_FLAG_HIDDEN);
+            list->item_bind_cb(obj, slot->item, index);
+
+            /*The bind callback might have changed the size. If the layout is being updated
+             *now the new size will be reported by LV_EVENT_CHILD_CHANGED.*/
+            lv_obj_update_layout(slot->item);
+            if(measure_item(obj, slot->item, index)) changed = true;
+        }
+
+        lv_obj_set_y(slot->item, y);
+        y += list->item_h[index];
+    }
+
+    /*Hide the unused items*/
+    for(i = 0; i < lv_array_size(&list->slots); i++) {
+        lv_list_slot_t * slot = lv_array_at(&list->slots, i);
+        if(slot->index != LV_LIST_ITEM_NONE && slot->index >= index) slot->index = LV_LIST_ITEM_NONE;
+        if(slot->index == LV_LIST_ITEM_NONE && !lv_obj_has_flag(slot->item, LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_add_flag(slot->item, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        int32_t anchor_diff = lv_prefix_sum_get(&list->item_y, anchor) - anchor_y;
+        if(anchor_diff) lv_obj_scroll_by(obj, 0, -anchor_diff, LV_ANIM_OFF);
+    }
+}
+
+/* Set the estimated height for the items from `start` */
+static void reset_item_heights(lv_obj_t * obj, uint32_t start)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    uint32_t i;
+    for(i = start; i < list->item_cnt; i++) {
+        list->item_h[i] = list->item_h_def + list->item_gap;
+    }
+
+    lv_prefix_sum_build(&list->item_y, list->item_h, list->item_cnt);
+    lv_obj_refresh_self_size(obj);
+}
+
+/* Update the height of an item in the model. Returns true if it has changed. */
+static bool measure_item(lv_obj_t * obj, lv_obj_t * item, uint32_t index)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    int32_t h = lv_obj_get_height(item) + list->item_gap;
+    if(h == list->item_h[index]) return false;
+
+    lv_prefix_sum_add(&list->item_y, index, h - list->item_h[index]);
+    list->item_h[index] = h;
+    return true;
+}
+
+static lv_list_slot_t * get_slot(lv_list_t * list, uint32_t index)
+{
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&list->slots); i++) {
+        lv_list_slot_t * slot = lv_array_at(&list->slots, i);
+        if(slot->index == index) return slot;
+    }
+
+    return NULL;
+}
+
+/* Get an unused item or create a new one */
+static lv_list_slot_t * get_free_slot(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    lv_list_slot_t * slot = get_slot(list, LV_LIST_ITEM_NONE);
+    if(slot) return slot;
+
+    lv_list_slot_t new_slot;
+    new_slot.index = LV_LIST_ITEM_NONE;
+    if(list->item_create_cb) new_slot.item = list->item_create_cb(obj);
+    else new_slot.item = lv_list_add_button(obj, NULL, "");
+    if(new_slot.item == NULL) return NULL;
+
+    if(lv_array_push_back(&list->slots, &new_slot) != LV_RESULT_OK) {
+        lv_obj_delete(new_slot.item);
+        return NULL;
+    }
+
+    return lv_array_back(&list->slots);
+}
+
+/* Forget the items which were deleted from the list */
+static void remove_deleted_slots(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+
+    uint32_t i = 0;
+    while(i < lv_array_size(&list->slots)) {
+        lv_list_slot_t * slot = lv_array_at(&list->slots, i);
+        uint32_t c;
+        for(c = 0; c < child_cnt; c++) {
+            if(obj->spec_attr->children[c] == slot->item) break;
+        }
+
+        if(c == child_cnt) lv_array_remove(&list->slots, i);
+        else i++;
+    }
+}
+
 #endif /*LV_USE_LIST*/
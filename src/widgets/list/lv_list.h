@@ -20,11 +20,28 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#define LV_LIST_ITEM_NONE 0xFFFFFFFF
+LV_EXPORT_CONST_INT(LV_LIST_ITEM_NONE);
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Create an item of a virtual list. It will be bound to different indices as the list is scrolled.
+ * @param list      pointer to a list, the parent of the new item
+ * @return          the created item
+ */
+typedef lv_obj_t * (*lv_list_item_create_cb_t)(lv_obj_t * list);
+
+/**
+ * Update an item of a virtual list to show the data of an index
+ * @param list      pointer to a list
+ * @param item      pointer to an item created by the list's `lv_list_item_create_cb_t`
+ * @param index     index of the data to show [0 .. item_cnt - 1]
+ */
+typedef void (*lv_list_item_bind_cb_t)(lv_obj_t * list, lv_obj_t * item, uint32_t index);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_text_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_button_class;
@@ -72,6 +89,71 @@ const char * lv_list_get_button_text(lv_obj_t * list, lv_obj_t * btn);
  */
 void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt);
 
+/**
+ * Make a list virtual: only the items needed to fill the visible area (plus a margin)
+ * are created and they are bound to other indices as the list is scrolled.
+ * It allows showing lists with a very large number of items.
+ * The list should be empty when it's made virtual.
+ * @param list          pointer to a list
+ * @param create_cb     called when a new item is required. If NULL list buttons are created
+ *                      whose text can be set by `lv_list_set_button_text()` in `bind_cb`.
+ * @param bind_cb       called to show the data of an index on an item, NULL to delete the items and
+ *                      return to the normal mode
+ */
+void lv_list_set_item_cb(lv_obj_t * list, lv_list_item_create_cb_t create_cb, lv_list_item_bind_cb_t bind_cb);
+
+/**
+ * Set the number of items of a virtual list
+ * @param list      pointer to a list
+ * @param cnt       number of items
+ */
+void lv_list_set_item_count(lv_obj_t * list, uint32_t cnt);
+
+/**
+ * Set the estimated height of the items of a virtual list. It's used for the items
+ * which haven't been shown yet to calculate the scroll range.
+ * @param list      pointer to a list
+ * @param h         the estimated height of an item
+ */
+void lv_list_set_item_height(lv_obj_t * list, int32_t h);
+
+/**
+ * Bind all the items of a virtual list again, e.g. when the data has changed
+ * @param list      pointer to a list
+ */
+void lv_list_refresh_items(lv_obj_t * list);
+
+/**
+ * Scroll a virtual list to show an item at the top
+ * @param list      pointer to a list
+ * @param index     index of the item
+ * @param anim_en   LV_ANIM_ON: scroll with animation; LV_ANIM_OFF: scroll immediately
+ */
+void lv_list_scroll_to_item(lv_obj_t * list, uint32_t index, lv_anim_enable_t anim_en);
+
+/**
+ * Get the number of items of a virtual list
+ * @param list      pointer to a list
+ * @return          number of items
+ */
+uint32_t lv_list_get_item_count(lv_obj_t * list);
+
+/**
+ * Get the index an item of a virtual list is bound to
+ * @param list      pointer to a list
+ * @param item      pointer to an item of the list
+ * @return          the index or `LV_LIST_ITEM_NONE` if the item is not in use
+ */
+uint32_t lv_list_get_item_index(lv_obj_t * list, lv_obj_t * item);
+
+/**
+ * Get the item bound to an index in a virtual list
+ * @param list      pointer to a list
+ * @param index     index of an item
+ * @return          the item or NULL if the index is not bound, e.g. it's not visible
+ */
+lv_obj_t * lv_list_get_item(lv_obj_t * list, uint32_t index);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,67 @@
+/**
+ * @file lv_list_private.h
+ *
+ */
+
+#ifndef LV_LIST_PRIVATE_H
+#define LV_LIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_list.h"
+
+#if LV_USE_LIST != 0
+#include "../../core/lv_obj_private.h"
+#include "../../misc/lv_array.h"
+#include "../../misc/lv_prefix_sum.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** An item object of a virtual list*/
+typedef struct {
+    lv_obj_t * item;
+    uint32_t index;             /**< The bound index or `LV_LIST_ITEM_NONE` if the item is free*/
+} lv_list_slot_t;
+
+/** Data of list*/
+struct _lv_list_t {
+    lv_obj_t obj;
+    lv_list_item_create_cb_t item_create_cb;
+    lv_list_item_bind_cb_t item_bind_cb;    /**< Not NULL in virtual mode*/
+    uint32_t item_cnt;
+    int32_t item_h_def;         /**< Estimated height of the items which weren't shown yet*/
+    int32_t item_gap;           /**< The row gap included in `item_h`*/
+    int32_t * item_h;           /**< Height of the items with the gap*/
+    lv_prefix_sum_t item_y;     /**< To find the items at a coordinate*/
+    lv_array_t slots;           /**< The created items as `lv_list_slot_t`*/
+    uint32_t refreshing : 1;
+    uint32_t refresh_pending : 1;   /**< Refresh again as the list changed while refreshing*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_LIST != 0 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_LIST_PRIVATE_H*/
@@ -42,6 +42,15 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
                               int32_t cell_left, int32_t cell_right, int32_t cell_top, int32_t cell_bottom);
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row);
 static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col);
+static void refr_visible_rows(lv_obj_t * obj);
+static int32_t get_row_height_def(lv_obj_t * obj);
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t row, uint32_t col);
+static lv_table_cell_ctrl_t get_cell_ctrl(lv_table_t * table, uint32_t cell);
+static void free_cell_data(lv_table_t * table);
+static bool row_measured_realloc(lv_table_t * table);
+static void set_row_height(lv_table_t * table, uint32_t row, int32_t h);
+static int32_t get_row_y(lv_table_t * table, uint32_t row);
+static uint32_t get_row_at_y(lv_table_t * table, int32_t y);
 static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
 static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
@@ -53,6 +62,17 @@ static inline bool is_cell_empty(void * cell)
     return cell == NULL;
 }
 
+static inline bool is_row_measured(lv_table_t * table, uint32_t row)
+{
+    return table->row_measured[row >> 3] & (1 << (row & 0x7));
+}
+
+static inline void set_row_measured(lv_table_t * table, uint32_t row, bool measured)
+{
+    if(measured) table->row_measured[row >> 3] |= 1 << (row & 0x7);
+    else table->row_measured[row >> 3] &= ~(1 << (row & 0x7));
+}
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -95,6 +115,11 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the values of a virtual table are provided by its callback");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -129,6 +154,11 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("the values of a virtual table are provided by its callback");
+        return;
+    }
     if(col >= table->col_cnt) {
         lv_table_set_column_count(obj, col + 1);
     }
@@ -215,6 +245,14 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
+    if(!row_measured_realloc(table)) return;
+
+    /*In virtual mode only the new rows need to be measured*/
+    if(table->cell_value_cb) {
+        refr_size_form_row(obj, LV_MIN(old_row_cnt, row_cnt));
+        return;
+    }
+
     /*Free the unused cells*/
     if(old_row_cnt > row_cnt) {
         uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
@@ -254,40 +292,43 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
     uint32_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
-    lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
-    LV_ASSERT_MALLOC(new_cell_data);
-    if(new_cell_data == NULL) return;
-    uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+    /*The cells are stored only out of virtual mode*/
+    if(table->cell_value_cb == NULL) {
+        lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(new_cell_data);
+        if(new_cell_data == NULL) return;
+        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
 
-    lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+        lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
 
-    /*The new column(s) messes up the mapping of `cell_data`*/
-    uint32_t old_col_start;
-    uint32_t new_col_start;
-    uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
-    uint32_t row;
-    for(row = 0; row < table->row_cnt; row++) {
-        old_col_start = row * old_col_cnt;
-        new_col_start = row * col_cnt;
-
-        lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
-                  sizeof(new_cell_data[0]) * min_col_cnt);
-
-        /*Free the old cells (only if the table becomes smaller)*/
-        int32_t i;
-        for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
-            uint32_t idx = old_col_start + min_col_cnt + i;
-            if(table->cell_data[idx] && table->cell_data[idx]->user_data) {
-                lv_free(table->cell_data[idx]->user_data);
-                table->cell_data[idx]->user_data = NULL;
+        /*The new column(s) messes up the mapping of `cell_data`*/
+        uint32_t old_col_start;
+        uint32_t new_col_start;
+        uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
+        uint32_t row;
+        for(row = 0; row < table->row_cnt; row++) {
+            old_col_start = row * old_col_cnt;
+            new_col_start = row * col_cnt;
+
+            lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
+                      sizeof(new_cell_data[0]) * min_col_cnt);
+
+            /*Free the old cells (only if the table becomes smaller)*/
+            int32_t i;
+            for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
+                uint32_t idx = old_col_start + min_col_cnt + i;
+                if(table->cell_data[idx] && table->cell_data[idx]->user_data) {
+                    lv_free(table->cell_data[idx]->user_data);
+                    table->cell_data[idx]->user_data = NULL;
+                }
+                lv_free(table->cell_data[idx]);
+                table->cell_data[idx] = NULL;
             }
-            lv_free(table->cell_data[idx]);
-            table->cell_data[idx] = NULL;
         }
-    }
 
-    lv_free(table->cell_data);
-    table->cell_data = new_cell_data;
+        lv_free(table->cell_data);
+        table->cell_data = new_cell_data;
+    }
 
     /*Initialize the new column widths if any*/
     table->col_w = lv_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
@@ -321,6 +362,11 @@ void lv_table_add_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("not supported in virtual mode");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -346,6 +392,11 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("not supported in virtual mode");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -371,6 +422,11 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
 
     lv_table_t * table = (lv_table_t *)obj;
 
+    if(table->cell_value_cb) {
+        LV_LOG_WARN("not supported in virtual mode");
+        return;
+    }
+
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
     if(row >= table->row_cnt) lv_table_set_row_count(obj, row + 1);
@@ -394,6 +450,47 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     table->cell_data[cell]->user_data = user_data;
 }
 
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(table->cell_value_cb == NULL && cb) {
+        free_cell_data(table);
+        table->row_measured = lv_malloc_zeroed((table->row_cnt + 7) / 8);
+        LV_ASSERT_MALLOC(table->row_measured);
+        if(table->row_measured == NULL) return;
+    }
+    else if(table->cell_value_cb && cb == NULL) {
+        lv_free(table->row_measured);
+        table->row_measured = NULL;
+        table->cell_data = lv_malloc_zeroed(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(table->cell_data);
+        if(table->cell_data == NULL) return;
+    }
+
+    table->cell_value_cb = cb;
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(table->cell_value_cb == NULL || row >= table->row_cnt) return;
+
+    uint32_t row_end = cnt < table->row_cnt - row ? row + cnt : table->row_cnt;
+    for(; row < row_end; row++) {
+        set_row_measured(table, row, false);
+    }
+
+    refr_visible_rows(obj);
+    lv_obj_invalidate(obj);
+}
+
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -427,11 +524,17 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
-    uint32_t cell = row * table->col_cnt + col;
 
-    if(is_cell_empty(table->cell_data[cell])) return "";
+    const char * txt = get_cell_txt(obj, row, col);
+    return txt ? txt : "";
+}
+
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    return table->cell_data[cell]->txt;
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_value_cb;
 }
 
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
@@ -473,6 +576,8 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
         LV_LOG_WARN("invalid row or column");
         return false;
     }
+    if(table->cell_value_cb) return false;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return false;
@@ -495,6 +600,8 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return NULL;
     }
+    if(table->cell_value_cb) return NULL;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return NULL;
@@ -519,6 +626,8 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_h = lv_malloc(table->row_cnt * sizeof(table->row_h[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    lv_prefix_sum_init(&table->row_sum);
+    lv_prefix_sum_build(&table->row_sum, table->row_h, table->row_cnt);
     table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
     table->cell_data[0] = NULL;
     table->row_act = LV_TABLE_CELL_NONE;
@@ -531,21 +640,11 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
-    /*Free the cell texts*/
-    uint32_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
-        if(table->cell_data[i]) {
-            if(table->cell_data[i]->user_data) {
-                lv_free(table->cell_data[i]->user_data);
-                table->cell_data[i]->user_data = NULL;
-            }
-            lv_free(table->cell_data[i]);
-            table->cell_data[i] = NULL;
-        }
-    }
+    free_cell_data(table);
 
-    if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
+    lv_prefix_sum_deinit(&table->row_sum);
+    if(table->row_measured) lv_free(table->row_measured);
     if(table->col_w) lv_free(table->col_w);
 }
 
@@ -572,8 +671,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        int32_t h = get_row_y(table, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
@@ -607,6 +705,9 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     else if(code == LV_EVENT_FOCUSED) {
         lv_obj_invalidate(obj);
     }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        refr_visible_rows(obj);
+    }
     else if(code == LV_EVENT_KEY) {
         int32_t c = *((int32_t *)lv_event_get_param(e));
         int32_t col = table->col_act;
@@ -707,16 +808,21 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
+    uint32_t cell;
+
+    /*Start from the first row in the clip area*/
+    int32_t row_y_ofs = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    row = get_row_at_y(table, clip_area.y1 - row_y_ofs);
+    cell = row * table->col_cnt;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    cell_area.y2 = row_y_ofs + get_row_y(table, row) - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
+    for(; row < table->row_cnt; row++) {
         int32_t h_row = table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
@@ -728,8 +834,7 @@ static void draw_main(lv_event_t * e)
         else cell_area.x2 = obj->coords.x1 + bg_left - 1 - scroll_x + border_width;
 
         for(col = 0; col < table->col_cnt; col++) {
-            lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
+            lv_table_cell_ctrl_t ctrl = get_cell_ctrl(table, cell);
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -742,11 +847,7 @@ static void draw_main(lv_event_t * e)
 
             uint32_t col_merge = 0;
             for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-                lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
-
-                if(is_cell_empty(next_cell_data)) break;
-
-                lv_table_cell_ctrl_t merge_ctrl = (lv_table_cell_ctrl_t) next_cell_data->ctrl;
+                lv_table_cell_ctrl_t merge_ctrl = get_cell_ctrl(table, cell + col_merge);
                 if(merge_ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
                     int32_t offset = table->col_w[col + col_merge + 1];
 
@@ -813,7 +914,8 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            const char * txt = get_cell_txt(obj, row, col);
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -830,7 +932,7 @@ static void draw_main(lv_event_t * e)
                 bool crop = ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP;
                 if(crop) txt_flags = LV_TEXT_FLAG_EXPAND;
 
-                lv_text_get_size(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font,
+                lv_text_get_size(&txt_size, txt, label_dsc_def.font,
                                  label_dsc_act.letter_space, label_dsc_act.line_space,
                                  lv_area_get_width(&txt_area), txt_flags);
 
@@ -845,7 +947,9 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
+                    /*The text of virtual cells is valid only until the next query*/
+                    label_dsc_act.text_local = table->cell_value_cb != NULL;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
@@ -862,6 +966,24 @@ static void draw_main(lv_event_t * e)
 /* Refreshes size of the table starting from @start_row row */
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 {
+    lv_table_t * table = (lv_table_t *)obj;
+
+    /*In virtual mode only the visible rows are measured, the others have the default height*/
+    if(table->cell_value_cb) {
+        int32_t h_def = get_row_height_def(obj);
+        uint32_t i;
+        for(i = start_row; i < table->row_cnt; i++) {
+            table->row_h[i] = h_def;
+            set_row_measured(table, i, false);
+        }
+        lv_prefix_sum_build(&table->row_sum, table->row_h, table->row_cnt);
+
+        lv_obj_refresh_self_size(obj);
+        refr_visible_rows(obj);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
     const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
     const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
     const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -874,13 +996,13 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
     const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
-    lv_table_t * table = (lv_table_t *)obj;
     uint32_t i;
     for(i = start_row; i < table->row_cnt; i++) {
         int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
                                                    cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
         table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
     }
+    lv_prefix_sum_build(&table->row_sum, table->row_h, table->row_cnt);
 
     lv_obj_refresh_self_size(obj);
     lv_obj_invalidate(obj);
@@ -905,7 +1027,7 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
                                                cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
 
     int32_t prev_row_size = table->row_h[row];
-    table->row_h[row] = LV_CLAMP(minh, calculated_height, maxh);
+    set_row_height(table, row, LV_CLAMP(minh, calculated_height, maxh));
 
     /*If the row height haven't changed invalidate only this cell*/
     if(prev_row_size == table->row_h[row]) {
@@ -934,9 +1056,9 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     uint32_t cell;
     uint32_t col;
     for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
-        lv_table_cell_t * cell_data = table->cell_data[cell];
+        const char * txt = get_cell_txt(obj, row_id, col);
 
-        if(is_cell_empty(cell_data)) {
+        if(txt == NULL) {
             continue;
         }
 
@@ -947,11 +1069,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
          * exit the traversal when the current cell control is not LV_TABLE_CELL_CTRL_MERGE_RIGHT */
         uint32_t col_merge = 0;
         for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-            lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
-
-            if(is_cell_empty(next_cell_data)) break;
-
-            lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) next_cell_data->ctrl;
+            lv_table_cell_ctrl_t ctrl = get_cell_ctrl(table, cell + col_merge);
             if(ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
                 txt_w += table->col_w[col + col_merge + 1];
             }
@@ -960,7 +1078,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             }
         }
 
-        lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) cell_data->ctrl;
+        lv_table_cell_ctrl_t ctrl = get_cell_ctrl(table, cell);
 
         /*When cropping the text we can assume the row height is equal to the line height*/
         if(ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) {
@@ -972,7 +1090,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             lv_point_t txt_size;
             txt_w -= cell_left + cell_right;
 
-            lv_text_get_size(&txt_size, table->cell_data[cell]->txt, font,
+            lv_text_get_size(&txt_size, txt, font,
                              letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
 
             h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
@@ -1030,16 +1148,8 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) {
-                is_click_on_valid_row = true;
-                break;
-            }
-        }
+        *row = get_row_at_y(table, y);
+        is_click_on_valid_row = *row < table->row_cnt;
     }
 
     /* If the click was on valid column AND row then return valid result, return invalid otherwise */
@@ -1098,12 +1208,7 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    area->y1 = get_row_y(table, row);
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
     area->y2 = area->y1 + table->row_h[row] - 1;
@@ -1131,4 +1236,128 @@ static void scroll_to_selected_cell(lv_obj_t * obj)
     }
 
 }
+
+/* Measure the visible rows of a virtual table which haven't been measured yet */
+static void refr_visible_rows(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb == NULL || table->row_cnt == 0) return;
+
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    int32_t y_start = lv_obj_get_scroll_y(obj) - lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    int32_t y_end = y_start + lv_obj_get_height(obj);
+
+    uint32_t row = get_row_at_y(table, y_start);
+    int32_t y = get_row_y(table, row);
+    bool changed = false;
+    for(; row < table->row_cnt && y <= y_end; row++) {
+        if(!is_row_measured(table, row)) {
+            int32_t calculated_height = get_row_height(obj, row, font, letter_space, line_space,
+                                                       cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            calculated_height = LV_CLAMP(minh, calculated_height, maxh);
+            if(calculated_height != table->row_h[row]) {
+                set_row_height(table, row, calculated_height);
+                changed = true;
+            }
+            set_row_measured(table, row, true);
+        }
+        y += table->row_h[row];
+    }
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
+}
+
+/* Height of the rows which weren't measured in virtual mode */
+static int32_t get_row_height_def(lv_obj_t * obj)
+{
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    return LV_CLAMP(minh, lv_font_get_line_height(font) + cell_pad_top + cell_pad_bottom, maxh);
+}
+
+/* Returns the text of a cell either from the stored cells or from the virtual mode callback */
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) return table->cell_value_cb(obj, row, col);
+
+    lv_table_cell_t * cell_data = table->cell_data[row * table->col_cnt + col];
+    return is_cell_empty(cell_data) ? NULL : cell_data->txt;
+}
+
+static lv_table_cell_ctrl_t get_cell_ctrl(lv_table_t * table, uint32_t cell)
+{
+    if(table->cell_value_cb || is_cell_empty(table->cell_data[cell])) return 0;
+    return table->cell_data[cell]->ctrl;
+}
+
+/* Free the stored cells with their user data */
+static void free_cell_data(lv_table_t * table)
+{
+    if(table->cell_data == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+        if(table->cell_data[i]) {
+            if(table->cell_data[i]->user_data) {
+                lv_free(table->cell_data[i]->user_data);
+                table->cell_data[i]->user_data = NULL;
+            }
+            lv_free(table->cell_data[i]);
+            table->cell_data[i] = NULL;
+        }
+    }
+
+    lv_free(table->cell_data);
+    table->cell_data = NULL;
+}
+
+/* Resize the bitmap of the measured rows in virtual mode */
+static bool row_measured_realloc(lv_table_t * table)
+{
+    if(table->cell_value_cb == NULL) return true;
+
+    table->row_measured = lv_realloc(table->row_measured, (table->row_cnt + 7) / 8);
+    LV_ASSERT_MALLOC(table->row_measured);
+    if(table->row_measured == NULL) return false;
+
+    return true;
+}
+
+static void set_row_height(lv_table_t * table, uint32_t row, int32_t h)
+{
+    lv_prefix_sum_add(&table->row_sum, row, h - table->row_h[row]);
+    table->row_h[row] = h;
+}
+
+/* Returns the sum of the heights of the rows before `row` */
+static int32_t get_row_y(lv_table_t * table, uint32_t row)
+{
+    return lv_prefix_sum_get(&table->row_sum, row);
+}
+
+/* Returns the row at the `y` coordinate relative to the first row or `row_cnt` if it's below the last row */
+static uint32_t get_row_at_y(lv_table_t * table, int32_t y)
+{
+    return lv_prefix_sum_find(&table->row_sum, y);
+}
 #endif
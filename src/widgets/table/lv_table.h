@@ -42,6 +42,16 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Provide the text of a cell in virtual mode.
+ * @param obj       pointer to a Table object
+ * @param row       id of the row [0 .. row_cnt -1]
+ * @param col       id of the column [0 .. col_cnt -1]
+ * @return          text of the cell or NULL if the cell is empty.
+ *                  It needs to be valid only until the next call of the callback.
+ */
+typedef const char * (*lv_table_cell_value_cb_t)(lv_obj_t * obj, uint32_t row, uint32_t col);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 /**********************
@@ -132,6 +142,26 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
  */
 void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data);
 
+/**
+ * Switch the table to virtual mode in which the cell values are not stored by the table
+ * but queried from a callback when they are needed. Only the visible rows are measured
+ * and drawn, so it's suitable for tables with a large number of rows.
+ * The cell controls and cell user data are not available in virtual mode.
+ * @param obj       pointer to a Table object
+ * @param cb        callback providing the cell values or NULL to leave virtual mode.
+ *                  The stored cell values are dropped when changing the mode.
+ */
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb);
+
+/**
+ * Notify a virtual table that the values of some rows have changed.
+ * The rows will be measured again when they become visible.
+ * @param obj       pointer to a Table object
+ * @param row       id of the first changed row
+ * @param cnt       number of changed rows
+ */
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt);
+
 /**
  * Set the selected cell
  * @param obj       pointer to a table object
@@ -153,6 +183,13 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col);
 
+/**
+ * Get the callback providing the cell values in virtual mode.
+ * @param obj       pointer to a Table object
+ * @return          the callback or NULL if the table is not in virtual mode
+ */
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj);
+
 /**
  * Get the number of rows.
  * @param obj       table pointer to a Table object
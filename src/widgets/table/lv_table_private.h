@@ -18,6 +18,7 @@ extern "C" {
 
 #if LV_USE_TABLE != 0
 #include "../../core/lv_obj_private.h"
+#include "../../misc/lv_prefix_sum.h"
 
 /*********************
  *      DEFINES
@@ -39,8 +40,11 @@ struct _lv_table_t {
     lv_obj_t obj;
     uint32_t col_cnt;
     uint32_t row_cnt;
-    lv_table_cell_t ** cell_data;
+    lv_table_cell_t ** cell_data;   /**< NULL in virtual mode*/
     int32_t * row_h;
+    lv_prefix_sum_t row_sum;        /**< To find the rows at a coordinate*/
+    uint8_t * row_measured;         /**< Bitmap of the measured rows in virtual mode*/
+    lv_table_cell_value_cb_t cell_value_cb;
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
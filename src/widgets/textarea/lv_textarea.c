@@ -53,6 +53,7 @@ static void cursor_blink_anim_cb(void * obj, int32_t show);
 static void pwd_char_hider_anim(void * obj, int32_t x);
 static void pwd_char_hider_anim_completed(lv_anim_t * a);
 static void pwd_char_hider(lv_obj_t * obj);
+static bool pwd_tmp_reserve(lv_textarea_t * ta, size_t ins_len);
 static bool char_is_accepted(lv_obj_t * obj, uint32_t c);
 static void start_cursor_blink(lv_obj_t * obj);
 static void refr_cursor_area(lv_obj_t * obj);
@@ -248,11 +249,7 @@ void lv_textarea_add_char(lv_obj_t * obj, uint32_t c)
     lv_textarea_clear_selection(obj); /*Clear selection*/
 
     if(ta->pwd_mode) {
-        /*+2: the new char + \0*/
-        size_t realloc_size = lv_strlen(ta->pwd_tmp) + lv_strlen(letter_buf) + 1;
-        ta->pwd_tmp = lv_realloc(ta->pwd_tmp, realloc_size);
-        LV_ASSERT_MALLOC(ta->pwd_tmp);
-        if(ta->pwd_tmp == NULL) return;
+        if(!pwd_tmp_reserve(ta, lv_strlen(letter_buf))) return;
 
         lv_text_ins(ta->pwd_tmp, ta->cursor.pos, (const char *)letter_buf);
 
@@ -299,10 +296,7 @@ void lv_textarea_add_text(lv_obj_t * obj, const char * txt)
     lv_textarea_clear_selection(obj);
 
     if(ta->pwd_mode) {
-        size_t realloc_size = lv_strlen(ta->pwd_tmp) + lv_strlen(txt) + 1;
-        ta->pwd_tmp = lv_realloc(ta->pwd_tmp, realloc_size);
-        LV_ASSERT_MALLOC(ta->pwd_tmp);
-        if(ta->pwd_tmp == NULL) return;
+        if(!pwd_tmp_reserve(ta, lv_strlen(txt))) return;
 
         lv_text_ins(ta->pwd_tmp, ta->cursor.pos, txt);
 
@@ -330,13 +324,8 @@ void lv_textarea_delete_char(lv_obj_t * obj)
     lv_result_t res = insert_handler(obj, del_buf);
     if(res != LV_RESULT_OK) return;
 
-    char * label_txt = lv_label_get_text(ta->label);
-
-    /*Delete a character*/
-    lv_text_cut(label_txt, ta->cursor.pos - 1, 1);
-
-    /*Refresh the label*/
-    lv_label_set_text(ta->label, label_txt);
+    /*Delete a character. Only the changed lines are wrapped again.*/
+    lv_label_cut_text(ta->label, ta->cursor.pos - 1, 1);
     lv_textarea_clear_selection(obj);
 
     /*If the textarea became empty, invalidate it to hide the placeholder*/
@@ -346,11 +335,8 @@ void lv_textarea_delete_char(lv_obj_t * obj)
     }
 
     if(ta->pwd_mode) {
+        /*Keep the buffer's size as the password will probably be typed again*/
         lv_text_cut(ta->pwd_tmp, ta->cursor.pos - 1, 1);
-
-        ta->pwd_tmp = lv_realloc(ta->pwd_tmp, lv_strlen(ta->pwd_tmp) + 1);
-        LV_ASSERT_MALLOC(ta->pwd_tmp);
-        if(ta->pwd_tmp == NULL) return;
     }
 
     /*Move the cursor to the place of the deleted character*/
@@ -411,6 +397,7 @@ void lv_textarea_set_text(lv_obj_t * obj, const char * txt)
         lv_free(ta->pwd_tmp);
         ta->pwd_tmp = lv_strdup(txt);
         LV_ASSERT_MALLOC(ta->pwd_tmp);
+        ta->pwd_tmp_size = ta->pwd_tmp ? (uint32_t)lv_strlen(ta->pwd_tmp) + 1 : 0;
         if(ta->pwd_tmp == NULL) return;
 
         pwd_char_hider(obj);
@@ -522,6 +509,7 @@ void lv_textarea_set_password_mode(lv_obj_t * obj, bool en)
         lv_free(ta->pwd_tmp);
         ta->pwd_tmp = lv_strdup(txt);
         LV_ASSERT_MALLOC(ta->pwd_tmp);
+        ta->pwd_tmp_size = ta->pwd_tmp ? (uint32_t)lv_strlen(ta->pwd_tmp) + 1 : 0;
         if(ta->pwd_tmp == NULL) return;
 
         pwd_char_hider(obj);
@@ -534,6 +522,7 @@ void lv_textarea_set_password_mode(lv_obj_t * obj, bool en)
         lv_label_set_text(ta->label, ta->pwd_tmp);
         lv_free(ta->pwd_tmp);
         ta->pwd_tmp = NULL;
+        ta->pwd_tmp_size = 0;
     }
 
     refr_cursor_area(obj);
@@ -929,6 +918,7 @@ static void lv_textarea_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
 
     ta->pwd_mode          = 0;
     ta->pwd_tmp           = NULL;
+    ta->pwd_tmp_size      = 0;
     ta->pwd_bullet        = NULL;
     ta->pwd_show_time     = LV_TEXTAREA_DEF_PWD_SHOW_TIME;
     ta->accepted_chars    = NULL;
@@ -967,6 +957,7 @@ static void lv_textarea_destructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     if(ta->pwd_tmp != NULL) {
         lv_free(ta->pwd_tmp);
         ta->pwd_tmp = NULL;
+        ta->pwd_tmp_size = 0;
     }
     if(ta->pwd_bullet != NULL) {
         lv_free(ta->pwd_bullet);
@@ -1035,8 +1026,8 @@ static void label_event_cb(lv_event_t * e)
     lv_obj_t * label = lv_event_get_current_target(e);
     lv_obj_t * ta = lv_obj_get_parent(label);
 
+    /*The label has already refreshed its text in its own event handler*/
     if(code == LV_EVENT_STYLE_CHANGED || code == LV_EVENT_SIZE_CHANGED) {
-        lv_label_set_text(label, NULL);
         refr_cursor_area(ta);
         start_cursor_blink(ta);
     }
@@ -1119,6 +1110,28 @@ static void pwd_char_hider(lv_obj_t * obj)
     refr_cursor_area(obj);
 }
 
+/**
+ * Make sure the saved password has space for `ins_len` more bytes.
+ * Reserve some extra space too to not reallocate it on each key press.
+ * @param ta        pointer to a text area in password mode
+ * @param ins_len   length of the text to insert
+ * @return          false: the memory couldn't be allocated
+ */
+static bool pwd_tmp_reserve(lv_textarea_t * ta, size_t ins_len)
+{
+    size_t new_len = lv_strlen(ta->pwd_tmp) + ins_len;
+    if(new_len + 1 <= ta->pwd_tmp_size) return true;
+
+    size_t new_size = LV_MAX(new_len + 1, ta->pwd_tmp_size + ta->pwd_tmp_size / 2);
+    char * new_pwd = lv_realloc(ta->pwd_tmp, new_size);
+    LV_ASSERT_MALLOC(new_pwd);
+    if(new_pwd == NULL) return false;
+
+    ta->pwd_tmp = new_pwd;
+    ta->pwd_tmp_size = (uint32_t)new_size;
+    return true;
+}
+
 /**
  * Test a unicode character if it is accepted or not. Checks max length and accepted char list.
  * @param ta pointer to a test area object
@@ -2,7 +2,7 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    64
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -49,6 +49,9 @@
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
+#define LV_DRAW_LAYER_POOL_SIZE     (512 * 1024)
+#define LV_DRAW_OCCLUSION_MAX_AREAS 8
+#define LV_DRAW_FRAME_ARENA_SIZE    (8 * 1024)
 #define LV_LABEL_TEXT_SELECTION     1
 
 #define LV_USE_CALENDAR_CHINESE 1
@@ -125,6 +128,7 @@
 #define LV_USE_OBJ_ID_BUILTIN   1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_CACHE_USE_2Q         1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
@@ -134,6 +138,14 @@
     #define LV_USE_LINUX_FBDEV  1
 #endif
 
+#ifndef LV_USE_REMOTE_FB
+    #define LV_USE_REMOTE_FB    1
+#endif
+
+#ifndef LV_USE_EVDEV
+    #define LV_USE_EVDEV        1
+#endif
+
 #ifndef LV_USE_WAYLAND
     #define LV_USE_WAYLAND  1
     #define LV_WAYLAND_WINDOW_DECORATIONS 1
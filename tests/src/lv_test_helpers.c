@@ -1,6 +1,8 @@
 #if LV_BUILD_TEST
 
 #include "lv_test_helpers.h"
+#include "../../src/core/lv_obj_private.h"
+#include "unity/unity.h"
 
 void lv_test_wait(uint32_t ms)
 {
@@ -9,4 +11,30 @@ void lv_test_wait(uint32_t ms)
     lv_refr_now(NULL);
 }
 
+void lv_test_assert_layout_from_scratch(lv_obj_t * cont)
+{
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+    lv_area_t * coords = lv_malloc(sizeof(lv_area_t) * (child_cnt + 1));
+    uint32_t i;
+    lv_obj_update_layout(cont);
+    for(i = 0; i < child_cnt; i++) coords[i] = lv_obj_get_child(cont, i)->coords;
+    coords[child_cnt] = cont->coords;
+
+    lv_free(cont->spec_attr->layout_data);
+    cont->spec_attr->layout_data = NULL;
+    lv_obj_mark_layout_as_dirty(cont);
+    lv_obj_update_layout(cont);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = lv_obj_get_child(cont, i);
+        TEST_ASSERT_EQUAL_INT32(coords[i].x1, child->coords.x1);
+        TEST_ASSERT_EQUAL_INT32(coords[i].y1, child->coords.y1);
+        TEST_ASSERT_EQUAL_INT32(coords[i].x2, child->coords.x2);
+        TEST_ASSERT_EQUAL_INT32(coords[i].y2, child->coords.y2);
+    }
+    TEST_ASSERT_EQUAL_INT32(coords[child_cnt].x2, cont->coords.x2);
+    TEST_ASSERT_EQUAL_INT32(coords[child_cnt].y2, cont->coords.y2);
+
+    lv_free(coords);
+}
+
 #endif
@@ -14,6 +14,12 @@
 
 static inline size_t lv_test_get_free_mem(void)
 {
+    /*Unused buffers kept for reuse are not leaks*/
+    lv_draw_layer_pool_trim(true);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+
     lv_mem_monitor_t m1;
     lv_mem_monitor(&m1);
     return m1.free_size;
@@ -24,4 +30,12 @@ static inline size_t lv_test_get_free_mem(void)
 
 void lv_test_wait(uint32_t ms);
 
+/**
+ * Check that the layout of a container gives the same result as calculating it from scratch.
+ * The data saved by the layout is dropped and all the children are placed again,
+ * then the new coordinates are compared with the current ones.
+ * @param cont      a container with a layout
+ */
+void lv_test_assert_layout_from_scratch(lv_obj_t * cont);
+
 #endif /*LV_TEST_HELPERS_H*/
@@ -0,0 +1,221 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CACHE_CNT   8
+#define HOT_CNT     4
+#define SCAN_CNT    8
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t key;
+    int32_t * data;     /*Malloced data*/
+} test_data_t;
+
+static lv_cache_t * cache;
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key != rhs->key) return lhs->key > rhs->key ? 1 : -1;
+    return 0;
+}
+
+static bool create_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->data = lv_malloc(sizeof(int32_t));
+    *node->data = node->key;
+    return true;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+}
+
+static uint32_t hash_cb(const test_data_t * key)
+{
+    return key->key;
+}
+
+static void create_cache(const lv_cache_class_t * cache_class, size_t max_size, bool with_hash)
+{
+    cache = lv_cache_create(cache_class, sizeof(test_data_t), max_size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = (lv_cache_create_cb_t)create_cb,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = with_hash ? (lv_cache_hash_cb_t)hash_cb : NULL,
+    });
+    TEST_ASSERT_NOT_NULL(cache);
+}
+
+static void use(int32_t key, size_t size)
+{
+    test_data_t search_key = {.slot.size = size, .key = key};
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT32(key, *((test_data_t *)lv_cache_entry_get_data(entry))->data);
+    lv_cache_release(cache, entry, NULL);
+}
+
+static void use_range(int32_t first, int32_t cnt)
+{
+    int32_t i;
+    for(i = first; i < first + cnt; i++) use(i, 1);
+}
+
+/*Simulate a frame while scrolling: use the hot keys (e.g. icons) and some keys never used again.
+ *Return how many of the hot keys were found in the cache.*/
+static uint32_t scroll_frame(void)
+{
+    static int32_t scan_key = 1000;
+    lv_cache_stats_t stats;
+
+    lv_cache_reset_stats(cache);
+    use_range(0, HOT_CNT);
+    lv_cache_get_stats(cache, &stats);
+
+    use_range(scan_key, SCAN_CNT);
+    scan_key += SCAN_CNT;
+
+    return stats.hit_cnt;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_cache_destroy(cache, NULL);
+    cache = NULL;
+}
+
+void test_cache_2q_lru_is_not_scan_resistant(void)
+{
+    create_cache(&lv_cache_class_lru_rb_count, CACHE_CNT, true);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, scroll_frame());
+    }
+}
+
+void test_cache_2q_scan_resistant(void)
+{
+    create_cache(&lv_cache_class_2q_count, CACHE_CNT, true);
+
+    /*Evicted from the first queue in the first frame...*/
+    TEST_ASSERT_EQUAL_UINT32(0, scroll_frame());
+    TEST_ASSERT_EQUAL_UINT32(0, scroll_frame());
+
+    /*...but using them again after being evicted moved them to the main queue*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_UINT32(HOT_CNT, scroll_frame());
+    }
+    TEST_ASSERT_EQUAL(CACHE_CNT, lv_cache_get_size(cache, NULL));
+}
+
+void test_cache_2q_scan_resistant_without_hash(void)
+{
+    create_cache(&lv_cache_class_2q_count, CACHE_CNT, false);
+
+    /*Without hash the second use moves them to the main queue*/
+    use_range(0, HOT_CNT);
+    use_range(0, HOT_CNT);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_UINT32(HOT_CNT, scroll_frame());
+    }
+}
+
+void test_cache_2q_ghost_scales_with_cache(void)
+{
+    create_cache(&lv_cache_class_2q_count, 100, true);
+
+    /*Evict the first 300 keys, twice the cache's entry count is remembered*/
+    use_range(0, 400);
+    use(150, 1);
+
+    /*The key remembered in A1out got into the main queue so it survives a scan*/
+    use_range(1000, 100);
+    test_data_t search_key = {.key = 150};
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    /*The oldest keys are forgotten*/
+    use(99, 1);
+    use_range(2000, 100);
+    search_key.key = 99;
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+}
+
+void test_cache_2q_stats(void)
+{
+    create_cache(&lv_cache_class_2q_count, CACHE_CNT, true);
+
+    use_range(0, CACHE_CNT + 2);
+    use_range(CACHE_CNT, 2);
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(CACHE_CNT + 2, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.evict_cnt);
+
+    lv_cache_reset_stats(cache);
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt + stats.miss_cnt + stats.evict_cnt);
+}
+
+void test_cache_2q_size(void)
+{
+    create_cache(&lv_cache_class_2q_size, 100, true);
+
+    use(0, 40);
+    use(1, 40);
+    TEST_ASSERT_EQUAL(80, lv_cache_get_size(cache, NULL));
+
+    /*Evicts the first one*/
+    use(2, 30);
+    TEST_ASSERT_EQUAL(70, lv_cache_get_size(cache, NULL));
+    test_data_t search_key = {.key = 0};
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+
+    /*Comes back to the main queue*/
+    use(0, 40);
+    TEST_ASSERT_EQUAL(70, lv_cache_get_size(cache, NULL));
+
+    /*All entries are iterated*/
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+    uint32_t cnt = 0;
+    size_t size = 0;
+    test_data_t * elem = lv_malloc(lv_cache_entry_get_size(sizeof(test_data_t)));
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        cnt++;
+        size += elem->slot.size;
+    }
+    lv_free(elem);
+    lv_iter_destroy(iter);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+    TEST_ASSERT_EQUAL(70, size);
+
+    search_key.key = 2;
+    lv_cache_drop(cache, &search_key, NULL);
+    TEST_ASSERT_EQUAL(40, lv_cache_get_size(cache, NULL));
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+}
+
+#endif
@@ -0,0 +1,179 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define SHARD_CNT       4
+#define KEY_CNT         16
+#define CACHE_SIZE      64  /*Large enough to not evict even with an uneven key distribution*/
+#define THREAD_CNT      4
+#define THREAD_LOOP_CNT 2000
+
+typedef struct {
+    int32_t key;
+    int32_t * data;     /*Malloced data*/
+} test_data_t;
+
+/*Filled by a worker thread and checked on the main thread after the join*/
+typedef struct {
+    uint32_t ofs;
+    uint32_t acquire_fail_cnt;
+    uint32_t data_mismatch_cnt;
+} thread_result_t;
+
+static lv_cache_t * cache;
+static uint32_t free_cnt;
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key != rhs->key) return lhs->key > rhs->key ? 1 : -1;
+    return 0;
+}
+
+static bool create_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->data = lv_malloc(sizeof(int32_t));
+    *node->data = node->key * 10;
+    return true;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+    free_cnt++;
+}
+
+static uint32_t hash_cb(const test_data_t * key)
+{
+    return key->key;
+}
+
+#if LV_USE_OS
+static void thread_cb(void * user_data)
+{
+    thread_result_t * res = user_data;
+    uint32_t i;
+    for(i = 0; i < THREAD_LOOP_CNT; i++) {
+        test_data_t search_key = {.key = (int32_t)((i + res->ofs) % KEY_CNT)};
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        if(entry == NULL) {
+            res->acquire_fail_cnt++;
+            continue;
+        }
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        if(*data->data != search_key.key * 10) res->data_mismatch_cnt++;
+        lv_cache_release(cache, entry, NULL);
+    }
+}
+#endif
+
+void setUp(void)
+{
+    /* Function run before every test */
+    free_cnt = 0;
+    cache = lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(test_data_t), CACHE_SIZE, SHARD_CNT,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = (lv_cache_create_cb_t)create_cb,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    });
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_cache_destroy(cache, NULL);
+    cache = NULL;
+}
+
+void test_cache_sharded_basic(void)
+{
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_TRUE(lv_cache_is_enabled(cache));
+    TEST_ASSERT_EQUAL(CACHE_SIZE, lv_cache_get_max_size(cache, NULL));
+
+    int32_t i;
+    for(i = 0; i < 8; i++) {
+        test_data_t search_key = {.key = i};
+        TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+    TEST_ASSERT_EQUAL(8, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL(CACHE_SIZE - 8, lv_cache_get_free_size(cache, NULL));
+
+    /*Found in its shard*/
+    test_data_t search_key = {.key = 5};
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_INT32(50, *((test_data_t *)lv_cache_entry_get_data(entry))->data);
+    TEST_ASSERT_EQUAL_INT32(1, lv_cache_entry_get_ref(entry));
+
+    /*Dropping a referenced entry frees it only on the last release*/
+    lv_cache_drop(cache, &search_key, NULL);
+    TEST_ASSERT_EQUAL(7, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, free_cnt);
+    TEST_ASSERT_TRUE(lv_cache_entry_is_invalid(entry));
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+    lv_cache_release(cache, entry, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, free_cnt);
+
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL(6, lv_cache_get_size(cache, NULL));
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(8, free_cnt);
+
+    lv_cache_set_max_size(cache, 0, NULL);
+    TEST_ASSERT_FALSE(lv_cache_is_enabled(cache));
+    TEST_ASSERT_NULL(lv_cache_acquire_or_create(cache, &search_key, NULL));
+
+    TEST_ASSERT_NULL(lv_cache_iter_create(cache));
+}
+
+void test_cache_sharded_threads(void)
+{
+#if LV_USE_OS
+    lv_thread_t threads[THREAD_CNT];
+    thread_result_t results[THREAD_CNT];
+    lv_memzero(results, sizeof(results));
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        results[i].ofs = i;
+        lv_thread_init(&threads[i], LV_THREAD_PRIO_MID, thread_cb, 0, &results[i]);
+    }
+
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+
+    for(i = 0; i < THREAD_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, results[i].acquire_fail_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, results[i].data_mismatch_cnt);
+    }
+
+    /*All the keys fit into the cache and all references are released*/
+    TEST_ASSERT_EQUAL(KEY_CNT, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, free_cnt);
+
+    int32_t k;
+    for(k = 0; k < KEY_CNT; k++) {
+        test_data_t search_key = {.key = k};
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL_INT32(1, lv_cache_entry_get_ref(entry));
+        lv_cache_release(cache, entry, NULL);
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
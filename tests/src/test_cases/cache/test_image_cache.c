@@ -0,0 +1,86 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define IMG_PATH "A:src/test_files/binimages/cogwheel.ARGB8888.bin"
+
+static lv_cache_compare_res_t compare_file(const char * lhs, uint64_t lhs_hash, const char * rhs, uint64_t rhs_hash)
+{
+    return lv_image_cache_compare_src(lhs, LV_IMAGE_SRC_FILE, lhs_hash, rhs, LV_IMAGE_SRC_FILE, rhs_hash);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_image_cache_drop(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+void test_image_cache_src_hash(void)
+{
+    char path[] = IMG_PATH;
+    const char * path2 = IMG_PATH;
+    uint64_t hash = lv_image_cache_get_src_hash(path, LV_IMAGE_SRC_FILE);
+
+    /*The hash depends on the content of the file name*/
+    TEST_ASSERT_TRUE(hash == lv_image_cache_get_src_hash(path2, LV_IMAGE_SRC_FILE));
+    TEST_ASSERT_EQUAL(0, compare_file(path, hash, path2, hash));
+
+    path[sizeof(path) - 2] = 'x';
+    uint64_t hash_other = lv_image_cache_get_src_hash(path, LV_IMAGE_SRC_FILE);
+    TEST_ASSERT_TRUE(hash != hash_other);
+    TEST_ASSERT_NOT_EQUAL(0, compare_file(path, hash_other, path2, hash));
+
+    /*Collisions are resolved by comparing the file names*/
+    TEST_ASSERT_NOT_EQUAL(0, compare_file(path, hash, path2, hash));
+    TEST_ASSERT_EQUAL(-compare_file(path, hash, path2, hash), compare_file(path2, hash, path, hash));
+
+    /*Variables are compared by address*/
+    TEST_ASSERT_TRUE((uintptr_t)&path == lv_image_cache_get_src_hash(&path, LV_IMAGE_SRC_VARIABLE));
+}
+
+void test_image_cache_lookup_by_file_name(void)
+{
+    lv_cache_t * img_cache = LV_GLOBAL_DEFAULT()->img_cache;
+    lv_cache_t * header_cache = LV_GLOBAL_DEFAULT()->img_header_cache;
+    lv_image_cache_resize(100 * 1024, true);
+    lv_image_header_cache_resize(8, true);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, IMG_PATH);
+    lv_refr_now(NULL);
+
+    size_t header_cnt = lv_cache_get_size(header_cache, NULL);
+    size_t img_size = lv_cache_get_size(img_cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, header_cnt);
+#if LV_BIN_DECODER_RAM_LOAD
+    TEST_ASSERT_GREATER_THAN(0, img_size);
+#endif
+
+    /*The same file name in a different buffer finds the cached entries*/
+    char path[] = IMG_PATH;
+    lv_obj_t * img2 = lv_image_create(lv_screen_active());
+    lv_image_set_src(img2, path);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(header_cnt, lv_cache_get_size(header_cache, NULL));
+    TEST_ASSERT_EQUAL(img_size, lv_cache_get_size(img_cache, NULL));
+
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(path);
+    TEST_ASSERT_EQUAL(header_cnt - 1, lv_cache_get_size(header_cache, NULL));
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(img_cache, NULL));
+
+    lv_image_cache_resize(0, true);
+    lv_image_header_cache_resize(0, true);
+}
+
+#endif
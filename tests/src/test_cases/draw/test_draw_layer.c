@@ -85,4 +85,30 @@ void test_draw_layer_bitmap_mask_from_image_not_found(void)
 #endif
 }
 
+void test_draw_layer_pool_reuse(void)
+{
+#if LV_DRAW_LAYER_POOL_SIZE > 0
+    lv_draw_layer_pool_trim(true);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_set_style_transform_rotation(obj, 100, 0);
+    lv_obj_center(obj);
+
+    lv_draw_global_info_t * draw_info = &LV_GLOBAL_DEFAULT()->draw_info;
+    lv_refr_now(NULL);
+    uint32_t hit_cnt = draw_info->layer_pool.hit_cnt;
+    TEST_ASSERT_NOT_EQUAL(0, draw_info->layer_pool.size);
+
+    /*A slightly different rotation needs a similar sized layer which should reuse the pooled buffer*/
+    lv_obj_set_style_transform_rotation(obj, 110, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(hit_cnt, draw_info->layer_pool.hit_cnt);
+
+    lv_draw_layer_pool_trim(true);
+    TEST_ASSERT_EQUAL(0, draw_info->layer_pool.size);
+    TEST_ASSERT_NULL(lv_ll_get_head(&draw_info->layer_pool.buf_ll));
+#endif
+}
+
 #endif
@@ -0,0 +1,95 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_draw_buf_t * render_and_dup(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_buf_t * buf = lv_draw_buf_dup(lv_display_get_buf_active(NULL));
+    TEST_ASSERT_NOT_NULL(buf);
+    return buf;
+}
+
+static lv_obj_t * shadow_obj_create(int32_t x, int32_t w, int32_t h, int32_t shadow_w, int32_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, x, 100);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_shadow_width(obj, shadow_w, 0);
+    lv_obj_set_style_radius(obj, radius, 0);
+    return obj;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_box_shadow_cache(void)
+{
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_shadow_cache;
+    TEST_ASSERT_NOT_NULL(cache);
+    lv_cache_drop_all(cache, NULL);
+
+    /*Two shadow styles, the second is used by two large Widgets with different sizes*/
+    shadow_obj_create(30, 100, 100, 20, 10);
+    shadow_obj_create(200, 120, 150, 30, 5);
+    shadow_obj_create(400, 150, 120, 30, 5);
+
+    lv_draw_buf_t * buf1 = render_and_dup();
+    TEST_ASSERT_EQUAL_UINT32(2, lv_cache_get_size(cache, NULL));
+
+    /*Rendering from the cache gives the same result*/
+    lv_draw_buf_t * buf2 = render_and_dup();
+    TEST_ASSERT_EQUAL_UINT32(2, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_MEMORY(buf1->data, buf2->data, buf1->data_size);
+
+    /*Rendering without the cache gives the same result too*/
+    lv_cache_drop_all(cache, NULL);
+    lv_draw_buf_t * buf3 = render_and_dup();
+    TEST_ASSERT_EQUAL_MEMORY(buf1->data, buf3->data, buf1->data_size);
+
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+    lv_draw_buf_destroy(buf3);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_box_shadow_cache_small_widgets(void)
+{
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_shadow_cache;
+    lv_cache_drop_all(cache, NULL);
+
+    /*The corner of small Widgets depends on their size, so they can't share the cache entry*/
+    lv_obj_t * obj = shadow_obj_create(30, 10, 10, 40, 0);
+    lv_draw_buf_t * buf_small = render_and_dup();
+    lv_obj_set_size(obj, 20, 20);
+    lv_draw_buf_t * buf_cached = render_and_dup();
+    TEST_ASSERT_EQUAL_UINT32(2, lv_cache_get_size(cache, NULL));
+
+    lv_cache_drop_all(cache, NULL);
+    lv_draw_buf_t * buf_ref = render_and_dup();
+    TEST_ASSERT_EQUAL_MEMORY(buf_ref->data, buf_cached->data, buf_ref->data_size);
+
+    lv_draw_buf_destroy(buf_small);
+    lv_draw_buf_destroy(buf_cached);
+    lv_draw_buf_destroy(buf_ref);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,88 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_grad_dsc_t grad_dsc;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    static const lv_color_t colors[] = {LV_COLOR_MAKE(0xff, 0x00, 0x00), LV_COLOR_MAKE(0x00, 0x00, 0xff)};
+    lv_memzero(&grad_dsc, sizeof(grad_dsc));
+    lv_gradient_init_stops(&grad_dsc, colors, NULL, NULL, 2);
+    grad_dsc.dir = LV_GRAD_DIR_HOR;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_gradient_maps(void)
+{
+    lv_grad_t * grad = lv_gradient_get(&grad_dsc, 100, 50);
+    TEST_ASSERT_NOT_NULL(grad);
+    TEST_ASSERT_EQUAL_INT32(100, grad->size);
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, lv_color_to_u32(grad->color_map[0]) & 0xffffff);
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, lv_color_to_u32(grad->color_map[99]) & 0xffffff);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, grad->opa_map[50]);
+    lv_gradient_cleanup(grad);
+
+    grad_dsc.dir = LV_GRAD_DIR_VER;
+    grad = lv_gradient_get(&grad_dsc, 100, 50);
+    TEST_ASSERT_NOT_NULL(grad);
+    TEST_ASSERT_EQUAL_INT32(50, grad->size);
+    lv_gradient_cleanup(grad);
+
+    grad_dsc.dir = LV_GRAD_DIR_NONE;
+    TEST_ASSERT_NULL(lv_gradient_get(&grad_dsc, 100, 50));
+}
+
+void test_gradient_maps_are_cached(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    lv_grad_t * grad1 = lv_gradient_get(&grad_dsc, 100, 50);
+    lv_gradient_cleanup(grad1);
+
+    /*Same stops and size: the same maps are returned even for a different direction*/
+    grad_dsc.dir = LV_GRAD_DIR_VER;
+    lv_grad_t * grad2 = lv_gradient_get(&grad_dsc, 20, 100);
+    TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+    TEST_ASSERT_NOT_NULL(grad2->entry);
+
+    /*Different size*/
+    lv_grad_t * grad3 = lv_gradient_get(&grad_dsc, 20, 101);
+    TEST_ASSERT_NOT_EQUAL(grad2, grad3);
+
+    /*Different stops*/
+    grad_dsc.stops[1].opa = LV_OPA_50;
+    lv_grad_t * grad4 = lv_gradient_get(&grad_dsc, 20, 100);
+    TEST_ASSERT_NOT_EQUAL(grad2, grad4);
+    TEST_ASSERT_NOT_EQUAL(grad3, grad4);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, grad4->opa_map[99]);
+
+    lv_gradient_cleanup(grad2);
+    lv_gradient_cleanup(grad3);
+    lv_gradient_cleanup(grad4);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gradient_line_buf_is_private(void)
+{
+    lv_grad_t * grad1 = lv_gradient_line_buf_create(64);
+    lv_grad_t * grad2 = lv_gradient_line_buf_create(64);
+    TEST_ASSERT_NOT_NULL(grad1);
+    TEST_ASSERT_NOT_NULL(grad2);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    TEST_ASSERT_NULL(grad1->entry);
+    TEST_ASSERT_EQUAL_INT32(64, grad1->size);
+
+    lv_gradient_cleanup(grad1);
+    lv_gradient_cleanup(grad2);
+}
+
+#endif
@@ -4,6 +4,14 @@
 
 #include "unity/unity.h"
 
+static uint32_t draw_cnt;
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -59,4 +67,117 @@ void test_update_layer_type_on_state_change(void)
 
 }
 
+void test_cache_layer(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_center(obj);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_50, 0);
+
+    lv_obj_t * child = lv_obj_create(obj);
+    lv_obj_set_size(child, 100, 60);
+    lv_obj_set_style_bg_color(child, lv_color_hex3(0xf00), 0);
+    lv_obj_add_event_cb(child, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    /*Render without the retained layer for reference*/
+    lv_refr_now(NULL);
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    lv_draw_buf_t * ref_buf = lv_draw_buf_dup(draw_buf);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CACHE_LAYER);
+    lv_obj_invalidate(obj);
+    draw_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_NOT_NULL(obj->spec_attr->layer_cache);
+
+    /*The retained layer might be ARGB8888 where the temporary layer wasn't, so allow rounding errors*/
+    uint32_t i;
+    for(i = 0; i < draw_buf->data_size; i++) {
+        TEST_ASSERT_UINT8_WITHIN(2, ref_buf->data[i], draw_buf->data[i]);
+    }
+    lv_draw_buf_destroy(ref_buf);
+
+    /*Changing only the transformation or the opacity shouldn't render the subtree again*/
+    lv_obj_set_style_transform_rotation(obj, 300, 0);
+    lv_refr_now(NULL);
+    lv_obj_set_style_transform_scale(obj, 300, 0);
+    lv_refr_now(NULL);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_70, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*Changing something inside needs a new rendering*/
+    lv_obj_set_style_bg_color(child, lv_color_hex3(0x00f), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+
+    /*The transformed retained layer should look like the transformed temporary layer.
+     *The layers start at different positions so the antialiased edges can slightly differ.*/
+    ref_buf = lv_draw_buf_dup(draw_buf);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CACHE_LAYER);
+    TEST_ASSERT_NULL(obj->spec_attr->layer_cache);
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_cnt);
+
+    for(i = 0; i < draw_buf->data_size; i++) {
+        TEST_ASSERT_UINT8_WITHIN(16, ref_buf->data[i], draw_buf->data[i]);
+    }
+    lv_draw_buf_destroy(ref_buf);
+}
+
+
+void test_cache_layer_memory(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_set_style_transform_rotation(obj, 300, 0);
+    lv_refr_now(NULL);
+    uint32_t used_before = LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers;
+
+    /*The retained layer counts towards LV_DRAW_LAYER_MAX_MEMORY while it exists*/
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CACHE_LAYER);
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    lv_draw_buf_t * cache = obj->spec_attr->layer_cache;
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL_UINT32(used_before + cache->header.h * cache->header.stride,
+                             LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers);
+
+    lv_obj_delete(obj);
+    TEST_ASSERT_EQUAL_UINT32(used_before, LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers);
+}
+
+void test_cache_layer_freed_without_layer(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 150);
+    lv_obj_set_style_transform_rotation(obj, 300, 0);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CACHE_LAYER);
+    lv_refr_now(NULL);
+    uint32_t used_before = LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers;
+    TEST_ASSERT_NOT_NULL(obj->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL_UINT32(1, LV_GLOBAL_DEFAULT()->layer_cache_cnt);
+
+    /*Without a layer the retained layer isn't used so it's freed*/
+    lv_obj_set_style_transform_rotation(obj, 0, 0);
+    TEST_ASSERT_NULL(obj->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->layer_cache_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(used_before, LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(obj->spec_attr->layer_cache);
+
+    /*It's created again when a layer is needed again*/
+    lv_obj_set_style_transform_rotation(obj, 300, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(obj->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL_UINT32(1, LV_GLOBAL_DEFAULT()->layer_cache_cnt);
+
+    lv_obj_delete(obj);
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->layer_cache_cnt);
+}
 #endif
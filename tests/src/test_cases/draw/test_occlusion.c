@@ -0,0 +1,151 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t draw_cnt;
+static uint32_t label_task_cnt;
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+static void draw_task_added_event_cb(lv_event_t * e)
+{
+    lv_draw_task_t * t = lv_event_get_draw_task(e);
+    if(lv_draw_task_get_type(t) == LV_DRAW_TASK_TYPE_LABEL) label_task_cnt++;
+}
+
+static lv_draw_buf_t * render_and_dup(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_buf_t * buf = lv_draw_buf_dup(lv_display_get_buf_active(NULL));
+    TEST_ASSERT_NOT_NULL(buf);
+    return buf;
+}
+
+static void assert_buf_equal(const lv_draw_buf_t * buf1, const lv_draw_buf_t * buf2)
+{
+    TEST_ASSERT_EQUAL_UINT32(buf1->data_size, buf2->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(buf1->data, buf2->data, buf1->data_size);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    draw_cnt = 0;
+    label_task_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_occlusion_skip_covered_widget(void)
+{
+    lv_obj_t * below = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(below, 100, 100);
+    lv_obj_set_pos(below, 60, 60);
+    lv_obj_add_event_cb(below, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_t * label = lv_label_create(below);
+    lv_label_set_text(label, "Covered");
+    lv_obj_add_event_cb(label, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_t * cover = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cover, 300, 250);
+    lv_obj_set_pos(cover, 10, 10);
+    lv_obj_set_style_radius(cover, 30, 0);
+    lv_obj_set_style_bg_color(cover, lv_color_hex3(0x0a0), 0);
+
+    lv_draw_buf_t * culled_buf = render_and_dup();
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, LV_GLOBAL_DEFAULT()->draw_info.occlusion.culled_cnt);
+
+    /*The result should be the same as without the covered Widget*/
+    lv_obj_add_flag(below, LV_OBJ_FLAG_HIDDEN);
+    lv_draw_buf_t * ref_buf = render_and_dup();
+    assert_buf_equal(ref_buf, culled_buf);
+
+    lv_draw_buf_destroy(culled_buf);
+    lv_draw_buf_destroy(ref_buf);
+}
+
+void test_occlusion_keep_not_covered_widget(void)
+{
+    lv_obj_t * below = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(below, 100, 100);
+    lv_obj_set_pos(below, 60, 60);
+    lv_obj_add_event_cb(below, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    /*Only partially covered*/
+    lv_obj_t * cover = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cover, 100, 100);
+    lv_obj_set_pos(cover, 100, 100);
+    lv_draw_buf_destroy(render_and_dup());
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*Fully covered but semi-transparent*/
+    lv_obj_set_size(cover, 300, 250);
+    lv_obj_set_pos(cover, 10, 10);
+    lv_obj_set_style_bg_opa(cover, LV_OPA_70, 0);
+    draw_cnt = 0;
+    lv_draw_buf_destroy(render_and_dup());
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*Fully covered but with transparent parent*/
+    lv_obj_set_style_bg_opa(cover, LV_OPA_COVER, 0);
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_90, 0);
+    draw_cnt = 0;
+    lv_draw_buf_destroy(render_and_dup());
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_COVER, 0);
+
+    /*Fully covered by a Widget drawn earlier*/
+    lv_obj_move_to_index(cover, 0);
+    draw_cnt = 0;
+    lv_draw_buf_destroy(render_and_dup());
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+}
+
+void test_occlusion_skip_covered_draw_task(void)
+{
+    /*The outline of the label is visible but its text is fully covered*/
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_pos(label, 40, 20);
+    lv_obj_set_size(label, 70, 20);
+    lv_label_set_text(label, "Covered");
+    lv_obj_set_style_outline_width(label, 10, 0);
+    lv_obj_set_style_outline_pad(label, 30, 0);
+    lv_obj_add_flag(label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(label, draw_task_added_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    lv_obj_t * cover = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cover, 150, 60);
+    lv_obj_set_pos(cover, 0, 0);
+
+    lv_draw_buf_t * culled_buf = render_and_dup();
+    TEST_ASSERT_EQUAL_UINT32(0, label_task_cnt);
+
+    /*The result should be the same as without the text*/
+    lv_label_set_text(label, "");
+    lv_draw_buf_t * ref_buf = render_and_dup();
+    assert_buf_equal(ref_buf, culled_buf);
+
+    /*Without the cover the text is drawn*/
+    lv_label_set_text(label, "Covered");
+    lv_obj_add_flag(cover, LV_OBJ_FLAG_HIDDEN);
+    lv_draw_buf_destroy(render_and_dup());
+    TEST_ASSERT_EQUAL_UINT32(1, label_task_cnt);
+
+    lv_draw_buf_destroy(culled_buf);
+    lv_draw_buf_destroy(ref_buf);
+}
+
+#endif
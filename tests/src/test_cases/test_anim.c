@@ -5,6 +5,8 @@
 #include "unity/unity.h"
 #include "lv_test_helpers.h"
 
+#include <time.h>
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -27,6 +29,28 @@ static void custom_exec_cb(lv_anim_t * a, int32_t v)
     *var_i32 = v;
 }
 
+static uint32_t batch_call_cnt;
+static uint32_t batch_anim_cnt;
+
+static void batch_exec_cb(lv_anim_t ** anims, uint32_t cnt)
+{
+    batch_call_cnt++;
+    batch_anim_cnt += cnt;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        int32_t * var_i32 = anims[i]->var;
+        *var_i32 = anims[i]->current_value;
+    }
+}
+
+static void delete_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    LV_UNUSED(v);
+    lv_anim_delete(NULL, NULL);
+}
+
 void test_anim_delete(void)
 {
     int32_t var;
@@ -91,4 +115,231 @@ void test_anim_delete_custom(void)
     TEST_ASSERT_EQUAL(39, var);
 }
 
+void test_anim_batch_exec(void)
+{
+    int32_t var[3] = {0};
+    batch_call_cnt = 0;
+    batch_anim_cnt = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_batch_exec_cb(&a, batch_exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_early_apply(&a, false);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_anim_set_var(&a, &var[i]);
+        lv_anim_start(&a);
+    }
+
+    /*The callback is called once for all the animations in each run*/
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(19, var[0]);
+    TEST_ASSERT_EQUAL(19, var[1]);
+    TEST_ASSERT_EQUAL(19, var[2]);
+    TEST_ASSERT_EQUAL(batch_call_cnt * 3, batch_anim_cnt);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(100, var[0]);
+    TEST_ASSERT_EQUAL(100, var[2]);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+void test_anim_batch_delete_before_apply(void)
+{
+    int32_t var_batch = 0;
+    int32_t var_del = 0;
+    batch_call_cnt = 0;
+    batch_anim_cnt = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_early_apply(&a, false);
+
+    /*The older animation runs later and deletes the already processed batched animation*/
+    lv_anim_set_var(&a, &var_del);
+    lv_anim_set_exec_cb(&a, delete_exec_cb);
+    lv_anim_start(&a);
+
+    lv_anim_set_exec_cb(&a, NULL);
+    lv_anim_set_var(&a, &var_batch);
+    lv_anim_set_batch_exec_cb(&a, batch_exec_cb);
+    lv_anim_start(&a);
+
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(0, batch_call_cnt);
+    TEST_ASSERT_EQUAL(0, var_batch);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+void test_anim_many(void)
+{
+    int32_t var[100] = {0};
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_anim_set_var(&a, &var[i]);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL(100, lv_anim_count_running());
+
+    for(i = 0; i < 100; i += 2) {
+        TEST_ASSERT_TRUE(lv_anim_delete(&var[i], exec_cb));
+    }
+    TEST_ASSERT_EQUAL(50, lv_anim_count_running());
+    TEST_ASSERT_NULL(lv_anim_get(&var[0], exec_cb));
+    TEST_ASSERT_NOT_NULL(lv_anim_get(&var[1], exec_cb));
+
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(0, var[0]);
+    TEST_ASSERT_EQUAL(19, var[1]);
+    TEST_ASSERT_EQUAL(19, var[99]);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(100, var[1]);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+static double bezier_ref(double t, double p1, double p2)
+{
+    return 3 * (1 - t) * (1 - t) * t * p1 + 3 * (1 - t) * t * t * p2 + t * t * t;
+}
+
+/*Compare a path with the exact cubic bezier curve having the same parameters*/
+static void anim_path_compare(const lv_anim_t * a, int16_t x1, int16_t y1, int16_t x2, int16_t y2, int32_t tolerance)
+{
+    lv_anim_t a_path = *a;
+    lv_anim_set_values(&a_path, 0, 1000);
+    lv_anim_set_duration(&a_path, 1000);
+
+    int32_t x;
+    for(x = 0; x <= 1000; x++) {
+        /*Find the bezier's parameter for `x` by bisection*/
+        double lo = 0;
+        double hi = 1;
+        uint32_t i;
+        for(i = 0; i < 50; i++) {
+            double t = (lo + hi) / 2;
+            if(bezier_ref(t, x1 / 1024.0, x2 / 1024.0) < x / 1000.0) lo = t;
+            else hi = t;
+        }
+        int32_t expected = (int32_t)(bezier_ref((lo + hi) / 2, y1 / 1024.0, y2 / 1024.0) * 1000);
+
+        a_path.act_time = x;
+        TEST_ASSERT_INT32_WITHIN(tolerance, expected, a_path.path_cb(&a_path));
+    }
+
+    TEST_ASSERT_EQUAL_INT32(1000, a_path.path_cb(&a_path));
+}
+
+static void anim_path_compare_builtin(lv_anim_path_cb_t path_cb, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_path_cb(&a, path_cb);
+    anim_path_compare(&a, x1, y1, x2, y2, 3);
+}
+
+void test_anim_path_lut_builtin(void)
+{
+    anim_path_compare_builtin(lv_anim_path_ease_in, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                              LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    anim_path_compare_builtin(lv_anim_path_ease_out, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
+                              LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    anim_path_compare_builtin(lv_anim_path_ease_in_out, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                              LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    anim_path_compare_builtin(lv_anim_path_overshoot, 341, 0, 683, 1300);
+}
+
+void test_anim_path_lut_custom(void)
+{
+    static int16_t values[65];
+    static const lv_anim_path_lut_t lut = {values, 65};
+
+    lv_anim_t a_bezier;
+    lv_anim_init(&a_bezier);
+    lv_anim_set_values(&a_bezier, 0, 1000);
+    lv_anim_set_duration(&a_bezier, 1000);
+    lv_anim_set_path_cb(&a_bezier, lv_anim_path_custom_bezier3);
+    LV_ANIM_SET_EASE_IN_OUT_BACK(&a_bezier);
+
+    lv_anim_path_lut_fill(&a_bezier, values, 65);
+    TEST_ASSERT_EQUAL_INT16(0, values[0]);
+    TEST_ASSERT_EQUAL_INT16(LV_BEZIER_VAL_MAX, values[64]);
+
+    lv_anim_t a_lut = a_bezier;
+    lv_anim_set_path_lut(&a_lut, &lut);
+    TEST_ASSERT_EQUAL_PTR(lv_anim_path_lut, a_lut.path_cb);
+
+    /*The table was sampled from the fixed point bezier which is less accurate on steep curves*/
+    const lv_anim_bezier3_para_t * para = &a_bezier.parameter.bezier3;
+    anim_path_compare(&a_lut, para->x1, para->y1, para->x2, para->y2, 8);
+}
+
+/*Calculate the path of 1000 animations in 100 steps and return the best CPU time of a few runs.
+ *The sum of the calculated values is returned in `sum` to compare the paths.*/
+static clock_t anim_path_benchmark(const lv_anim_t * a, int32_t * sum)
+{
+    static lv_anim_t anims[1000];
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        anims[i] = *a;
+    }
+
+    volatile int32_t run_sum = 0;
+    clock_t best = 0;
+    uint32_t run;
+    for(run = 0; run < 3; run++) {
+        run_sum = 0;
+        clock_t start = clock();
+        uint32_t step;
+        for(step = 0; step < 100; step++) {
+            for(i = 0; i < 1000; i++) {
+                anims[i].act_time = (int32_t)(step * 10 + i % 10);
+                run_sum += anims[i].path_cb(&anims[i]);
+            }
+        }
+        clock_t elapsed = clock() - start;
+        if(run == 0 || elapsed < best) best = elapsed;
+    }
+
+    *sum = run_sum;
+    return best;
+}
+
+void test_anim_path_lut_benchmark(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_duration(&a, 1000);
+
+    lv_anim_set_path_cb(&a, lv_anim_path_custom_bezier3);
+    lv_anim_set_bezier3_param(&a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                              LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    int32_t bezier_sum;
+    clock_t bezier_time = anim_path_benchmark(&a, &bezier_sum);
+
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+    int32_t lut_sum;
+    clock_t lut_time = anim_path_benchmark(&a, &lut_sum);
+
+    /*The timings depend on the machine so they are only printed*/
+    TEST_PRINTF("1000 animations, 100 steps: bezier: %ld us, lookup table: %ld us",
+                (long)(bezier_time * 1000000 / CLOCKS_PER_SEC), (long)(lut_time * 1000000 / CLOCKS_PER_SEC));
+
+    /*Both paths calculate the same curve within the tolerance of the lookup table*/
+    TEST_ASSERT_INT32_WITHIN(3 * 1000 * 100, bezier_sum, lut_sum);
+}
+
 #endif
@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CHUNK_SIZE 256
+
+static lv_arena_t arena;
+
+void setUp(void)
+{
+    lv_arena_init(&arena, CHUNK_SIZE);
+}
+
+void tearDown(void)
+{
+    lv_arena_deinit(&arena);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_arena_alloc(void)
+{
+    uint8_t * p1 = lv_arena_alloc(&arena, 3);
+    uint8_t * p2 = lv_arena_alloc(&arena, 10);
+    TEST_ASSERT_NOT_NULL(p1);
+    TEST_ASSERT_NOT_NULL(p2);
+    TEST_ASSERT_EQUAL(0, (lv_uintptr_t)p1 % LV_ARENA_ALIGN);
+    TEST_ASSERT_EQUAL(0, (lv_uintptr_t)p2 % LV_ARENA_ALIGN);
+
+    /*Bumped in the same chunk*/
+    TEST_ASSERT_EQUAL_PTR(p1 + LV_ARENA_ALIGN, p2);
+    TEST_ASSERT_TRUE(lv_arena_contains(&arena, p1));
+    TEST_ASSERT_TRUE(lv_arena_contains(&arena, p2));
+    TEST_ASSERT_EQUAL(13, arena.used);
+
+    uint8_t * zeroed = lv_arena_alloc_zeroed(&arena, 16);
+    uint32_t i;
+    for(i = 0; i < 16; i++) TEST_ASSERT_EQUAL_UINT8(0, zeroed[i]);
+
+    /*Memory not from the arena is freed normally*/
+    void * heap = lv_malloc(16);
+    TEST_ASSERT_FALSE(lv_arena_contains(&arena, heap));
+    lv_arena_free(&arena, heap);
+    lv_arena_free(&arena, p1);
+    lv_arena_free(&arena, NULL);
+}
+
+void test_arena_reset(void)
+{
+    /*Fill the first chunk and add more chunks*/
+    void * first = lv_arena_alloc(&arena, CHUNK_SIZE - LV_ARENA_ALIGN);
+    void * second = lv_arena_alloc(&arena, 64);
+    void * large = lv_arena_alloc(&arena, CHUNK_SIZE * 4);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_NOT_NULL(large);
+    TEST_ASSERT_TRUE(lv_arena_contains(&arena, second));
+    TEST_ASSERT_TRUE(lv_arena_contains(&arena, (uint8_t *)large + CHUNK_SIZE * 4 - 1));
+    size_t used = arena.used;
+
+    /*Only the first chunk is kept and it's reused from its beginning*/
+    lv_arena_reset(&arena);
+    TEST_ASSERT_EQUAL(0, arena.used);
+    TEST_ASSERT_EQUAL(used, arena.max_used);
+    TEST_ASSERT_FALSE(lv_arena_contains(&arena, second));
+    TEST_ASSERT_FALSE(lv_arena_contains(&arena, large));
+    TEST_ASSERT_EQUAL_PTR(first, lv_arena_alloc(&arena, 1));
+}
+
+void test_arena_frame(void)
+{
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    lv_display_t * disp = lv_display_get_default();
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Frame arena");
+    lv_obj_t * btn = lv_button_create(lv_screen_active());
+    lv_obj_set_pos(btn, 20, 50);
+    lv_obj_set_style_transform_rotation(btn, 100, 0);
+
+    disp->frame_arena.max_used = 0;
+    lv_refr_now(NULL);
+
+    /*The draw tasks were allocated from the arena and released after the refresh*/
+    TEST_ASSERT_GREATER_THAN(0, disp->frame_arena.max_used);
+    TEST_ASSERT_EQUAL(0, disp->frame_arena.used);
+
+    /*Outside of rendering the heap is used*/
+    void * p = lv_draw_frame_malloc(16);
+    TEST_ASSERT_FALSE(lv_arena_contains(&disp->frame_arena, p));
+    lv_draw_frame_free(p);
+#else
+    TEST_PASS();
+#endif
+}
+
+
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+static void dummy_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+/*Render 10 rows of labels with a buffer of `buf_rows` rows and return the arena's peak usage*/
+static size_t frame_arena_peak(uint32_t buf_rows)
+{
+    lv_display_t * disp = lv_display_create(100, 100);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_draw_buf_t * buf = lv_draw_buf_create(100, buf_rows, lv_display_get_color_format(disp), LV_STRIDE_AUTO);
+    lv_display_set_draw_buffers(disp, buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * label = lv_label_create(lv_display_get_screen_active(disp));
+        lv_label_set_text(label, "Row");
+        lv_obj_set_y(label, i * 10);
+    }
+
+    disp->frame_arena.max_used = 0;
+    lv_refr_now(disp);
+    size_t peak = disp->frame_arena.max_used;
+    TEST_ASSERT_EQUAL(0, disp->frame_arena.used);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+    return peak;
+}
+#endif
+
+void test_arena_frame_partial(void)
+{
+#if LV_DRAW_FRAME_ARENA_SIZE > 0
+    /*The arena is reset after each rendered band so a small buffer needs less of it*/
+    size_t full_peak = frame_arena_peak(100);
+    size_t partial_peak = frame_arena_peak(10);
+    TEST_ASSERT_GREATER_THAN(0, partial_peak);
+    TEST_ASSERT_LESS_THAN(full_peak, partial_peak);
+#else
+    TEST_PASS();
+#endif
+}
+#endif
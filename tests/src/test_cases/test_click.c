@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 #include "../lv_test_indev.h"
 #include "unity/unity.h"
 
@@ -161,4 +162,88 @@ void test_click(void)
     TEST_ASSERT_EQUAL_UINT8(1, counts.short_click_streak);
 }
 
+static void render_ready_cb(lv_event_t * e)
+{
+    uint32_t * render_cnt = lv_event_get_user_data(e);
+    (*render_cnt)++;
+}
+
+static void press_change_color_cb(lv_event_t * e)
+{
+    lv_obj_set_style_bg_color(lv_event_get_target(e), lv_color_hex(0xff0000), 0);
+}
+
+void test_click_immediate_refresh(void)
+{
+    lv_obj_t * button = lv_button_create(lv_screen_active());
+    lv_obj_set_size(button, 100, 100);
+    lv_obj_add_event_cb(button, press_change_color_cb, LV_EVENT_PRESSED, NULL);
+
+    uint32_t render_cnt = 0;
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, &render_cnt);
+
+    /*Render the initial state*/
+    lv_refr_now(NULL);
+
+    lv_indev_set_mode(lv_test_mouse_indev, LV_INDEV_MODE_EVENT);
+    lv_indev_set_immediate_refresh(lv_test_mouse_indev, true);
+    TEST_ASSERT_TRUE(lv_indev_get_immediate_refresh(lv_test_mouse_indev));
+
+    /*Nothing changes on the screen so nothing is rendered*/
+    lv_test_mouse_move_to(150, 150);
+    render_cnt = 0;
+    lv_indev_read(lv_test_mouse_indev);
+    TEST_ASSERT_EQUAL_UINT32(0, render_cnt);
+
+    /*Pressing the button changes its color which should be rendered without running the timers*/
+    lv_test_mouse_move_to(50, 50);
+    lv_test_mouse_press();
+    lv_indev_read(lv_test_mouse_indev);
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    lv_test_mouse_release();
+    lv_indev_read(lv_test_mouse_indev);
+
+    lv_indev_set_immediate_refresh(lv_test_mouse_indev, false);
+    lv_indev_set_mode(lv_test_mouse_indev, LV_INDEV_MODE_TIMER);
+    lv_display_remove_event_cb_with_user_data(disp, render_ready_cb, &render_cnt);
+}
+
+void test_click_input_latency_only_on_change(void)
+{
+#if LV_USE_PERF_MONITOR
+    lv_obj_t * button = lv_button_create(lv_screen_active());
+    lv_obj_set_size(button, 100, 100);
+    lv_obj_add_event_cb(button, press_change_color_cb, LV_EVENT_PRESSED, NULL);
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+    disp->perf_sysmon_info.measured.input_cnt = 0;
+
+    /*Pressing the button is measured*/
+    lv_test_mouse_move_to(50, 50);
+    lv_test_mouse_press();
+    lv_indev_read(lv_test_mouse_indev);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->perf_sysmon_info.measured.input_cnt);
+
+    /*Holding the button still is not an input even if something else is rendered*/
+    lv_indev_read(lv_test_mouse_indev);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->perf_sysmon_info.measured.input_cnt);
+
+    /*Moving while pressed is*/
+    lv_test_mouse_move_to(60, 60);
+    lv_indev_read(lv_test_mouse_indev);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, disp->perf_sysmon_info.measured.input_cnt);
+
+    lv_test_mouse_release();
+    lv_indev_read(lv_test_mouse_indev);
+#endif
+}
+
 #endif
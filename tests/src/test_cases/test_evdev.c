@@ -0,0 +1,250 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_EVDEV && LV_USE_OS
+
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/input.h>
+
+/*The events are written into a FIFO which is opened by the driver like a device*/
+static char fifo_path[64];
+static int fifo_fd;
+static lv_indev_t * indev;
+static lv_obj_t * button;
+
+typedef struct {
+    uint32_t pressed_cnt;
+    uint32_t pressing_cnt;
+    uint32_t released_cnt;
+    uint32_t clicked_cnt;
+} event_counts_t;
+
+static event_counts_t counts;
+
+static void button_event_cb(lv_event_t * e)
+{
+    switch(lv_event_get_code(e)) {
+        case LV_EVENT_PRESSED:
+            counts.pressed_cnt++;
+            break;
+        case LV_EVENT_PRESSING:
+            counts.pressing_cnt++;
+            break;
+        case LV_EVENT_RELEASED:
+            counts.released_cnt++;
+            break;
+        case LV_EVENT_CLICKED:
+            counts.clicked_cnt++;
+            break;
+        default:
+            break;
+    }
+}
+
+static void write_event(uint16_t type, uint16_t code, int32_t value, uint32_t time_ms)
+{
+    struct input_event in;
+    lv_memzero(&in, sizeof(in));
+    in.input_event_sec = time_ms / 1000;
+    in.input_event_usec = (time_ms % 1000) * 1000;
+    in.type = type;
+    in.code = code;
+    in.value = value;
+    TEST_ASSERT_EQUAL_INT((int)sizeof(in), (int)write(fifo_fd, &in, sizeof(in)));
+}
+
+/*A complete report of a touchscreen*/
+static void write_touch(int32_t x, int32_t y, bool pressed, uint32_t time_ms)
+{
+    write_event(EV_ABS, ABS_X, x, time_ms);
+    write_event(EV_ABS, ABS_Y, y, time_ms);
+    write_event(EV_KEY, BTN_TOUCH, pressed ? 1 : 0, time_ms);
+    write_event(EV_SYN, SYN_REPORT, 0, time_ms);
+}
+
+/*Wait until the reader thread has drained the FIFO and queued the samples*/
+static void wait_for_reader(void)
+{
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        int unread = 0;
+        TEST_ASSERT_EQUAL_INT(0, ioctl(fifo_fd, FIONREAD, &unread));
+        if(unread == 0) break;
+        usleep(1000);
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(1000, i);
+
+    /*The samples are queued right after reading them*/
+    usleep(20 * 1000);
+}
+
+void setUp(void)
+{
+    lv_snprintf(fifo_path, sizeof(fifo_path), "/tmp/lv_test_evdev_%d", (int)getpid());
+    unlink(fifo_path);
+    TEST_ASSERT_EQUAL_INT(0, mkfifo(fifo_path, 0600));
+
+    /*Keep a read-write handle so the driver's open doesn't block and never sees a hang up*/
+    fifo_fd = open(fifo_path, O_RDWR | O_NONBLOCK);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, fifo_fd);
+
+    indev = lv_evdev_create(LV_INDEV_TYPE_POINTER, fifo_path);
+    TEST_ASSERT_NOT_NULL(indev);
+
+    button = lv_button_create(lv_screen_active());
+    lv_obj_set_pos(button, 0, 0);
+    lv_obj_set_size(button, 100, 100);
+    lv_obj_add_event_cb(button, button_event_cb, LV_EVENT_ALL, NULL);
+    lv_obj_update_layout(button);
+
+    lv_memzero(&counts, sizeof(counts));
+}
+
+void tearDown(void)
+{
+    lv_evdev_delete(indev);
+    indev = NULL;
+    close(fifo_fd);
+    unlink(fifo_path);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_evdev_reader_thread_start_stop(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, true));
+    /*Enabling again is a no-op*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, true));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, false));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, false));
+
+    /*The device is read in the read callback again*/
+    write_touch(50, 50, true, 0);
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, lv_indev_get_state(indev));
+    TEST_ASSERT_EQUAL_UINT32(1, counts.pressed_cnt);
+
+    write_touch(50, 50, false, 10);
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, lv_indev_get_state(indev));
+    TEST_ASSERT_EQUAL_UINT32(1, counts.clicked_cnt);
+}
+
+void test_evdev_reader_thread_keeps_quick_click(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, true));
+
+    /*Pressed and released between two reads*/
+    write_touch(50, 50, true, 0);
+    write_touch(50, 50, false, 5);
+    wait_for_reader();
+
+    /*Both samples are processed in one read*/
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.pressed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.released_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.clicked_cnt);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, lv_indev_get_state(indev));
+
+    /*Nothing new was queued, the last state is reported*/
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.pressed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.clicked_cnt);
+}
+
+void test_evdev_reader_thread_merges_motion(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, true));
+
+    lv_timer_t * read_timer = lv_indev_get_read_timer(indev);
+    TEST_ASSERT_NOT_NULL(read_timer);
+    lv_timer_set_period(read_timer, 30);
+
+    /*Motion sampled every 10 ms for 90 ms*/
+    uint32_t t;
+    for(t = 0; t <= 90; t += 10) {
+        write_touch(10 + t / 2, 50, true, t);
+    }
+    wait_for_reader();
+
+    /*The samples are merged to one per read period: 0..20, 30..50, 60..80 and 90 ms*/
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.pressed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, counts.pressing_cnt);
+
+    lv_point_t p;
+    lv_indev_get_point(indev, &p);
+    TEST_ASSERT_EQUAL_INT32(55, p.x);
+    TEST_ASSERT_EQUAL_INT32(50, p.y);
+
+    /*Releasing is never merged into the motion*/
+    write_touch(55, 50, false, 95);
+    wait_for_reader();
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.released_cnt);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, lv_indev_get_state(indev));
+}
+
+void test_evdev_reader_thread_queue_full(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_evdev_set_reader_thread(indev, true));
+
+    lv_timer_t * read_timer = lv_indev_get_read_timer(indev);
+    TEST_ASSERT_NOT_NULL(read_timer);
+    lv_timer_set_period(read_timer, 30);
+
+    /*More samples than the queue can hold. They are far apart so none of them is merged.*/
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        write_touch(50, 50, i % 2 == 0, i * 100);
+    }
+    wait_for_reader();
+
+    /*The newest samples are dropped, the queued ones are all processed*/
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(128, counts.pressed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(128, counts.released_cnt);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, lv_indev_get_state(indev));
+
+    /*There is room again*/
+    write_touch(50, 50, true, 30000);
+    wait_for_reader();
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(129, counts.pressed_cnt);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_evdev_reader_thread_start_stop(void)
+{
+}
+
+void test_evdev_reader_thread_keeps_quick_click(void)
+{
+}
+
+void test_evdev_reader_thread_merges_motion(void)
+{
+}
+
+void test_evdev_reader_thread_queue_full(void)
+{
+}
+
+#endif
+
+#endif
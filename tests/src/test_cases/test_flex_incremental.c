@@ -0,0 +1,148 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include <time.h>
+
+static lv_obj_t * active_screen = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+static lv_obj_t * add_item(lv_obj_t * cont, uint32_t i)
+{
+    lv_obj_t * item = lv_obj_create(cont);
+    lv_obj_set_size(item, 20 + (i * 37) % 60, 10 + (i * 13) % 30);
+    lv_obj_set_style_margin_top(item, i % 3, 0);
+    return item;
+}
+
+static lv_obj_t * create_cont(lv_flex_flow_t flow, uint32_t item_cnt)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_set_flex_flow(cont, flow);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_START);
+
+    uint32_t i;
+    for(i = 0; i < item_cnt; i++) add_item(cont, i);
+
+    lv_obj_update_layout(cont);
+    return cont;
+}
+
+void test_flex_incremental_changes(void)
+{
+    lv_obj_t * cont = create_cont(LV_FLEX_FLOW_ROW_WRAP, 60);
+
+    add_item(cont, 60);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_width(lv_obj_get_child(cont, 30), 90);
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*The first item of a track can move to the previous track*/
+    lv_obj_t * item = lv_obj_get_child(cont, 40);
+    while(lv_obj_get_child(cont, 40)->coords.y1 == lv_obj_get_child(cont, 39)->coords.y1) {
+        item = lv_obj_get_child(cont, lv_obj_get_index(item) + 1);
+    }
+    lv_obj_set_width(item, 2);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_delete(lv_obj_get_child(cont, 10));
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_delete(lv_obj_get_child(cont, -1));
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 20), LV_OBJ_FLAG_HIDDEN);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 25), LV_OBJ_FLAG_FLEX_IN_NEW_TRACK);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 50), 1);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_move_to_index(lv_obj_get_child(cont, 55), 5);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_parent(lv_obj_get_child(cont, 15), active_screen);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_style_margin_left(lv_obj_get_child(cont, 35), 10, 0);
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*The children are moved by scrolling so they keep their position relative to the content*/
+    lv_obj_scroll_to_y(cont, 50, LV_ANIM_OFF);
+    add_item(cont, 61);
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*The container's own changes are handled too*/
+    lv_obj_set_width(cont, 300);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_style_pad_column(cont, 12, 0);
+    lv_test_assert_layout_from_scratch(cont);
+}
+
+void test_flex_incremental_content_size(void)
+{
+    /*Like a list: the height grows with the items*/
+    lv_obj_t * cont = create_cont(LV_FLEX_FLOW_COLUMN, 20);
+    lv_obj_set_height(cont, LV_SIZE_CONTENT);
+    lv_test_assert_layout_from_scratch(cont);
+
+    add_item(cont, 20);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_height(lv_obj_get_child(cont, 3), 50);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_delete(lv_obj_get_child(cont, 0));
+    lv_test_assert_layout_from_scratch(cont);
+}
+
+/*Return the CPU time of adding and deleting an item `repeat` times with incremental or full layout updates*/
+static clock_t layout_benchmark(lv_obj_t * cont, uint32_t repeat, bool full)
+{
+    clock_t start = clock();
+    uint32_t i;
+    for(i = 0; i < repeat; i++) {
+        lv_obj_t * item = add_item(cont, i);
+        if(full) lv_obj_mark_layout_as_dirty(cont);
+        lv_obj_update_layout(cont);
+
+        lv_obj_delete(item);
+        if(full) lv_obj_mark_layout_as_dirty(cont);
+        lv_obj_update_layout(cont);
+    }
+    return clock() - start;
+}
+
+void test_flex_incremental_benchmark(void)
+{
+    static const uint32_t item_cnts[] = {100, 300, 1000};
+    uint32_t i;
+    for(i = 0; i < sizeof(item_cnts) / sizeof(item_cnts[0]); i++) {
+        lv_obj_t * cont = create_cont(LV_FLEX_FLOW_ROW_WRAP, item_cnts[i]);
+        clock_t incremental_time = layout_benchmark(cont, 5, false);
+        clock_t full_time = layout_benchmark(cont, 5, true);
+        /*The timings depend on the machine so they are only printed*/
+        TEST_PRINTF("%d children, 5 appends and deletes: incremental: %ld us, full: %ld us", (int)item_cnts[i],
+                    (long)(incremental_time * 1000000 / CLOCKS_PER_SEC), (long)(full_time * 1000000 / CLOCKS_PER_SEC));
+        lv_test_assert_layout_from_scratch(cont);
+        lv_obj_delete(cont);
+    }
+}
+
+#endif
@@ -0,0 +1,193 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static lv_obj_t * active_screen = NULL;
+
+static int32_t col_dsc[] = {LV_GRID_CONTENT, 50, LV_GRID_FR(1), LV_GRID_FR(2), LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+static int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_FR(1), 40, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+static lv_obj_t * create_cont(void)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 500, 400);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+
+    uint32_t col;
+    uint32_t row;
+    for(row = 0; row < 4; row++) {
+        for(col = 0; col < 5; col++) {
+            lv_obj_t * item = lv_obj_create(cont);
+            lv_obj_set_size(item, 10 + (row * 5 + col) * 7 % 50, 10 + (row * 5 + col) * 11 % 40);
+            lv_obj_set_grid_cell(item, LV_GRID_ALIGN_START, col, 1, LV_GRID_ALIGN_END, row, 1);
+        }
+    }
+
+    lv_obj_update_layout(cont);
+    return cont;
+}
+
+void test_grid_cache_changes(void)
+{
+    lv_obj_t * cont = create_cont();
+
+    /*The content sized tracks follow the size of the children*/
+    lv_obj_set_width(lv_obj_get_child(cont, 0), 120);
+    lv_test_assert_layout_from_scratch(cont);
+    TEST_ASSERT_EQUAL_INT32(120, lv_obj_get_x(lv_obj_get_child(cont, 1)) - lv_obj_get_x(lv_obj_get_child(cont, 0)) -
+                            lv_obj_get_style_pad_column(cont, 0));
+
+    lv_obj_set_height(lv_obj_get_child(cont, 16), 70);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 0), LV_OBJ_FLAG_HIDDEN);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_delete(lv_obj_get_child(cont, 4));
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_t * item = lv_obj_create(cont);
+    lv_obj_set_size(item, 90, 90);
+    lv_obj_set_grid_cell(item, LV_GRID_ALIGN_CENTER, 4, 1, LV_GRID_ALIGN_CENTER, 3, 1);
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*Spanning items don't affect the content sized tracks*/
+    lv_obj_set_grid_cell(item, LV_GRID_ALIGN_STRETCH, 3, 2, LV_GRID_ALIGN_STRETCH, 2, 2);
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*Only the rows change but the columns are reused*/
+    lv_obj_set_height(cont, 300);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_width(cont, 600);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_style_pad_column(cont, 3, 0);
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*The template is compared by value so it can be modified in place*/
+    col_dsc[1] = 80;
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    lv_test_assert_layout_from_scratch(cont);
+    col_dsc[1] = 50;
+
+    static int32_t col_dsc_more[] = {LV_GRID_CONTENT, 50, LV_GRID_FR(1), LV_GRID_FR(2), LV_GRID_CONTENT, 30, 30, 30,
+                                     LV_GRID_TEMPLATE_LAST
+                                    };
+    lv_obj_set_grid_dsc_array(cont, col_dsc_more, row_dsc);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_test_assert_layout_from_scratch(cont);
+}
+
+void test_grid_cache_layout_change(void)
+{
+    lv_obj_t * cont = create_cont();
+
+    /*The data saved by flex is replaced by the data of grid*/
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_update_layout(cont);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    lv_test_assert_layout_from_scratch(cont);
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_update_layout(cont);
+    lv_obj_set_height(lv_obj_get_child(cont, 3), 33);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(33, lv_obj_get_y(lv_obj_get_child(cont, 4)) - lv_obj_get_y(lv_obj_get_child(cont, 3)) -
+                            lv_obj_get_style_pad_row(cont, 0));
+}
+
+void test_grid_cache_container_resize(void)
+{
+    lv_obj_t * cont = create_cont();
+
+    /*Resizing the container alone reuses the content sized tracks,
+     *but children sized relative to the container still update them*/
+    lv_obj_set_width(lv_obj_get_child(cont, 0), lv_pct(20));
+    lv_obj_update_layout(cont);
+    int32_t col1_x = lv_obj_get_x(lv_obj_get_child(cont, 1));
+
+    lv_obj_set_height(cont, 350);
+    lv_test_assert_layout_from_scratch(cont);
+    TEST_ASSERT_EQUAL_INT32(col1_x, lv_obj_get_x(lv_obj_get_child(cont, 1)));
+
+    lv_obj_set_width(cont, 600);
+    lv_test_assert_layout_from_scratch(cont);
+    TEST_ASSERT_GREATER_THAN_INT32(col1_x, lv_obj_get_x(lv_obj_get_child(cont, 1)));
+}
+
+void test_grid_cache_remove_last_child(void)
+{
+    static int32_t cols[] = {LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static int32_t rows[] = {LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 500, 200);
+    lv_obj_set_grid_dsc_array(cont, cols, rows);
+    lv_obj_set_style_pad_column(cont, 0, 0);
+
+    lv_obj_t * fr_item = lv_obj_create(cont);
+    lv_obj_set_grid_cell(fr_item, LV_GRID_ALIGN_STRETCH, 1, 1, LV_GRID_ALIGN_START, 0, 1);
+
+    /*The last children are the only ones in the content sized column*/
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * item = lv_obj_create(cont);
+        lv_obj_set_size(item, 100, 50);
+        lv_obj_set_grid_cell(item, LV_GRID_ALIGN_START, 0, 1, LV_GRID_ALIGN_START, 0, 1);
+    }
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_x(fr_item));
+
+    /*Deleting the last child*/
+    lv_obj_set_width(lv_obj_get_child(cont, 1), 60);
+    lv_obj_update_layout(cont);
+    lv_obj_delete(lv_obj_get_child(cont, 2));
+    lv_test_assert_layout_from_scratch(cont);
+
+    /*Moving the last child to an other parent*/
+    lv_obj_set_parent(lv_obj_get_child(cont, 1), active_screen);
+    lv_test_assert_layout_from_scratch(cont);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_x(fr_item));
+}
+
+static void layout_changed_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void test_grid_cache_no_tracks(void)
+{
+    static int32_t no_tracks[] = {LV_GRID_TEMPLATE_LAST};
+    lv_obj_t * cont = create_cont();
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_update_layout(cont);
+
+    uint32_t cnt = 0;
+    lv_obj_add_event_cb(cont, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, &cnt);
+
+    /*There is nothing to place but the container is still sized and notified*/
+    lv_obj_set_grid_dsc_array(cont, col_dsc, no_tracks);
+    lv_obj_set_height(lv_obj_get_child(cont, 0), 300);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_GREATER_THAN(0, cnt);
+    TEST_ASSERT_GREATER_THAN(300, lv_obj_get_height(cont));
+}
+
+#endif
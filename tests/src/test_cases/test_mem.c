@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 
 void setUp(void)
 {
@@ -24,4 +25,104 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+#if LV_MEM_USE_THREAD_CACHE
+
+#define THREAD_CNT      4
+#define THREAD_LOOP_CNT 1000
+
+/*Unity can't fail a test from another thread so the workers only count the errors*/
+typedef struct {
+    uint32_t alloc_fail_cnt;
+    uint32_t corrupt_cnt;
+} thread_result_t;
+
+static void thread_cb(void * user_data)
+{
+    thread_result_t * res = user_data;
+    void * bufs[16];
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < THREAD_LOOP_CNT; i++) {
+        for(j = 0; j < 16; j++) {
+            bufs[j] = lv_malloc(8 + j * 16);
+            if(bufs[j] == NULL) {
+                res->alloc_fail_cnt++;
+                continue;
+            }
+            lv_memset(bufs[j], (int)j, 8 + j * 16);
+        }
+        for(j = 0; j < 16; j++) {
+            if(bufs[j] == NULL) continue;
+            if(((uint8_t *)bufs[j])[7] != j) res->corrupt_cnt++;
+            lv_free(bufs[j]);
+        }
+    }
+}
+
+#endif
+
+void test_mem_thread_cache(void)
+{
+#if LV_MEM_USE_THREAD_CACHE
+    size_t free_start = lv_test_get_free_mem();
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    /*Freed small blocks are reused without going back to the heap*/
+    void * p1 = lv_malloc(20);
+    lv_free(p1);
+    void * p2 = lv_malloc(24);
+    TEST_ASSERT_EQUAL_PTR(p1, p2);
+    lv_free(p2);
+
+    /*Cached blocks are reallocated in place while they fit, else moved to a larger class or the heap*/
+    uint8_t * buf = lv_malloc(20);
+    lv_memset(buf, 0x55, 20);
+    TEST_ASSERT_EQUAL_PTR(buf, lv_realloc(buf, 32));
+    buf = lv_realloc(buf, 100);
+    TEST_ASSERT_NOT_NULL(buf);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x55, buf, 20);
+    buf = lv_realloc(buf, 1000);
+    TEST_ASSERT_NOT_NULL(buf);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x55, buf, 20);
+    buf = lv_realloc(buf, 2000);
+    TEST_ASSERT_NOT_NULL(buf);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x55, buf, 20);
+    lv_free(buf);
+
+    lv_thread_t threads[THREAD_CNT];
+    thread_result_t results[THREAD_CNT];
+    lv_memzero(results, sizeof(results));
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_init(&threads[i], LV_THREAD_PRIO_MID, thread_cb, 0, &results[i]);
+    }
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+    for(i = 0; i < THREAD_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, results[i].alloc_fail_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, results[i].corrupt_cnt);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t hit_cnt = 0;
+    for(i = 0; i < LV_MEM_THREAD_CACHE_CLASS_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(16 << i, mon.thread_cache[i].block_size);
+        hit_cnt += mon.thread_cache[i].hit_cnt - mon_start.thread_cache[i].hit_cnt;
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_MEM_THREAD_CACHE_CNT, mon.thread_cache[i].cached_cnt);
+    }
+    /*The finished threads returned their blocks, only the caller's cache remains*/
+    TEST_ASSERT_GREATER_THAN_UINT32(THREAD_CNT * THREAD_LOOP_CNT, hit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_size_t(LV_MEM_THREAD_CACHE_CNT * 2 * (16 + 32 + 64 + 128 + 256), mon.thread_cache_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+
+    /*Nothing is left in the heap once the caches are flushed*/
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(free_start, 0);
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif
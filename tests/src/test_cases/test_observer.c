@@ -537,4 +537,101 @@ void test_observer_deinit(void)
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
 }
 
+static uint32_t publish_notify_cnt;
+
+static void observer_publish_cnt(lv_observer_t * observer, lv_subject_t * subject)
+{
+    LV_UNUSED(observer);
+    LV_UNUSED(subject);
+    publish_notify_cnt++;
+}
+
+void test_observer_publish(void)
+{
+    static lv_subject_t subject_int;
+    static lv_subject_t subject_pointer;
+    static lv_subject_t subject_color;
+    lv_subject_init_int(&subject_int, 0);
+    lv_subject_init_pointer(&subject_pointer, NULL);
+    lv_subject_init_color(&subject_color, lv_color_black());
+    lv_subject_add_observer(&subject_int, observer_publish_cnt, NULL);
+    lv_subject_add_observer(&subject_int, observer_int, NULL);
+
+    /*Nothing happens until the timer handler runs*/
+    publish_notify_cnt = 0;
+    int32_t i;
+    for(i = 1; i <= 100; i++) lv_subject_publish_int(&subject_int, i);
+    lv_subject_publish_pointer(&subject_pointer, &subject_int);
+    lv_subject_publish_color(&subject_color, lv_color_hex(0x123456));
+    TEST_ASSERT_EQUAL(0, lv_subject_get_int(&subject_int));
+    TEST_ASSERT_EQUAL(0, publish_notify_cnt);
+
+    /*Only the last value is applied and notified once*/
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(100, lv_subject_get_int(&subject_int));
+    TEST_ASSERT_EQUAL(0, lv_subject_get_previous_int(&subject_int));
+    TEST_ASSERT_EQUAL(100, current_v);
+    TEST_ASSERT_EQUAL(1, publish_notify_cnt);
+    TEST_ASSERT_EQUAL_PTR(&subject_int, lv_subject_get_pointer(&subject_pointer));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_subject_get_color(&subject_color));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(1, publish_notify_cnt);
+
+    /*Wrong type is ignored*/
+    lv_subject_publish_pointer(&subject_int, NULL);
+    lv_subject_apply_published();
+    TEST_ASSERT_EQUAL(100, lv_subject_get_int(&subject_int));
+
+    /*A deinitialized subject is removed from the published ones*/
+    lv_subject_publish_int(&subject_int, 5);
+    lv_subject_publish_pointer(&subject_pointer, NULL);
+    lv_subject_deinit(&subject_int);
+    lv_subject_apply_published();
+    TEST_ASSERT_EQUAL(1, publish_notify_cnt);
+    TEST_ASSERT_EQUAL_PTR(NULL, lv_subject_get_pointer(&subject_pointer));
+
+    lv_subject_deinit(&subject_pointer);
+    lv_subject_deinit(&subject_color);
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+#define PUBLISH_THREAD_CNT  4
+#define PUBLISH_CNT         10000
+
+static lv_subject_t publish_subjects[PUBLISH_THREAD_CNT];
+
+static void publish_thread_cb(void * user_data)
+{
+    lv_subject_t * subject = user_data;
+    int32_t i;
+    for(i = 1; i <= PUBLISH_CNT; i++) lv_subject_publish_int(subject, i);
+}
+#endif
+
+void test_observer_publish_threads(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    lv_thread_t threads[PUBLISH_THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < PUBLISH_THREAD_CNT; i++) {
+        lv_subject_init_int(&publish_subjects[i], 0);
+        lv_thread_init(&threads[i], LV_THREAD_PRIO_MID, publish_thread_cb, 64 * 1024, &publish_subjects[i]);
+    }
+
+    /*Apply the values while they are being published*/
+    for(i = 0; i < 100; i++) lv_timer_handler();
+
+    for(i = 0; i < PUBLISH_THREAD_CNT; i++) lv_thread_delete(&threads[i]);
+
+    lv_timer_handler();
+    for(i = 0; i < PUBLISH_THREAD_CNT; i++) {
+        TEST_ASSERT_EQUAL(PUBLISH_CNT, lv_subject_get_int(&publish_subjects[i]));
+        lv_subject_deinit(&publish_subjects[i]);
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif
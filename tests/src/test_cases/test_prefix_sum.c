@@ -0,0 +1,80 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define VALUE_CNT 100
+
+static lv_prefix_sum_t ps;
+static int32_t values[VALUE_CNT];
+
+void setUp(void)
+{
+    lv_prefix_sum_init(&ps);
+}
+
+void tearDown(void)
+{
+    lv_prefix_sum_deinit(&ps);
+}
+
+static void check_sums(void)
+{
+    int32_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < VALUE_CNT; i++) {
+        TEST_ASSERT_EQUAL_INT32(sum, lv_prefix_sum_get(&ps, i));
+        sum += values[i];
+    }
+    TEST_ASSERT_EQUAL_INT32(sum, lv_prefix_sum_get(&ps, VALUE_CNT));
+}
+
+void test_prefix_sum_get(void)
+{
+    uint32_t i;
+    for(i = 0; i < VALUE_CNT; i++) values[i] = (i * 7) % 13;
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_prefix_sum_build(&ps, values, VALUE_CNT));
+    check_sums();
+
+    /*Change some values*/
+    for(i = 0; i < VALUE_CNT; i += 3) {
+        int32_t diff = (int32_t)(i % 5) - 2;
+        values[i] += diff;
+        lv_prefix_sum_add(&ps, i, diff);
+    }
+    check_sums();
+
+    /*Rebuild with zeros and fewer values*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_prefix_sum_build(&ps, NULL, 10));
+    TEST_ASSERT_EQUAL_INT32(0, lv_prefix_sum_get(&ps, 10));
+}
+
+void test_prefix_sum_find(void)
+{
+    uint32_t i;
+    for(i = 0; i < VALUE_CNT; i++) values[i] = i % 4 == 0 ? 0 : 10 + i % 7;
+
+    lv_prefix_sum_build(&ps, values, VALUE_CNT);
+
+    /*Compare with a linear search for every sum*/
+    int32_t total = lv_prefix_sum_get(&ps, VALUE_CNT);
+    int32_t sum;
+    for(sum = -5; sum < total + 5; sum++) {
+        uint32_t expected = 0;
+        int32_t acc = 0;
+        while(expected < VALUE_CNT && acc + values[expected] <= sum) {
+            acc += values[expected];
+            expected++;
+        }
+        if(sum < 0) expected = 0;
+
+        TEST_ASSERT_EQUAL_UINT32(expected, lv_prefix_sum_find(&ps, sum));
+    }
+
+    lv_prefix_sum_build(&ps, NULL, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_prefix_sum_find(&ps, 100));
+}
+
+#endif
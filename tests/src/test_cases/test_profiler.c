@@ -70,6 +70,30 @@ void test_profiler_normal(void)
     TEST_ASSERT_EQUAL_STRING(output_buf[3], "   LVGL-1 [0] 3.000000000: tracing_mark_write: E|1|custom_tag\n");
 }
 
+void test_profiler_counter(void)
+{
+    /* enable profiler */
+    lv_profiler_builtin_set_enable(true);
+
+    /* reset */
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    /* test profiler */
+    LV_PROFILER_COUNTER("custom_counter", 42);
+    LV_PROFILER_COUNTER("custom_counter", -1);
+
+    /* flush output */
+    lv_profiler_builtin_flush();
+
+    /* check output */
+    TEST_ASSERT_EQUAL_INT(output_line, 2);
+    TEST_ASSERT_EQUAL_INT(profiler_tick, 2);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "   LVGL-1 [0] 0.000000000: tracing_mark_write: C|1|custom_counter|42\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[1], "   LVGL-1 [0] 1.000000000: tracing_mark_write: C|1|custom_counter|-1\n");
+}
+
 void test_profiler_disable(void)
 {
     /* disable profiler */
@@ -0,0 +1,339 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#if LV_USE_REMOTE_FB
+
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#if LV_USE_LZ4_INTERNAL
+    #include "../../../src/libs/lz4/lz4.h"
+#endif
+
+#define HOR_RES     200
+#define VER_RES     150
+
+/*The client side of the connection*/
+typedef struct {
+    int fd;
+    uint32_t px_size;
+    uint8_t * frame;
+    uint32_t frame_cnt;
+    uint32_t rect_cnt;
+    uint32_t px_cnt;            /*Number of pixels received*/
+    uint32_t encodings;         /*Bit mask of the received encodings*/
+    lv_area_t bounds;           /*Bounding box of the received areas*/
+} client_t;
+
+static lv_display_t * disp;
+static lv_obj_t * rect;
+static client_t client;
+
+static void read_all(void * buf, uint32_t size)
+{
+    uint8_t * p = buf;
+    while(size > 0) {
+        ssize_t res = recv(client.fd, p, size, 0);
+        TEST_ASSERT_GREATER_THAN(0, res);
+        p += res;
+        size -= (uint32_t)res;
+    }
+}
+
+static uint32_t get_u16(const uint8_t * p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t * p)
+{
+    return get_u16(p) | (get_u16(p + 2) << 16);
+}
+
+static void decode_rle(const uint8_t * src, uint32_t size, uint8_t * dst, uint32_t px_cnt)
+{
+    uint32_t i = 0;
+    while(size > 0) {
+        uint32_t run = src[0];
+        TEST_ASSERT_GREATER_THAN(0, run);
+        TEST_ASSERT_LESS_OR_EQUAL(px_cnt, i + run);
+        while(run--) {
+            lv_memcpy(dst + i * client.px_size, src + 1, client.px_size);
+            i++;
+        }
+        src += 1 + client.px_size;
+        size -= 1 + client.px_size;
+    }
+    TEST_ASSERT_EQUAL_UINT32(px_cnt, i);
+}
+
+static void read_msg(void)
+{
+    uint8_t header[LV_REMOTE_FB_HEADER_SIZE];
+    read_all(header, sizeof(header));
+    uint32_t size = get_u32(&header[12]);
+
+    if(header[0] == LV_REMOTE_FB_MSG_FRAME_END) {
+        TEST_ASSERT_EQUAL_UINT32(0, size);
+        client.frame_cnt++;
+        return;
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(LV_REMOTE_FB_MSG_RECT, header[0]);
+    lv_area_t area;
+    lv_area_set(&area, get_u16(&header[4]), get_u16(&header[6]),
+                get_u16(&header[4]) + get_u16(&header[8]) - 1, get_u16(&header[6]) + get_u16(&header[10]) - 1);
+    TEST_ASSERT_LESS_THAN(HOR_RES, area.x2);
+    TEST_ASSERT_LESS_THAN(VER_RES, area.y2);
+
+    uint32_t w = lv_area_get_width(&area);
+    uint32_t px_cnt = lv_area_get_size(&area);
+    uint8_t * payload = lv_malloc(size);
+    uint8_t * pixels = lv_malloc(px_cnt * client.px_size);
+    read_all(payload, size);
+
+    switch(header[1]) {
+        case LV_REMOTE_FB_ENCODING_RAW:
+            TEST_ASSERT_EQUAL_UINT32(px_cnt * client.px_size, size);
+            lv_memcpy(pixels, payload, size);
+            break;
+        case LV_REMOTE_FB_ENCODING_RLE:
+            decode_rle(payload, size, pixels, px_cnt);
+            break;
+#if LV_USE_LZ4_INTERNAL
+        case LV_REMOTE_FB_ENCODING_LZ4:
+            TEST_ASSERT_EQUAL_INT(px_cnt * client.px_size,
+                                  LZ4_decompress_safe((const char *)payload, (char *)pixels, size, px_cnt * client.px_size));
+            break;
+#endif
+        default:
+            TEST_FAIL_MESSAGE("Unknown encoding");
+    }
+
+    int32_t y;
+    for(y = area.y1; y <= area.y2; y++) {
+        lv_memcpy(client.frame + (y * HOR_RES + area.x1) * client.px_size,
+                  pixels + (y - area.y1) * w * client.px_size, w * client.px_size);
+    }
+
+    if(client.rect_cnt == 0) client.bounds = area;
+    else lv_area_join(&client.bounds, &client.bounds, &area);
+    client.rect_cnt++;
+    client.px_cnt += px_cnt;
+    client.encodings |= 1 << header[1];
+
+    lv_free(payload);
+    lv_free(pixels);
+}
+
+/*Refresh the display and process everything it has sent*/
+static void refresh(void)
+{
+    client.frame_cnt = 0;
+    client.rect_cnt = 0;
+    client.px_cnt = 0;
+    client.encodings = 0;
+
+    lv_refr_now(disp);
+
+    /*The data is sent synchronously so it's already received on the loopback interface*/
+    struct pollfd pfd = {.fd = client.fd, .events = POLLIN};
+    while(poll(&pfd, 1, 0) > 0) read_msg();
+}
+
+static void client_connect(void)
+{
+    client.fd = socket(AF_INET, SOCK_STREAM, 0);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, client.fd);
+
+    struct sockaddr_in addr;
+    lv_memzero(&addr, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(lv_remote_fb_get_port(disp));
+    TEST_ASSERT_EQUAL_INT(0, connect(client.fd, (struct sockaddr *)&addr, sizeof(addr)));
+
+    uint32_t i;
+    for(i = 0; i < 10 && !lv_remote_fb_is_connected(disp); i++) lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_TRUE(lv_remote_fb_is_connected(disp));
+
+    uint8_t hello[LV_REMOTE_FB_HEADER_SIZE];
+    read_all(hello, sizeof(hello));
+    TEST_ASSERT_EQUAL_MEMORY(LV_REMOTE_FB_MAGIC, hello, 4);
+    TEST_ASSERT_EQUAL_UINT32(LV_REMOTE_FB_PROTOCOL_VERSION, get_u16(&hello[4]));
+    TEST_ASSERT_EQUAL_UINT32(lv_display_get_color_format(disp), get_u16(&hello[6]));
+    TEST_ASSERT_EQUAL_UINT32(HOR_RES, get_u32(&hello[8]));
+    TEST_ASSERT_EQUAL_UINT32(VER_RES, get_u32(&hello[12]));
+
+    client.px_size = lv_color_format_get_size(lv_display_get_color_format(disp));
+    lv_free(client.frame);
+    client.frame = lv_malloc_zeroed(HOR_RES * VER_RES * client.px_size);
+}
+
+/*Check the frame composed by the client: `rect` is red on a blue screen*/
+static void check_frame(void)
+{
+    lv_area_t rect_area;
+    lv_obj_get_coords(rect, &rect_area);
+
+    int32_t x, y;
+    for(y = 0; y < VER_RES; y++) {
+        for(x = 0; x < HOR_RES; x++) {
+            lv_point_t p = {x, y};
+            const uint8_t * px = client.frame + (y * HOR_RES + x) * client.px_size;
+            lv_color_t c;
+            if(client.px_size == 2) c = lv_color_make((px[1] & 0xF8), ((px[1] & 0x07) << 5) | ((px[0] & 0xE0) >> 3),
+                                                          (px[0] & 0x1F) << 3);
+            else c = lv_color_make(px[2], px[1], px[0]);
+
+            if(lv_area_is_point_on(&rect_area, &p, 0)) TEST_ASSERT_GREATER_THAN(0xE0, c.red);
+            else TEST_ASSERT_GREATER_THAN(0xE0, c.blue);
+        }
+    }
+}
+
+void setUp(void)
+{
+    disp = lv_remote_fb_create(HOR_RES, VER_RES, 0);
+    TEST_ASSERT_NOT_NULL(disp);
+    TEST_ASSERT_NOT_EQUAL(0, lv_remote_fb_get_port(disp));
+
+    /*Only the test's objects should be on the screen*/
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x0000ff), 0);
+
+    rect = lv_obj_create(scr);
+    lv_obj_remove_style_all(rect);
+    lv_obj_set_style_bg_opa(rect, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(rect, lv_color_hex(0xff0000), 0);
+    lv_obj_set_pos(rect, 20, 30);
+    lv_obj_set_size(rect, 40, 20);
+
+    lv_refr_now(disp);
+    lv_memzero(&client, sizeof(client));
+    client.fd = -1;
+}
+
+void tearDown(void)
+{
+    if(client.fd >= 0) close(client.fd);
+    lv_free(client.frame);
+    client.frame = NULL;
+    lv_display_delete(disp);
+}
+
+void test_remote_fb_full_frame_on_connect(void)
+{
+    client_connect();
+    refresh();
+
+    TEST_ASSERT_EQUAL_UINT32(1, client.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(HOR_RES * VER_RES, client.px_cnt);
+    check_frame();
+}
+
+void test_remote_fb_dirty_rects(void)
+{
+    static const lv_remote_fb_encoding_t encodings[] = {
+        LV_REMOTE_FB_ENCODING_RAW,
+        LV_REMOTE_FB_ENCODING_RLE,
+#if LV_USE_LZ4_INTERNAL
+        LV_REMOTE_FB_ENCODING_LZ4,
+#endif
+    };
+
+    client_connect();
+    refresh();
+
+    uint32_t i;
+    for(i = 0; i < sizeof(encodings) / sizeof(encodings[0]); i++) {
+        lv_remote_fb_set_encoding(disp, encodings[i]);
+
+        /*Only the old and the new area of the rectangle are sent*/
+        lv_area_t inv_area;
+        lv_obj_get_coords(rect, &inv_area);
+        lv_obj_set_pos(rect, lv_obj_get_x(rect) + 30, lv_obj_get_y(rect) + 10);
+        lv_obj_update_layout(rect);
+        lv_area_join(&inv_area, &inv_area, &rect->coords);
+
+        refresh();
+        TEST_ASSERT_EQUAL_UINT32(1, client.frame_cnt);
+        TEST_ASSERT_TRUE(lv_area_is_in(&client.bounds, &inv_area, 0));
+        TEST_ASSERT_LESS_OR_EQUAL(lv_area_get_size(&inv_area), client.px_cnt);
+        TEST_ASSERT_EQUAL_UINT32(1 << encodings[i], client.encodings);
+        check_frame();
+    }
+}
+
+void test_remote_fb_no_damage_no_data(void)
+{
+    client_connect();
+    refresh();
+
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(0, client.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, client.rect_cnt);
+}
+
+void test_remote_fb_reconnect(void)
+{
+    client_connect();
+    refresh();
+
+    close(client.fd);
+    client.fd = -1;
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_FALSE(lv_remote_fb_is_connected(disp));
+
+    /*Changes without a client are not sent anywhere*/
+    lv_obj_set_x(rect, 100);
+    lv_refr_now(disp);
+
+    client_connect();
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(HOR_RES * VER_RES, client.px_cnt);
+    check_frame();
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_remote_fb_full_frame_on_connect(void)
+{
+}
+
+void test_remote_fb_dirty_rects(void)
+{
+}
+
+void test_remote_fb_no_damage_no_data(void)
+{
+}
+
+void test_remote_fb_reconnect(void)
+{
+}
+
+#endif
+
+#endif
@@ -13,12 +13,10 @@ void test_snapshot_should_not_leak_memory(void)
     uint32_t idx = 0;
     size_t initial_available_memory = 0;
     size_t final_available_memory = 0;
-    lv_mem_monitor_t monitor;
 
     lv_draw_buf_t * snapshots[NUM_SNAPSHOTS] = {NULL};
 
-    lv_mem_monitor(&monitor);
-    initial_available_memory = monitor.free_size;
+    initial_available_memory = lv_test_get_free_mem();
 
     for(idx = 0; idx < NUM_SNAPSHOTS; idx++) {
         snapshots[idx] = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_NATIVE_WITH_ALPHA);
@@ -29,8 +27,7 @@ void test_snapshot_should_not_leak_memory(void)
         lv_draw_buf_destroy(snapshots[idx]);
     }
 
-    lv_mem_monitor(&monitor);
-    final_available_memory = monitor.free_size;
+    final_available_memory = lv_test_get_free_mem();
 
     TEST_ASSERT_EQUAL(initial_available_memory, final_available_memory);
 }
@@ -40,7 +37,6 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
     uint32_t idx = 0;
     size_t initial_available_memory = 0;
     size_t final_available_memory = 0;
-    lv_mem_monitor_t monitor;
 
     lv_draw_buf_t * snapshots[NUM_SNAPSHOTS] = {NULL};
     lv_obj_t * label = lv_label_create(lv_screen_active());
@@ -49,8 +45,7 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
     lv_label_set_text(label, "Wubba lubba dub dub!");
     lv_obj_set_style_transform_rotation(label, 450, 0);
 
-    lv_mem_monitor(&monitor);
-    initial_available_memory = monitor.free_size;
+    initial_available_memory = lv_test_get_free_mem();
 
     for(idx = 0; idx < NUM_SNAPSHOTS; idx++) {
         snapshots[idx] = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_NATIVE_WITH_ALPHA);
@@ -61,8 +56,7 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
         lv_draw_buf_destroy(snapshots[idx]);
     }
 
-    lv_mem_monitor(&monitor);
-    final_available_memory = monitor.free_size;
+    final_available_memory = lv_test_get_free_mem();
     lv_obj_delete(label);
 
     TEST_ASSERT_EQUAL(initial_available_memory, final_available_memory);
@@ -112,6 +106,181 @@ void test_snapshot_take_snapshot_with_transform(void)
     lv_draw_buf_destroy(draw_dsc);
 }
 
+static void assert_live_snapshot_is_full(lv_snapshot_live_t * snapshot, lv_obj_t * obj)
+{
+    lv_draw_buf_t * full = lv_snapshot_take(obj, LV_COLOR_FORMAT_ARGB8888);
+    lv_draw_buf_t * live = lv_snapshot_live_get_draw_buf(snapshot);
+    TEST_ASSERT_NOT_NULL(full);
+    TEST_ASSERT_NOT_NULL(live);
+    TEST_ASSERT_EQUAL(full->header.w, live->header.w);
+    TEST_ASSERT_EQUAL(full->header.h, live->header.h);
+    TEST_ASSERT_EQUAL(full->header.stride, live->header.stride);
+
+    /*Compare only the pixels as the padding at the end of the lines isn't cleared*/
+    uint32_t y;
+    for(y = 0; y < full->header.h; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(full, 0, y), lv_draw_buf_goto_xy(live, 0, y), full->header.w * 4);
+    }
+    lv_draw_buf_destroy(full);
+}
+
+void test_snapshot_live_renders_only_the_invalidated_areas(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(parent, 300, 220);
+    lv_obj_t * cont = lv_obj_create(parent);
+    lv_obj_set_size(cont, 200, 150);
+    lv_obj_set_pos(cont, 20, 20);
+    lv_obj_t * child = lv_obj_create(cont);
+    lv_obj_set_size(child, 40, 30);
+    lv_obj_set_pos(child, 10, 10);
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, "Live snapshot");
+    lv_obj_set_pos(label, 10, 80);
+
+    lv_snapshot_live_t * snapshot = lv_snapshot_live_create(cont, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot);
+
+    /*The first update renders everything*/
+    uint32_t cnt;
+    const lv_area_t * dirty;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    dirty = lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_EQUAL(1, cnt);
+    TEST_ASSERT_EQUAL(lv_snapshot_live_get_draw_buf(snapshot)->header.w, lv_area_get_width(&dirty[0]));
+    assert_live_snapshot_is_full(snapshot, cont);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_EQUAL(0, cnt);
+
+    /*Only the changed child is rendered again*/
+    lv_obj_set_style_bg_color(child, lv_palette_main(LV_PALETTE_RED), 0);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    dirty = lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_EQUAL(1, cnt);
+    lv_area_t child_area;
+    lv_obj_get_coords(child, &child_area);
+    lv_area_increase(&child_area, lv_obj_get_ext_draw_size(child), lv_obj_get_ext_draw_size(child));
+    int32_t ext_size = lv_obj_get_ext_draw_size(cont);
+    lv_area_move(&child_area, -(cont->coords.x1 - ext_size), -(cont->coords.y1 - ext_size));
+    TEST_ASSERT_EQUAL_INT32(child_area.x1, dirty[0].x1);
+    TEST_ASSERT_EQUAL_INT32(child_area.y2, dirty[0].y2);
+    assert_live_snapshot_is_full(snapshot, cont);
+
+    lv_label_set_text(label, "Live snapshot updated");
+    lv_obj_set_pos(child, 100, 20);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    dirty = lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_GREATER_THAN(1, cnt);
+    assert_live_snapshot_is_full(snapshot, cont);
+
+    /*Moving the parent doesn't change the image*/
+    lv_obj_set_pos(parent, 30, 40);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_EQUAL(0, cnt);
+    assert_live_snapshot_is_full(snapshot, cont);
+
+    /*A new size needs a new image*/
+    lv_obj_set_width(cont, 250);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    dirty = lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_EQUAL(1, cnt);
+    TEST_ASSERT_EQUAL(lv_snapshot_live_get_draw_buf(snapshot)->header.w, lv_area_get_width(&dirty[0]));
+    assert_live_snapshot_is_full(snapshot, cont);
+
+    lv_snapshot_live_delete(snapshot);
+    TEST_ASSERT_FALSE(cont->spec_attr->inv_area_tracked);
+    lv_obj_delete(parent);
+}
+
+void test_snapshot_live_transformed_child(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 200, 150);
+    lv_obj_t * scaled = lv_obj_create(cont);
+    lv_obj_remove_style_all(scaled);
+    lv_obj_set_size(scaled, 50, 50);
+    lv_obj_set_style_transform_scale(scaled, 512, 0);
+    lv_obj_t * child = lv_obj_create(scaled);
+    lv_obj_remove_style_all(child);
+    lv_obj_set_style_bg_opa(child, LV_OPA_COVER, 0);
+    lv_obj_set_size(child, 10, 10);
+    lv_obj_set_pos(child, 20, 20);
+
+    lv_snapshot_live_t * snapshot = lv_snapshot_live_create(cont, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    lv_draw_buf_t * before = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+
+    lv_obj_set_style_bg_color(child, lv_palette_main(LV_PALETTE_RED), 0);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot));
+    lv_draw_buf_t * after = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+
+    /*The child is drawn twice as large, the rendered area covers all of its pixels*/
+    lv_area_t changed = {INT32_MAX, INT32_MAX, -1, -1};
+    int32_t x, y;
+    for(y = 0; y < (int32_t)before->header.h; y++) {
+        for(x = 0; x < (int32_t)before->header.w; x++) {
+            if(lv_memcmp(lv_draw_buf_goto_xy(before, x, y), lv_draw_buf_goto_xy(after, x, y), 4) == 0) continue;
+            changed.x1 = LV_MIN(changed.x1, x);
+            changed.y1 = LV_MIN(changed.y1, y);
+            changed.x2 = LV_MAX(changed.x2, x);
+            changed.y2 = LV_MAX(changed.y2, y);
+        }
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(2 * lv_obj_get_width(child), lv_area_get_width(&changed));
+
+    uint32_t cnt;
+    const lv_area_t * dirty = lv_snapshot_live_get_dirty_areas(snapshot, &cnt);
+    TEST_ASSERT_EQUAL(1, cnt);
+    TEST_ASSERT_TRUE(lv_area_is_in(&changed, &dirty[0], 0));
+
+    lv_draw_buf_destroy(before);
+    lv_draw_buf_destroy(after);
+    lv_snapshot_live_delete(snapshot);
+    lv_obj_delete(cont);
+}
+
+void test_snapshot_tracker_count(void)
+{
+    uint32_t tracker_cnt = LV_GLOBAL_DEFAULT()->inv_area_tracker_cnt;
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+
+    lv_snapshot_live_t * snapshot = lv_snapshot_live_create(obj, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_EQUAL_UINT32(tracker_cnt + 1, LV_GLOBAL_DEFAULT()->inv_area_tracker_cnt);
+    lv_snapshot_live_delete(snapshot);
+    TEST_ASSERT_EQUAL_UINT32(tracker_cnt, LV_GLOBAL_DEFAULT()->inv_area_tracker_cnt);
+
+    /*Deleting a tracked object stops the tracking too*/
+    snapshot = lv_snapshot_live_create(obj, LV_COLOR_FORMAT_ARGB8888);
+    lv_obj_delete(obj);
+    TEST_ASSERT_EQUAL_UINT32(tracker_cnt, LV_GLOBAL_DEFAULT()->inv_area_tracker_cnt);
+    lv_snapshot_live_delete(snapshot);
+}
+
+void test_snapshot_live_object_deleted(void)
+{
+    size_t initial_available_memory = lv_test_get_free_mem();
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_snapshot_live_t * snapshot1 = lv_snapshot_live_create(obj, LV_COLOR_FORMAT_ARGB8888);
+    lv_snapshot_live_t * snapshot2 = lv_snapshot_live_create(obj, LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot1));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_snapshot_live_update(snapshot2));
+
+    /*The other snapshot still tracks the object*/
+    lv_snapshot_live_delete(snapshot1);
+    TEST_ASSERT_TRUE(obj->spec_attr->inv_area_tracked);
+
+    lv_obj_delete(obj);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_snapshot_live_update(snapshot2));
+    TEST_ASSERT_NOT_NULL(lv_snapshot_live_get_draw_buf(snapshot2));
+    lv_snapshot_live_delete(snapshot2);
+
+    TEST_ASSERT_EQUAL(initial_available_memory, lv_test_get_free_mem());
+}
+
 #else /*LV_USE_SNAPSHOT*/
 
 void test_snapshot_should_not_leak_memory(void)
@@ -134,6 +303,26 @@ void test_snapshot_take_snapshot_with_transform(void)
 
 }
 
+void test_snapshot_live_renders_only_the_invalidated_areas(void)
+{
+
+}
+
+void test_snapshot_live_transformed_child(void)
+{
+
+}
+
+void test_snapshot_tracker_count(void)
+{
+
+}
+
+void test_snapshot_live_object_deleted(void)
+{
+
+}
+
 #endif
 
 #endif
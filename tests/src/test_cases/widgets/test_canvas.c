@@ -157,4 +157,115 @@ void test_canvas_fill_and_set_px(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/canvas_1.png");
 }
 
+/*Get the bounding box of the invalidated areas of the display*/
+static bool get_inv_area(lv_area_t * area)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(i == 0) *area = disp->inv_areas[0];
+        else lv_area_join(area, area, &disp->inv_areas[i]);
+    }
+    return disp->inv_p > 0;
+}
+
+static void assert_inv_area(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t area;
+    TEST_ASSERT_TRUE(get_inv_area(&area));
+    TEST_ASSERT_EQUAL_INT32(x1, area.x1);
+    TEST_ASSERT_EQUAL_INT32(y1, area.y1);
+    TEST_ASSERT_EQUAL_INT32(x2, area.x2);
+    TEST_ASSERT_EQUAL_INT32(y2, area.y2);
+}
+
+void test_canvas_invalidate_only_drawn_area(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(g_screen_active);
+    lv_obj_set_pos(canvas, 50, 40);
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, 100, 100, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+    canvas_draw_buf_reshape(&draw_buf);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_hex(0xff0000);
+    lv_area_t coords = {10, 20, 29, 24};
+    lv_draw_rect(&layer, &rect_dsc, &coords);
+
+    /*The parts out of the canvas are not invalidated*/
+    lv_area_t coords2 = {90, 95, 150, 150};
+    lv_draw_rect(&layer, &rect_dsc, &coords2);
+    lv_canvas_finish_layer(canvas, &layer);
+    assert_inv_area(60, 60, 149, 139);
+    lv_refr_now(NULL);
+
+    lv_canvas_set_px(canvas, 7, 8, lv_color_black(), LV_OPA_COVER);
+    assert_inv_area(57, 48, 57, 48);
+    lv_refr_now(NULL);
+
+    /*With inner alignment the drawn part moves too*/
+    lv_obj_set_size(canvas, 120, 120);
+    lv_refr_now(NULL);
+    lv_canvas_set_px(canvas, 7, 8, lv_color_black(), LV_OPA_COVER);
+    assert_inv_area(67, 58, 67, 58);
+    lv_refr_now(NULL);
+
+    /*The pixels are not mapped 1:1 when the image is scaled, invalidate the whole canvas*/
+    lv_obj_set_size(canvas, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_image_set_scale(canvas, 512);
+    lv_refr_now(NULL);
+    lv_canvas_set_px(canvas, 7, 8, lv_color_black(), LV_OPA_COVER);
+    lv_area_t area;
+    TEST_ASSERT_TRUE(get_inv_area(&area));
+    TEST_ASSERT_TRUE(lv_area_is_in(&canvas->coords, &area, 0));
+}
+
+void test_canvas_set_px_spans(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(g_screen_active);
+    lv_obj_set_pos(canvas, 50, 40);
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, 100, 100, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+    canvas_draw_buf_reshape(&draw_buf);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+
+    const lv_canvas_span_t spans[] = {
+        {.x = 10, .y = 30, .len = 5, .color = LV_COLOR_MAKE(0xff, 0x00, 0x00), .opa = LV_OPA_COVER},
+        {.x = 12, .y = 31, .len = 1, .color = LV_COLOR_MAKE(0x00, 0xff, 0x00), .opa = LV_OPA_50},
+        {.x = 95, .y = 40, .len = 10, .color = LV_COLOR_MAKE(0x00, 0x00, 0xff), .opa = LV_OPA_COVER},
+        {.x = -5, .y = 50, .len = 3, .color = LV_COLOR_MAKE(0x00, 0x00, 0xff), .opa = LV_OPA_COVER},
+        {.x = 0, .y = 100, .len = 10, .color = LV_COLOR_MAKE(0x00, 0x00, 0xff), .opa = LV_OPA_COVER},
+    };
+    lv_canvas_set_px_spans(canvas, spans, sizeof(spans) / sizeof(spans[0]));
+
+    /*Only the pixels in the canvas are set and invalidated*/
+    assert_inv_area(60, 70, 149, 80);
+
+    lv_color32_t c;
+    c = lv_canvas_get_px(canvas, 10, 30);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.red);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.green);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, c.alpha);
+    c = lv_canvas_get_px(canvas, 14, 30);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.red);
+    c = lv_canvas_get_px(canvas, 15, 30);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.green);
+    c = lv_canvas_get_px(canvas, 12, 31);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.green);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, c.alpha);
+    c = lv_canvas_get_px(canvas, 99, 40);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.blue);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.red);
+    c = lv_canvas_get_px(canvas, 0, 50);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.red);
+}
+
 #endif
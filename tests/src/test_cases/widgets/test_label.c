@@ -626,4 +626,75 @@ void test_label_with_recolor_cmd(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_recolor.png");
 }
 
+void test_label_incremental_edit(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    /*Edit a wrapped label many times and compare it with a label getting the same text at once*/
+    lv_obj_t * edited = lv_label_create(lv_screen_active());
+    lv_obj_set_width(edited, 150);
+    lv_label_set_text(edited, long_text_multiline);
+
+    lv_obj_t * ref = lv_label_create(lv_screen_active());
+    lv_obj_set_width(ref, 150);
+
+    static const char * inserts[] = {"a", "word ", "\n", "Loremipsumdolorsitametconsectetur", " ", "\xC3\xA1rv\xC3\xADz "};
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t len = lv_text_get_encoded_length(lv_label_get_text(edited));
+        uint32_t pos = (seed >> 8) % (len + 1);
+        if(i % 3 == 2 && len > 0) {
+            lv_label_cut_text(edited, LV_MIN(pos, len - 1), 1 + (seed >> 20) % 8);
+        }
+        else {
+            lv_label_ins_text(edited, pos, inserts[(seed >> 16) % 6]);
+        }
+
+        if(i % 10 != 0) continue;
+
+        lv_label_set_text(ref, lv_label_get_text(edited));
+        lv_obj_update_layout(lv_screen_active());
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_width(ref), lv_obj_get_width(edited));
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(ref), lv_obj_get_height(edited));
+
+        uint32_t j;
+        len = lv_text_get_encoded_length(lv_label_get_text(edited));
+        for(j = 0; j <= len; j += 7) {
+            lv_point_t edited_pos;
+            lv_point_t ref_pos;
+            lv_label_get_letter_pos(edited, j, &edited_pos);
+            lv_label_get_letter_pos(ref, j, &ref_pos);
+            TEST_ASSERT_EQUAL_INT32(ref_pos.x, edited_pos.x);
+            TEST_ASSERT_EQUAL_INT32(ref_pos.y, edited_pos.y);
+        }
+    }
+
+    /*The size changes are followed too*/
+    lv_label_set_text(ref, lv_label_get_text(edited));
+    lv_obj_set_width(edited, 90);
+    lv_obj_set_width(ref, 90);
+    lv_obj_update_layout(lv_screen_active());
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(ref), lv_obj_get_height(edited));
+}
+
+void test_label_set_text_fmt_then_ins_text(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    /*The buffer of the formatted text is smaller than the previous one,
+     *inserting must not assume the old size*/
+    lv_obj_t * fmt_label = lv_label_create(lv_screen_active());
+    lv_label_set_text(fmt_label, long_text_multiline);
+    lv_label_set_text_fmt(fmt_label, "%d", 1);
+    lv_label_ins_text(fmt_label, LV_LABEL_POS_LAST, "0123456789");
+    TEST_ASSERT_EQUAL_STRING("10123456789", lv_label_get_text(fmt_label));
+
+    /*The lines of the old text are not used either*/
+    lv_point_t pos;
+    lv_label_get_letter_pos(fmt_label, 10, &pos);
+    TEST_ASSERT_EQUAL_INT32(0, pos.y);
+    TEST_ASSERT_GREATER_THAN_INT32(0, pos.x);
+}
 #endif
@@ -48,6 +48,117 @@ void test_list_get_text_from_label(void)
     TEST_ASSERT_EQUAL_STRING(message, lv_label_get_text(label));
 }
 
+static uint32_t bind_cnt;
+
+static void virtual_bind_cb(lv_obj_t * obj, lv_obj_t * item, uint32_t index)
+{
+    bind_cnt++;
+    lv_list_set_button_text(obj, item, "");
+    lv_label_set_text_fmt(lv_obj_get_child(item, 0), "Item %" LV_PRIu32, index);
+}
+
+static lv_obj_t * virtual_create_cb(lv_obj_t * obj)
+{
+    lv_obj_t * item = lv_obj_create(obj);
+    lv_obj_set_width(item, lv_pct(100));
+    return item;
+}
+
+static void virtual_size_bind_cb(lv_obj_t * obj, lv_obj_t * item, uint32_t index)
+{
+    LV_UNUSED(obj);
+    lv_obj_set_height(item, index % 2 ? 60 : 30);
+}
+
+void test_list_virtual_creates_only_the_visible_items(void)
+{
+    lv_obj_set_size(list, 200, 300);
+    lv_list_set_item_count(list, 10000);
+    lv_list_set_item_cb(list, NULL, virtual_bind_cb);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(10000, lv_list_get_item_count(list));
+
+    uint32_t child_cnt = lv_obj_get_child_count(list);
+    TEST_ASSERT_GREATER_THAN(0, child_cnt);
+    TEST_ASSERT_LESS_THAN(30, child_cnt);
+    TEST_ASSERT_NULL(lv_list_get_item(list, 5000));
+
+    lv_obj_t * item = lv_list_get_item(list, 0);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_STRING("Item 0", lv_list_get_button_text(list, item));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_list_get_item_index(list, item));
+
+    /*The items are reused after scrolling*/
+    lv_list_scroll_to_item(list, 5000, LV_ANIM_OFF);
+    TEST_ASSERT_NULL(lv_list_get_item(list, 0));
+    item = lv_list_get_item(list, 5000);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_STRING("Item 5000", lv_list_get_button_text(list, item));
+    TEST_ASSERT_EQUAL_UINT32(5000, lv_list_get_item_index(list, item));
+    TEST_ASSERT_LESS_THAN(30, lv_obj_get_child_count(list));
+
+    lv_obj_update_layout(list);
+    lv_area_t list_area;
+    lv_obj_get_content_coords(list, &list_area);
+    TEST_ASSERT_EQUAL_INT32(list_area.y1, item->coords.y1);
+
+    lv_list_scroll_to_item(list, 9999, LV_ANIM_OFF);
+    TEST_ASSERT_NOT_NULL(lv_list_get_item(list, 9999));
+
+    /*Rebind the visible items only*/
+    bind_cnt = 0;
+    lv_list_refresh_items(list);
+    TEST_ASSERT_GREATER_THAN(0, bind_cnt);
+    TEST_ASSERT_LESS_THAN(30, bind_cnt);
+
+    /*Return to normal mode*/
+    lv_list_set_item_cb(list, NULL, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_count(list));
+
+    lv_obj_delete(list);
+}
+
+void test_list_virtual_positions_items_by_their_height(void)
+{
+    lv_obj_set_size(list, 200, 300);
+    lv_obj_set_style_pad_row(list, 5, 0);
+    lv_list_set_item_height(list, 40);
+    lv_list_set_item_cb(list, virtual_create_cb, virtual_size_bind_cb);
+    lv_list_set_item_count(list, 1000);
+    lv_obj_update_layout(list);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * item = lv_list_get_item(list, i);
+        lv_obj_t * next = lv_list_get_item(list, i + 1);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_NOT_NULL(next);
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_y(item) + lv_obj_get_height(item) + 5, lv_obj_get_y(next));
+    }
+
+    /*The scroll range uses the measured heights and the estimated heights for the rest*/
+    uint32_t bound_cnt = 0;
+    int32_t h = 0;
+    for(i = 0; i < 1000; i++) {
+        if(lv_list_get_item(list, i)) {
+            h += i % 2 ? 60 : 30;
+            bound_cnt++;
+        }
+        else {
+            h += 40;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT32(h + 999 * 5, lv_obj_get_self_height(list));
+
+    /*Deleted items are forgotten*/
+    lv_obj_clean(list);
+    TEST_ASSERT_NULL(lv_list_get_item(list, 0));
+    lv_list_refresh_items(list);
+    TEST_ASSERT_NOT_NULL(lv_list_get_item(list, 0));
+
+    lv_obj_delete(list);
+}
+
 void test_list_snapshot(void)
 {
     lv_obj_t * snapshot_list = lv_list_create(lv_screen_active());
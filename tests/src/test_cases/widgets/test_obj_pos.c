@@ -51,4 +51,47 @@ void test_content_parent_pct_child_pos_1(void)
     TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_y(child2));
 }
 
+void test_obj_area_is_visible_keeps_partial_area(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(parent);
+    lv_obj_set_pos(parent, 10, 10);
+    lv_obj_set_size(parent, 100, 100);
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, 50, 50);
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_update_layout(obj);
+
+    /*An area inside the object is not widened to the object*/
+    lv_area_t area = {70, 70, 79, 79};
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(obj, &area));
+    TEST_ASSERT_EQUAL_INT32(70, area.x1);
+    TEST_ASSERT_EQUAL_INT32(70, area.y1);
+    TEST_ASSERT_EQUAL_INT32(79, area.x2);
+    TEST_ASSERT_EQUAL_INT32(79, area.y2);
+
+    /*Truncated to the object and the parent, but not widened to the parent*/
+    lv_area_set(&area, 0, 80, 200, 89);
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(obj, &area));
+    TEST_ASSERT_EQUAL_INT32(60, area.x1);
+    TEST_ASSERT_EQUAL_INT32(80, area.y1);
+    TEST_ASSERT_EQUAL_INT32(109, area.x2);
+    TEST_ASSERT_EQUAL_INT32(89, area.y2);
+
+    /*The extended draw area of a parent with visible overflow is kept*/
+    lv_obj_set_style_outline_width(parent, 5, 0);
+    lv_obj_set_style_outline_opa(parent, LV_OPA_COVER, 0);
+    lv_obj_add_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_refresh_ext_draw_size(parent);
+    lv_area_set(&area, 0, 80, 200, 89);
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(obj, &area));
+    TEST_ASSERT_EQUAL_INT32(60, area.x1);
+    TEST_ASSERT_EQUAL_INT32(114, area.x2);
+
+    /*Out of the parent*/
+    lv_area_set(&area, 120, 120, 129, 129);
+    TEST_ASSERT_FALSE(lv_obj_area_is_visible(obj, &area));
+}
+
 #endif
@@ -313,4 +313,137 @@ void test_table_cell_select_should_not_allow_set_on_table_with_no_rows(void)
     TEST_ASSERT_EQUAL_UINT32(LV_TABLE_CELL_NONE, selected_column);
 }
 
+static uint32_t virtual_query_cnt;
+static uint32_t virtual_row_min;
+static uint32_t virtual_row_max;
+
+static const char * virtual_cell_value_cb(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+
+    virtual_query_cnt++;
+    virtual_row_min = LV_MIN(virtual_row_min, row);
+    virtual_row_max = LV_MAX(virtual_row_max, row);
+
+    if(col == 2) return NULL;
+    if(row % 4 == 1) lv_snprintf(buf, sizeof(buf), "Row %" LV_PRIu32 "\nsecond line", row);
+    else lv_snprintf(buf, sizeof(buf), "Row %" LV_PRIu32 " col %" LV_PRIu32, row, col);
+    return buf;
+}
+
+static void virtual_query_reset(void)
+{
+    virtual_query_cnt = 0;
+    virtual_row_min = UINT32_MAX;
+    virtual_row_max = 0;
+}
+
+void test_table_virtual_should_query_only_visible_rows(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_cell_value_cb(table, virtual_cell_value_cb);
+    TEST_ASSERT_EQUAL_PTR(virtual_cell_value_cb, lv_table_get_cell_value_cb(table));
+    TEST_ASSERT_NULL(table_ptr->cell_data);
+
+    lv_table_set_column_count(table, 3);
+    lv_table_set_column_width(table, 0, 200);
+    lv_table_set_column_width(table, 1, 200);
+    virtual_query_reset();
+    lv_table_set_row_count(table, 100000);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, virtual_query_cnt);
+    TEST_ASSERT_LESS_THAN(100, virtual_row_max);
+
+    /*Scroll to the middle: only the rows around it are queried*/
+    int32_t row_h = table_ptr->row_h[50000];
+    lv_obj_scroll_to_y(table, 50000 * row_h, LV_ANIM_OFF);
+    virtual_query_reset();
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, virtual_query_cnt);
+    TEST_ASSERT_LESS_THAN(1000, virtual_query_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(49000, virtual_row_min);
+    TEST_ASSERT_LESS_THAN(51000, virtual_row_max);
+
+    TEST_ASSERT_EQUAL_STRING("Row 123 col 1", lv_table_get_cell_value(table, 123, 1));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 123, 2));
+
+    /*The values can't be set in virtual mode*/
+    lv_table_set_cell_value(table, 0, 0, "LVGL");
+    lv_table_add_cell_ctrl(table, 0, 0, LV_TABLE_CELL_CTRL_TEXT_CROP);
+    TEST_ASSERT_EQUAL_STRING("Row 0 col 0", lv_table_get_cell_value(table, 0, 0));
+    TEST_ASSERT_FALSE(lv_table_has_cell_ctrl(table, 0, 0, LV_TABLE_CELL_CTRL_TEXT_CROP));
+}
+
+static int32_t get_row_height_sum(lv_table_t * table_ptr)
+{
+    int32_t h = 0;
+    uint32_t i;
+    for(i = 0; i < table_ptr->row_cnt; i++) h += table_ptr->row_h[i];
+    return h;
+}
+
+void test_table_virtual_should_measure_visible_rows(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_cell_value_cb(table, virtual_cell_value_cb);
+    lv_table_set_column_count(table, 3);
+    lv_table_set_column_width(table, 0, 200);
+    lv_table_set_column_width(table, 1, 200);
+    lv_table_set_row_count(table, 1000);
+    lv_obj_update_layout(table);
+
+    /*Multi-line rows are taller only if they were visible*/
+    int32_t row_h = table_ptr->row_h[0];
+    TEST_ASSERT_GREATER_THAN(row_h, table_ptr->row_h[1]);
+    TEST_ASSERT_EQUAL_INT32(row_h, table_ptr->row_h[997]);
+    TEST_ASSERT_EQUAL_INT32(get_row_height_sum(table_ptr) - 1, lv_obj_get_self_height(table));
+
+    lv_obj_scroll_to_y(table, lv_obj_get_self_height(table), LV_ANIM_OFF);
+    TEST_ASSERT_GREATER_THAN(row_h, table_ptr->row_h[997]);
+    TEST_ASSERT_EQUAL_INT32(get_row_height_sum(table_ptr) - 1, lv_obj_get_self_height(table));
+
+    /*Adding rows keeps the measured heights*/
+    lv_table_set_row_count(table, 1010);
+    TEST_ASSERT_GREATER_THAN(row_h, table_ptr->row_h[997]);
+    TEST_ASSERT_EQUAL_INT32(get_row_height_sum(table_ptr) - 1, lv_obj_get_self_height(table));
+
+    /*Refreshed rows are measured again once visible*/
+    virtual_query_reset();
+    lv_table_refresh_rows(table, 0, 10);
+    TEST_ASSERT_EQUAL_UINT32(0, virtual_query_cnt);
+    lv_obj_scroll_to_y(table, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(0, virtual_row_min);
+
+    /*Leaving virtual mode*/
+    lv_table_set_cell_value_cb(table, NULL);
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 0, 0));
+    lv_table_set_cell_value(table, 0, 0, "LVGL");
+    TEST_ASSERT_EQUAL_STRING("LVGL", lv_table_get_cell_value(table, 0, 0));
+}
+
+void test_table_self_height_should_follow_row_heights(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+    uint32_t i;
+
+    lv_table_set_column_count(table, 2);
+    for(i = 0; i < 37; i++) {
+        lv_table_set_cell_value_fmt(table, i, i % 2, i % 3 ? "%" LV_PRIu32 : "%" LV_PRIu32 "\nline", i);
+    }
+
+    /*Change single rows after the full measurement*/
+    lv_table_set_cell_value(table, 20, 0, "a\nb\nc");
+    lv_table_set_cell_value(table, 3, 1, "");
+
+    int32_t h = 0;
+    for(i = 0; i < 37; i++) h += table_ptr->row_h[i];
+    TEST_ASSERT_EQUAL_INT32(h - 1, lv_obj_get_self_height(table));
+}
+
 #endif
@@ -134,6 +134,23 @@ void test_textarea_should_hide_password_characters(void)
     TEST_ASSERT_EQUAL_STRING("OO", lv_label_get_text(lv_textarea_get_label(textarea)));
 }
 
+void test_textarea_should_edit_password(void)
+{
+    lv_textarea_set_password_mode(textarea, true);
+    lv_textarea_set_text(textarea, "ab");
+
+    uint32_t i;
+    for(i = 0; i < 40; i++) lv_textarea_add_char(textarea, '0' + i % 10);
+    lv_textarea_add_text(textarea, "xyz");
+    for(i = 0; i < 38; i++) lv_textarea_delete_char(textarea);
+    lv_textarea_add_char(textarea, 'C');
+
+    TEST_ASSERT_EQUAL_STRING("ab01234C", lv_textarea_get_text(textarea));
+
+    lv_textarea_set_password_mode(textarea, false);
+    TEST_ASSERT_EQUAL_STRING("ab01234C", lv_label_get_text(lv_textarea_get_label(textarea)));
+}
+
 void test_textarea_properties(void)
 {
 #if LV_USE_OBJ_PROPERTY
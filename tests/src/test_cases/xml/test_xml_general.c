@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 
 void setUp(void)
 {
@@ -196,6 +197,95 @@ void test_xml_component_consts(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("xml/consts_1.png");
 }
 
+void test_xml_component_compiled_view(void)
+{
+    /*`item` is registered after `list` which uses it*/
+    const char * list_xml =
+        "<component>"
+        "<api>"
+        "<prop type=\"string\" name=\"title\" default=\"No title\"/>"
+        "<prop type=\"int\" name=\"w\"/>"
+        "</api>"
+        "<consts>"
+        "<int name=\"height\" value=\"120\"/>"
+        "</consts>"
+        "<view width=\"$w\" height=\"#height\" flex_flow=\"column\">"
+        "<lv_label text=\"$title\"/>"
+        "<item text=\"$title\"/>"
+        "</view>"
+        "</component>";
+
+    const char * item_xml =
+        "<component>"
+        "<api>"
+        "<prop type=\"string\" name=\"text\"/>"
+        "</api>"
+        "<view extends=\"lv_label\" text=\"$text\">"
+        "</view>"
+        "</component>";
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_data("list", list_xml));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_data("item", item_xml));
+
+    /*Each instance resolves its own params from the same compiled view*/
+    const char * attrs1[] = {
+        "title", "First",
+        "w", "150",
+        NULL, NULL,
+    };
+    const char * attrs2[] = {
+        "title", "Second",
+        NULL, NULL,
+    };
+
+    lv_obj_t * list1 = lv_xml_create(lv_screen_active(), "list", attrs1);
+    lv_obj_t * list2 = lv_xml_create(lv_screen_active(), "list", attrs2);
+    lv_obj_t * list3 = lv_xml_create(lv_screen_active(), "list", NULL);
+    lv_obj_update_layout(lv_screen_active());
+
+    TEST_ASSERT_EQUAL(2, lv_obj_get_child_count(list1));
+    TEST_ASSERT_EQUAL_STRING("First", lv_label_get_text(lv_obj_get_child(list1, 0)));
+    TEST_ASSERT_EQUAL_STRING("First", lv_label_get_text(lv_obj_get_child(list1, 1)));
+    TEST_ASSERT_EQUAL_STRING("Second", lv_label_get_text(lv_obj_get_child(list2, 0)));
+    TEST_ASSERT_EQUAL_STRING("Second", lv_label_get_text(lv_obj_get_child(list2, 1)));
+    TEST_ASSERT_EQUAL_STRING("No title", lv_label_get_text(lv_obj_get_child(list3, 0)));
+    TEST_ASSERT_EQUAL(150, lv_obj_get_width(list1));
+    TEST_ASSERT_EQUAL(120, lv_obj_get_height(list1));
+    TEST_ASSERT_EQUAL(120, lv_obj_get_height(list3));
+
+    /*A view without elements can't be registered*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_xml_component_register_from_data("empty", "<component></component>"));
+    TEST_ASSERT_NULL(lv_xml_create(lv_screen_active(), "empty", NULL));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("list"));
+    TEST_ASSERT_NULL(lv_xml_create(lv_screen_active(), "list", NULL));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("item"));
+}
+
+void test_xml_component_no_view_no_leak(void)
+{
+    const char * no_view_xml =
+        "<component>"
+        "<api>"
+        "<prop type=\"string\" name=\"text\" default=\"Hello\"/>"
+        "</api>"
+        "<consts>"
+        "<int name=\"size\" value=\"100\"/>"
+        "</consts>"
+        "<styles>"
+        "<style name=\"red\" bg_color=\"0xff0000\"/>"
+        "</styles>"
+        "</component>";
+
+    size_t mem_before = lv_test_get_free_mem();
+
+    /*The already parsed params, consts and styles are freed*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_xml_component_register_from_data("no_view", no_view_xml));
+    TEST_ASSERT_NULL(lv_xml_component_get_ctx("no_view"));
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+}
+
 void test_xml_component_styles(void)
 {
     const char * my_btn_xml =
@@ -345,4 +435,74 @@ void test_xml_complex(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("xml/complex_1.png");
 }
 
+void test_xml_complex_binary(void)
+{
+    /*Created by scripts/xml_to_bin.py from the XML files*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_binary_file("A:src/test_assets/xml/my_h3.lvxb"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_binary_file("A:src/test_assets/xml/my_card.lvxb"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_binary_file("A:src/test_assets/xml/my_button.lvxb"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_binary_file("A:src/test_assets/xml/view.lvxb"));
+
+    lv_obj_t * obj = lv_xml_create(lv_screen_active(), "view", NULL);
+    lv_obj_set_pos(obj, 10, 10);
+
+    const char * my_button_attrs[] = {
+        "x", "10",
+        "y", "-10",
+        "align", "bottom_left",
+        "btn_text", "New button",
+        NULL, NULL,
+    };
+
+    lv_xml_create(lv_screen_active(), "my_button", my_button_attrs);
+
+    const char * slider_attrs[] = {
+        "x", "200",
+        "y", "-15",
+        "align", "bottom_left",
+        "value", "30",
+        NULL, NULL,
+    };
+
+    lv_obj_t * slider = lv_xml_create(lv_screen_active(), "lv_slider", slider_attrs);
+    lv_obj_set_width(slider, 100);
+
+    /*Looks the same as the component created from XML*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("xml/complex_1.png");
+
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("view"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("my_button"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("my_card"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("my_h3"));
+}
+
+void test_xml_binary_data(void)
+{
+    /*Load the same data from memory*/
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:src/test_assets/xml/my_h3.lvxb", LV_FS_MODE_RD));
+    static uint8_t buf[1024];
+    uint32_t size;
+    lv_fs_read(&f, buf, sizeof(buf), &size);
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_register_from_binary_data(buf, size));
+
+    const char * attrs[] = {
+        "text", "From binary",
+        NULL, NULL,
+    };
+    lv_obj_t * label = lv_xml_create(lv_screen_active(), "my_h3", attrs);
+    TEST_ASSERT_NOT_NULL(label);
+    TEST_ASSERT_EQUAL_STRING("From binary", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_xml_component_unregister("my_h3"));
+
+    /*Truncated and corrupted data is rejected*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_xml_component_register_from_binary_data(buf, 40));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_xml_component_register_from_binary_data(buf, size - 1));
+    buf[0] = 'X';
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_xml_component_register_from_binary_data(buf, size));
+}
+
 #endif